@@ -63,6 +63,9 @@ public class AsyncSplineBuilder : ModuleRules
 				"Slate",
 				"SlateCore",
                 "ProceduralMeshComponent",
+                "MeshDescription",
+                "StaticMeshDescription",
+                "AssetRegistry",
                 "Framework",
                 "PhysicsCore",
                 "UnrealEd",
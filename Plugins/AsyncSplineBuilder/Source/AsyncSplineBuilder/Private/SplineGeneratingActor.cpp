@@ -10,6 +10,7 @@
 #include "Components/TextRenderComponent.h"
 
 #include "Engine/StaticMesh.h"
+#include "StaticMeshResources.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Engine/EngineTypes.h"
@@ -22,7 +23,29 @@
 
 #include "SplinePointListAsset.h"
 
+#if WITH_EDITOR
+#include "LevelEditorViewport.h"
+#endif
+
 #include "HAL/PlatformTime.h"
+#include "Async/ParallelFor.h"
+#include "CollisionQueryParams.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Components/StaticMeshComponent.h"
+
+#if WITH_EDITOR
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "MeshDescription.h"
+#include "Misc/PackageName.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "StaticMeshAttributes.h"
+#include "UObject/Package.h"
+#endif
 
 DEFINE_LOG_CATEGORY(LogAsyncSplineBuilder);
 
@@ -85,6 +108,32 @@ USplineComponent* ASplineGeneratingActor::GetRoadSpline_Implementation() const
 	return TrackSpline;
 }
 
+TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> ASplineGeneratingActor::GetTrackFrameTable() const
+{
+	if (IsInGameThread() && TrackSpline && (!TrackFrameTable.IsValid() || !TrackFrameTable->IsUpToDate(TrackSpline)))
+	{
+		BakeTrackFrameTable();
+	}
+	return TrackFrameTable;
+}
+
+void ASplineGeneratingActor::BakeTrackFrameTable() const
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TrackFrameTable = FTrackFrameTable::Build(
+		TrackSpline,
+		FrameTableStepCm,
+		FrameTableCurvatureWindowCm,
+		[this](float Distance) { return GetHalfRoadWidthAtDistance(Distance); });
+
+	if (TrackFrameTable.IsValid())
+	{
+		ASYNC_LOG(Log, "Track frame table baked (%d samples, %.1f ms).",
+			TrackFrameTable->GetNumSamples(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+}
+
 bool ASplineGeneratingActor::LineTraceSingleForObjectsEx(
 	const FVector& StartWorld,
 	FVector& OutImpactPoint,
@@ -175,41 +224,6 @@ bool ASplineGeneratingActor::LineTraceHitLandscape(const FVector& StartPoint, FV
 	);
 }
 
-bool ASplineGeneratingActor::LineTraceHitGroundForWalls(const FVector& StartPoint, FVector& ImpactPoint, FVector& ImpactNormal) const
-{
-	UWorld* World = GetWorld();
-	if (!World) return false;
-
-	TArray<AActor*> IgnoreActors;
-	BuildTraceIgnoreActors(IgnoreActors);
-
-	// Keep your existing wall trace start/end style
-	const FVector TraceStart = StartPoint + FVector(0.f, 0.f, 100.f);
-	const FVector TraceEnd = FVector(StartPoint.X, StartPoint.Y, GroundWallLineTraceEndWorldZ);
-
-	FHitResult Hit;
-	const bool bHit = UKismetSystemLibrary::LineTraceSingleForObjects(
-		this,
-		TraceStart,
-		TraceEnd,
-		GroundWallObjectsToHitForLineTrace,
-		/*bTraceComplex*/ true,
-		IgnoreActors,
-		EDrawDebugTrace::None,
-		Hit,
-		/*bIgnoreSelf*/ true
-	);
-
-	if (bHit)
-	{
-		ImpactPoint = Hit.ImpactPoint;
-		ImpactNormal = Hit.ImpactNormal;
-		return true;
-	}
-
-	return false;
-}
-
 // ============================================================================
 // Component creation helpers (robust in Construction/Editor)
 // ============================================================================
@@ -235,7 +249,7 @@ UTextRenderComponent* ASplineGeneratingActor::CreateTextComponent(const FTransfo
 	return Comp;
 }
 
-UProceduralMeshComponent* ASplineGeneratingActor::CreateProcMeshComponent(FName DebugName)
+UProceduralMeshComponent* ASplineGeneratingActor::CreateProcMeshComponent(FName DebugName, EComponentMobility::Type Mobility)
 {
 	UWorld* World = GetWorld();
 	if (!World) return nullptr;
@@ -245,7 +259,7 @@ UProceduralMeshComponent* ASplineGeneratingActor::CreateProcMeshComponent(FName
 	if (!Comp) return nullptr;
 
 	Comp->SetupAttachment(RootComponent);
-	Comp->SetMobility(EComponentMobility::Movable);
+	Comp->SetMobility(Mobility);
 	Comp->bUseAsyncCooking = true;
 	Comp->RegisterComponent();
 
@@ -256,6 +270,27 @@ UProceduralMeshComponent* ASplineGeneratingActor::CreateProcMeshComponent(FName
 	return Comp;
 }
 
+UStaticMeshComponent* ASplineGeneratingActor::CreateStaticMeshComponent(FName DebugName, UStaticMesh* Mesh)
+{
+	UWorld* World = GetWorld();
+	if (!World) return nullptr;
+
+	const FName UniqueName = MakeUniqueObjectName(this, UStaticMeshComponent::StaticClass(), DebugName);
+	UStaticMeshComponent* Comp = NewObject<UStaticMeshComponent>(this, UStaticMeshComponent::StaticClass(), UniqueName, RF_Transactional);
+	if (!Comp) return nullptr;
+
+	Comp->SetupAttachment(RootComponent);
+	Comp->SetMobility(EComponentMobility::Static);
+	Comp->SetStaticMesh(Mesh);
+	Comp->RegisterComponent();
+
+#if WITH_EDITOR
+	AddInstanceComponent(Comp);
+#endif
+
+	return Comp;
+}
+
 USplineMeshComponent* ASplineGeneratingActor::CreateSplineMeshComponent()
 {
 	if (!TrackSpline)
@@ -371,8 +406,11 @@ ASplineGeneratingActor::ASplineGeneratingActor()
 
 	// Async defaults
 	bUseAsyncBuild = true;
-	SegmentsPerTick = 2;
+	BuildBudgetMs = 8.f;
+	bPrioritizeNearCamera = true;
 	bAutoRebuildOnConstruction = true;
+	bIncrementalRebuild = true;
+	bUseGeometryCache = true;
 
 	bIsBuilding = false;
 	bPendingRebuild = false;
@@ -388,6 +426,7 @@ ASplineGeneratingActor::ASplineGeneratingActor()
 	// Ground walls defaults
 	bGenerateGroundWalls = true;
 	GroundWallSubdivisions = 64;
+	GroundWallSegmentsPerSection = 8;
 	GroundWallOutset = 0.f;
 	GroundWallFallbackDepth = 20000.f;
 	bGroundWallsDoubleSided = true;
@@ -501,7 +540,8 @@ void ASplineGeneratingActor::Tick(float DeltaSeconds)
 
 	if (bIsBuilding)
 	{
-		BuildNextSegments(FMath::Max(1, SegmentsPerTick));
+		AvgTickSeconds = FMath::Lerp(AvgTickSeconds, (double)DeltaSeconds, 0.1);
+		BuildNextSegmentsWithinBudget(FMath::Max(0.5f, BuildBudgetMs));
 	}
 }
 #endif
@@ -526,6 +566,8 @@ void ASplineGeneratingActor::CancelAsyncBuild()
 	bIsBuilding = false;
 	bPendingRebuild = false;
 	SetActorTickEnabled(false);
+	UpdateBuildProgress();
+	PendingGeometryCacheKey.Reset();
 
 	ASYNC_LOG(Warning, "Async track build cancelled by user.");
 #endif
@@ -605,7 +647,7 @@ void ASplineGeneratingActor::ReadSplineFromDataAsset()
 	{
 		TrackSpline->AddPoint(P, false);
 	}
-	TrackSpline->UpdateSpline();
+	UpdateSpline();
 
 	ASYNC_LOG(Log, "ReadSplineFromDataAsset: Loaded %d points from DataAsset.", SplinePointList->PointList.Num());
 }
@@ -649,7 +691,7 @@ void ASplineGeneratingActor::CalculateSegmentsAndSetArray()
 		TrackSpline->SetSplinePointType(i, SplinePointType, false);
 	}
 
-	TrackSpline->UpdateSpline();
+	UpdateSpline();
 }
 
 // ============================================================================
@@ -700,23 +742,38 @@ void ASplineGeneratingActor::AddRoadAndExtraMeshesToSpline()
 		0.f, 0.f,
 		bSnapMeshesToLandscape ? (SplineZOffset + SplineZOffsetLandscapeSnapCorrection) : SplineZOffset));
 
-	for (int32 SegmentIndex = 0; SegmentIndex < SplineSegments; ++SegmentIndex)
+	for (const int32 SegmentIndex : SegmentsToBuild)
+	{
+		BuildSegment(SegmentIndex);
+	}
+
+	bDeformLandscape = false;
+}
+
+void ASplineGeneratingActor::BuildSegment(int32 SegmentIndex)
+{
+	BuildSplineMeshComponents(SegmentIndex);
+
+	// Road pieces come first, extra meshes follow (the geometry cache restores them differently)
+	if (GeneratedSegments.IsValidIndex(SegmentIndex))
 	{
-		BuildSplineMeshComponents(SegmentIndex);
+		GeneratedSegments[SegmentIndex].NumRoadMeshes = GeneratedSegments[SegmentIndex].Meshes.Num();
+	}
 
-		const int32 DataIndex = (TrackSplineData.IsValidIndex(SegmentIndex) ? SegmentIndex : 0);
+	const int32 DataIndex = (TrackSplineData.IsValidIndex(SegmentIndex) ? SegmentIndex : 0);
 
-		if (TrackSplineData.IsValidIndex(DataIndex) && TrackSplineData[DataIndex].ExtraMesh.Num() > 0)
+	if (TrackSplineData.IsValidIndex(DataIndex) && TrackSplineData[DataIndex].ExtraMesh.Num() > 0)
+	{
+		for (int32 MeshIndex = 0; MeshIndex < TrackSplineData[DataIndex].ExtraMesh.Num(); ++MeshIndex)
 		{
-			for (int32 MeshIndex = 0; MeshIndex < TrackSplineData[DataIndex].ExtraMesh.Num(); ++MeshIndex)
-			{
-				BuildExtraSplineMeshComponent(SegmentIndex, MeshIndex);
-			}
+			BuildExtraSplineMeshComponent(SegmentIndex, MeshIndex);
 		}
 	}
 
-	bDeformLandscape = false;
-	BuildDropCliffWalls();
+	if (GeneratedSegments.IsValidIndex(SegmentIndex))
+	{
+		GeneratedSegments[SegmentIndex].Hash = ComputeSegmentHash(SegmentIndex);
+	}
 }
 
 void ASplineGeneratingActor::BuildSplineMeshComponents(const int32 SegmentIndex)
@@ -801,7 +858,7 @@ void ASplineGeneratingActor::BuildSplineMeshComponents(const int32 SegmentIndex)
 			continue;
 		}
 
-		GeneratedSplineMeshes.Add(SplineMesh);
+		GeneratedSegments[SegmentIndex].Meshes.Add(SplineMesh);
 
 		if (RoadPhysicalMaterial)
 		{
@@ -975,8 +1032,6 @@ void ASplineGeneratingActor::BuildExtraSplineMeshComponent(const int32 SegmentIn
 			continue;
 		}
 
-		GeneratedSplineMeshes.Add(SplineMesh);
-
 		UStaticMesh* SelectedMesh = nullptr;
 
 		if (PieceIndex == 0 && Data.ExtraMeshStart.IsValidIndex(MeshIndex))
@@ -992,6 +1047,8 @@ void ASplineGeneratingActor::BuildExtraSplineMeshComponent(const int32 SegmentIn
 			continue;
 		}
 
+		GeneratedSegments[SegmentIndex].Meshes.Add(SplineMesh);
+
 		SplineMesh->SetStaticMesh(SelectedMesh);
 
 		SplineMesh->SetCollisionEnabled(
@@ -1163,7 +1220,10 @@ void ASplineGeneratingActor::SnapToLandscape()
 		}
 	}
 
-	TrackSpline->UpdateSpline();
+	UpdateSpline();
+
+	// The next build compares against the snapped points, not the ones this build started from
+	RehashBuiltSegments();
 }
 
 // ============================================================================
@@ -1179,6 +1239,7 @@ void ASplineGeneratingActor::UpdateSpline() const
 	}
 
 	TrackSpline->UpdateSpline();
+	FTrackFrameTable::MarkSplineEdited(TrackSpline);
 }
 
 float ASplineGeneratingActor::GetDivisor() const
@@ -1213,18 +1274,61 @@ void ASplineGeneratingActor::RequestBuild()
 		CancelAsyncBuild();
 	}
 
-	ClearGeneratedComponents();
+	ClearDebugText();
 	CleanData();
 
+	// Points may have been edited outside the actor (spline visualizer, details panel)
+	TrackFrameTable.Reset();
+	FTrackFrameTable::MarkSplineEdited(TrackSpline);
+
 	BuildArrayOfSplineSegments();
 	CalculateSegmentsAndSetArray();
 
 	if (SplineSegments <= 0)
 	{
+		ClearGeneratedComponents();
 		ASYNC_LOG(Warning, "RequestBuild: No spline segments found.");
 		return;
 	}
 
+	// A finalized track stays merged while its inputs are unchanged (e.g. construction after loading)
+	if (FinalizedChunks.Num() > 0)
+	{
+		if (FinalizedGeometryKey == ComputeGeometryCacheKey())
+		{
+			DebugTrackSpline();
+			BakeTrackFrameTable();
+			return;
+		}
+
+		ASYNC_LOG(Log, "Finalized track changed -> rebuilding spline meshes.");
+		ClearFinalizedChunks();
+	}
+
+	// Unchanged segments keep their components, only SegmentsToBuild is (re)built
+	PrepareIncrementalBuild();
+
+	PendingGeometryCacheKey.Reset();
+	if (bUseGeometryCache)
+	{
+		PendingGeometryCacheKey = ComputeGeometryCacheKey();
+
+		// Nothing to reuse (e.g. first build after loading the level): restore the cached result instead
+		if (SegmentsToBuild.Num() == SplineSegments && TryRestoreGeometryCache(PendingGeometryCacheKey))
+		{
+			PendingGeometryCacheKey.Reset();
+
+			SnapToLandscape();
+			UpdateSpline();
+			DebugTrackSpline();
+
+			bDeformLandscape = false;
+
+			BakeTrackFrameTable();
+			return;
+		}
+	}
+
 #if WITH_EDITOR
 	if (bUseAsyncBuild && GIsEditor)
 	{
@@ -1241,14 +1345,11 @@ void ASplineGeneratingActor::RequestBuild()
 		UpdateSpline();
 		DebugTrackSpline();
 
-		if (bGenerateGroundWalls)
-		{
-			BuildGroundWalls();
-		}
-		else
-		{
-			ClearGroundWalls();
-		}
+		BuildWallsIfDirty();
+
+		BakeTrackFrameTable();
+
+		SaveGeometryCache();
 	}
 }
 
@@ -1268,40 +1369,130 @@ void ASplineGeneratingActor::StartBuild_Internal()
 	bIsBuilding = true;
 	CurrentBuildSegmentIndex = 0;
 
-	ASYNC_LOG(Log, "Async build started (%d segments).", SplineSegments);
+	TotalWorkUnits = 0;
+	DoneWorkUnits = 0;
+	for (const int32 SegmentIndex : SegmentsToBuild)
+	{
+		TotalWorkUnits += GetSegmentWorkUnits(SegmentIndex);
+	}
+
+	bHasPriorityCamera = false;
+	UpdateBuildProgress();
+
+	ASYNC_LOG(Log, "Async build started (%d of %d segments, ETA %.1f s).", SegmentsToBuild.Num(), SplineSegments, BuildEtaSeconds);
 }
 
-void ASplineGeneratingActor::BuildNextSegments(int32 NumSegments)
+void ASplineGeneratingActor::BuildNextSegmentsWithinBudget(double BudgetMs)
 {
+	const double StartTime = FPlatformTime::Seconds();
 	int32 Processed = 0;
 
-	while (CurrentBuildSegmentIndex < SplineSegments && Processed < NumSegments)
+	if (bPrioritizeNearCamera)
 	{
-		const int32 Index = CurrentBuildSegmentIndex;
-
-		BuildSplineMeshComponents(Index);
+		SortBuildQueueByCamera();
+	}
 
-		const int32 DataIndex = TrackSplineData.IsValidIndex(Index) ? Index : 0;
+	while (CurrentBuildSegmentIndex < SegmentsToBuild.Num())
+	{
+		const int32 SegmentIndex = SegmentsToBuild[CurrentBuildSegmentIndex];
+		const int32 Units = GetSegmentWorkUnits(SegmentIndex);
 
-		if (TrackSplineData.IsValidIndex(DataIndex) &&
-			TrackSplineData[DataIndex].ExtraMesh.Num() > 0)
+		// Stop before an item predicted to overrun the slice (always make progress)
+		const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		if (Processed > 0 && ElapsedMs + Units * AvgMsPerWorkUnit > BudgetMs)
 		{
-			for (int32 j = 0; j < TrackSplineData[DataIndex].ExtraMesh.Num(); j++)
-			{
-				BuildExtraSplineMeshComponent(Index, j);
-			}
+			break;
 		}
 
+		const double ItemStartTime = FPlatformTime::Seconds();
+		BuildSegment(SegmentIndex);
+		const double ItemMs = (FPlatformTime::Seconds() - ItemStartTime) * 1000.0;
+
+		AvgMsPerWorkUnit = FMath::Lerp(AvgMsPerWorkUnit, ItemMs / Units, 0.2);
+
+		DoneWorkUnits += Units;
 		++CurrentBuildSegmentIndex;
 		++Processed;
 	}
 
-	if (CurrentBuildSegmentIndex >= SplineSegments)
+	UpdateBuildProgress();
+
+	// Snapping, walls and frame table get a tick of their own
+	if (CurrentBuildSegmentIndex >= SegmentsToBuild.Num() && Processed == 0)
 	{
 		FinishBuild_Internal();
 	}
 }
 
+int32 ASplineGeneratingActor::GetSegmentWorkUnits(int32 SegmentIndex) const
+{
+	const int32 DataIndex = TrackSplineData.IsValidIndex(SegmentIndex) ? SegmentIndex : 0;
+	return 1 + (TrackSplineData.IsValidIndex(DataIndex) ? TrackSplineData[DataIndex].ExtraMesh.Num() : 0);
+}
+
+void ASplineGeneratingActor::SortBuildQueueByCamera()
+{
+#if WITH_EDITOR
+	if (!TrackSpline || !GCurrentLevelEditingViewportClient)
+	{
+		return;
+	}
+
+	const int32 NumRemaining = SegmentsToBuild.Num() - CurrentBuildSegmentIndex;
+	if (NumRemaining < 2)
+	{
+		return;
+	}
+
+	// Re-sort only when the camera moved noticeably
+	const FVector CameraLocation = GCurrentLevelEditingViewportClient->GetViewLocation();
+	if (bHasPriorityCamera && FVector::DistSquared(CameraLocation, LastPriorityCameraLocation) < FMath::Square(2000.f))
+	{
+		return;
+	}
+
+	LastPriorityCameraLocation = CameraLocation;
+	bHasPriorityCamera = true;
+
+	TArray<TPair<float, int32>> Keyed;
+	Keyed.Reserve(NumRemaining);
+
+	for (int32 i = CurrentBuildSegmentIndex; i < SegmentsToBuild.Num(); ++i)
+	{
+		const int32 SegmentIndex = SegmentsToBuild[i];
+		const float MidDistance =
+			TrackSpline->GetDistanceAlongSplineAtSplinePoint(SegmentIndex) + 0.5f * CalculateSplineSegmentLength(SegmentIndex);
+		const FVector Mid = TrackSpline->GetLocationAtDistanceAlongSpline(MidDistance, ESplineCoordinateSpace::World);
+
+		Keyed.Emplace(FVector::DistSquared(Mid, CameraLocation), SegmentIndex);
+	}
+
+	Keyed.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+
+	for (int32 i = 0; i < Keyed.Num(); ++i)
+	{
+		SegmentsToBuild[CurrentBuildSegmentIndex + i] = Keyed[i].Value;
+	}
+#endif
+}
+
+void ASplineGeneratingActor::UpdateBuildProgress()
+{
+	if (!bIsBuilding || TotalWorkUnits <= 0)
+	{
+		BuildProgress = 1.f;
+		BuildEtaSeconds = 0.f;
+		return;
+	}
+
+	BuildProgress = FMath::Clamp((float)DoneWorkUnits / (float)TotalWorkUnits, 0.f, 1.f);
+
+	// Remaining work in slices of BuildBudgetMs, one slice per editor tick
+	const double RemainingMs = (TotalWorkUnits - DoneWorkUnits) * AvgMsPerWorkUnit;
+	const double RemainingTicks = FMath::CeilToDouble(RemainingMs / FMath::Max(0.5, (double)BuildBudgetMs)) + 1.0; // + finish tick
+	BuildEtaSeconds = (float)(RemainingTicks * AvgTickSeconds);
+}
+
 void ASplineGeneratingActor::FinishBuild_Internal()
 {
 	bIsBuilding = false;
@@ -1312,16 +1503,12 @@ void ASplineGeneratingActor::FinishBuild_Internal()
 
 	bDeformLandscape = false;
 
-	if (bGenerateGroundWalls)
-	{
-		BuildGroundWalls();
-	}
-	else
-	{
-		ClearGroundWalls();
-	}
+	BuildWallsIfDirty();
 
-	BuildDropCliffWalls();
+	// Spline is final now (snapped / updated)
+	BakeTrackFrameTable();
+
+	SaveGeometryCache();
 
 	if (!bPendingRebuild)
 	{
@@ -1332,436 +1519,2229 @@ void ASplineGeneratingActor::FinishBuild_Internal()
 }
 
 // ============================================================================
-// Cleanup
+// Incremental Rebuild
 // ============================================================================
 
-void ASplineGeneratingActor::ClearGeneratedMeshes()
+template <typename T>
+static uint32 HashPod(uint32 Crc, const T& Value)
 {
-	for (USplineMeshComponent* Comp : GeneratedSplineMeshes)
-	{
-		if (IsValid(Comp))
-			Comp->DestroyComponent();
-	}
-	GeneratedSplineMeshes.Empty();
+	return FCrc::MemCrc32(&Value, sizeof(T), Crc);
+}
 
-	for (UProceduralMeshComponent* Comp : GeneratedDropWalls)
-	{
-		if (IsValid(Comp))
-			Comp->DestroyComponent();
-	}
-	GeneratedDropWalls.Empty();
+/** Assets / actors by path, stable across editor sessions (the geometry cache key outlives pointers) */
+static uint32 HashObject(uint32 Crc, const UObject* Object)
+{
+	return Object ? FCrc::StrCrc32(*Object->GetPathName(), Crc) : HashPod(Crc, 0u);
 }
 
-void ASplineGeneratingActor::ClearDebugText()
+static uint32 HashTransform(uint32 Crc, const FTransform& Transform)
 {
-	for (UTextRenderComponent* Comp : GeneratedDebugText)
+	Crc = HashPod(Crc, Transform.GetLocation());
+	Crc = HashPod(Crc, Transform.GetRotation());
+	return HashPod(Crc, Transform.GetScale3D());
+}
+
+uint32 ASplineGeneratingActor::ComputeSettingsHash() const
+{
+	uint32 Crc = 0;
+
+	Crc = HashTransform(Crc, GetActorTransform());
+	Crc = HashPod(Crc, SplineZOffset);
+	Crc = HashPod(Crc, SplineZOffsetLandscapeSnapCorrection);
+
+	Crc = HashObject(Crc, MainMesh.Get());
+	Crc = HashObject(Crc, StartMesh.Get());
+	Crc = HashObject(Crc, EndMesh.Get());
+	Crc = HashObject(Crc, RoadPhysicalMaterial.Get());
+
+	Crc = HashPod(Crc, bClosedLoop);
+	Crc = HashPod(Crc, bEnableCollision);
+	Crc = HashPod(Crc, bCastShadow);
+	Crc = HashPod(Crc, bCastContactShadow);
+	Crc = HashPod(Crc, bMirrorMesh);
+	Crc = HashPod(Crc, bMirrorExtraMesh);
+	Crc = HashPod(Crc, bSnapMeshesToLandscape);
+
+	// Snap traces only matter while snapping
+	if (bSnapMeshesToLandscape)
 	{
-		if (IsValid(Comp))
-			Comp->DestroyComponent();
+		Crc = HashPod(Crc, bSnapTraceLandscapeOnly);
+		Crc = HashPod(Crc, LineTraceLength);
+
+		for (const TEnumAsByte<EObjectTypeQuery>& ObjectType : ObjectsToHitForLandscapeLineTrace)
+		{
+			Crc = HashPod(Crc, ObjectType.GetValue());
+		}
+		for (const TObjectPtr<AActor>& Actor : ActorsToIgnoreForGenerationTraces)
+		{
+			Crc = HashObject(Crc, Actor.Get());
+		}
 	}
-	GeneratedDebugText.Empty();
+
+	return Crc;
 }
 
-void ASplineGeneratingActor::ClearGroundWalls()
+uint32 ASplineGeneratingActor::ComputeWallsHash() const
 {
-	if (IsValid(LeftGroundWall))
+	uint32 Crc = 0;
+
+	Crc = HashTransform(Crc, GetActorTransform());
+	Crc = HashPod(Crc, bEnableCollision);
+
+	Crc = HashPod(Crc, bGenerateGroundWalls);
+	Crc = HashPod(Crc, GroundWallSubdivisions);
+	Crc = HashPod(Crc, GroundWallSegmentsPerSection);
+	Crc = HashPod(Crc, GroundWallOutset);
+	Crc = HashPod(Crc, GroundWallFallbackDepth);
+	Crc = HashPod(Crc, bGroundWallsDoubleSided);
+	Crc = HashObject(Crc, GroundWallMaterial.Get());
+	Crc = HashPod(Crc, GroundWallLineTraceEndWorldZ);
+	Crc = HashPod(Crc, GroundWallUVWorldSizeU);
+	Crc = HashPod(Crc, GroundWallUVWorldSizeV);
+	Crc = HashPod(Crc, GroundWallUVWorldUnitsU);
+	Crc = HashPod(Crc, GroundWallUVWorldUnitsV);
+
+	for (const TEnumAsByte<EObjectTypeQuery>& ObjectType : GroundWallObjectsToHitForLineTrace)
 	{
-		LeftGroundWall->DestroyComponent();
-		LeftGroundWall = nullptr;
+		Crc = HashPod(Crc, ObjectType.GetValue());
 	}
-	if (IsValid(RightGroundWall))
+	for (const TObjectPtr<AActor>& Actor : ActorsToIgnoreForGenerationTraces)
 	{
-		RightGroundWall->DestroyComponent();
-		RightGroundWall = nullptr;
+		Crc = HashObject(Crc, Actor.Get());
 	}
-}
 
-void ASplineGeneratingActor::ClearGeneratedComponents()
-{
-	ClearGeneratedMeshes();
-	ClearDebugText();
-	ClearGroundWalls();
-}
+	Crc = HashObject(Crc, DropWallMaterial.Get());
+	Crc = HashPod(Crc, DropWallUVWorldSizeU);
+	Crc = HashPod(Crc, DropWallUVWorldSizeV);
+	Crc = HashPod(Crc, DropWallUVWorldUnitsU);
+	Crc = HashPod(Crc, DropWallUVWorldUnitsV);
 
-// ============================================================================
-// Ground Walls (with separate trace settings + UV height scaling)
-// ============================================================================
+	return Crc;
+}
 
-float ASplineGeneratingActor::GetHalfRoadWidthAtDistance(float DistanceAlongSpline) const
+uint32 ASplineGeneratingActor::ComputeSegmentHash(int32 SegmentIndex) const
 {
-	if (!TrackSpline || !MainMesh)
+	const int32 NumPoints = TrackSpline ? TrackSpline->GetNumberOfSplinePoints() : 0;
+	if (NumPoints < 2)
 	{
-		return 0.f;
+		return 0;
 	}
 
-	const float ScaleY = TrackSpline->GetScaleAtDistanceAlongSpline(DistanceAlongSpline).Y;
-	const float MeshHalfWidth = MainMesh->GetBounds().BoxExtent.Y;
-	return ScaleY * MeshHalfWidth;
-}
+	uint32 Crc = 0;
 
-void ASplineGeneratingActor::BuildGroundWalls()
-{
-	if (!TrackSpline || !MainMesh)
+	// Start / end mesh selection
+	Crc = HashPod(Crc, SegmentIndex == 0);
+	Crc = HashPod(Crc, !bClosedLoop && SegmentIndex == SplineSegments - 1);
+
+	// Segment shape: its two points plus one neighbour per side (auto tangents, tangent continuity)
+	for (int32 Offset = -1; Offset <= 2; ++Offset)
 	{
-		ASYNC_LOG(Warning, "BuildGroundWalls: missing TrackSpline or MainMesh.");
-		return;
+		const int32 PointIndex = bClosedLoop
+			? WrapPointIndex(SegmentIndex + Offset, NumPoints)
+			: FMath::Clamp(SegmentIndex + Offset, 0, NumPoints - 1);
+
+		const FSplinePoint Point = MakeSplinePointLocal(PointIndex);
+		Crc = HashPod(Crc, Point.Position);
+		Crc = HashPod(Crc, Point.ArriveTangent);
+		Crc = HashPod(Crc, Point.LeaveTangent);
+		Crc = HashPod(Crc, Point.Rotation);
+		Crc = HashPod(Crc, Point.Scale);
+		Crc = HashPod(Crc, Point.Type);
 	}
 
-	GroundWallSubdivisions = FMath::Max(4, GroundWallSubdivisions);
+	// Segment data (same fallback as the builders)
+	const int32 DataIndex = TrackSplineData.IsValidIndex(SegmentIndex) ? SegmentIndex : 0;
+	if (TrackSplineData.IsValidIndex(DataIndex))
+	{
+		const FTrackSplineData& Data = TrackSplineData[DataIndex];
+
+		Crc = HashPod(Crc, Data.MeshInstances);
+		Crc = HashPod(Crc, Data.RoadMeshLength);
+
+		for (const TObjectPtr<UStaticMesh>& Mesh : Data.ExtraMeshStart) Crc = HashObject(Crc, Mesh.Get());
+		Crc = HashPod(Crc, Data.ExtraMeshStart.Num());
+		for (const TObjectPtr<UStaticMesh>& Mesh : Data.ExtraMesh) Crc = HashObject(Crc, Mesh.Get());
+		Crc = HashPod(Crc, Data.ExtraMesh.Num());
+		for (const TObjectPtr<UStaticMesh>& Mesh : Data.ExtraMeshEnd) Crc = HashObject(Crc, Mesh.Get());
+		Crc = HashPod(Crc, Data.ExtraMeshEnd.Num());
+		for (const float Offset : Data.ExtraMeshOffset) Crc = HashPod(Crc, Offset);
+	}
+
+	// Gaps / drops
+	Crc = HashPod(Crc, IsSegmentInsideJumpGapByPoints(SegmentIndex));
 
-	BuildSingleGroundWall(-1, LeftGroundWall);
-	BuildSingleGroundWall(+1, RightGroundWall);
+	float DropOffset = 0.f;
+	bool  bUseConst = false;
+	float ConstWorldZ = 0.f;
+	Crc = HashPod(Crc, GetDropInfoForSegmentByPoints(SegmentIndex, DropOffset, bUseConst, ConstWorldZ));
+	Crc = HashPod(Crc, DropOffset);
+	Crc = HashPod(Crc, bUseConst);
+	Crc = HashPod(Crc, ConstWorldZ);
+
+	// 0 marks "not built"
+	return Crc ? Crc : 1u;
 }
 
-void ASplineGeneratingActor::BuildSingleGroundWall(int32 SideSign, TObjectPtr<UProceduralMeshComponent>& OutComp)
+void ASplineGeneratingActor::RehashBuiltSegments()
 {
-	if (!TrackSpline)
+	for (int32 SegmentIndex = 0; SegmentIndex < GeneratedSegments.Num(); ++SegmentIndex)
 	{
-		ASYNC_LOG(Error, "BuildSingleGroundWall: TrackSpline == NULL");
-		return;
+		if (GeneratedSegments[SegmentIndex].Hash != 0)
+		{
+			GeneratedSegments[SegmentIndex].Hash = ComputeSegmentHash(SegmentIndex);
+		}
 	}
+}
+
+void ASplineGeneratingActor::PrepareIncrementalBuild()
+{
+	const double StartTime = FPlatformTime::Seconds();
 
-	if (!OutComp)
+	const uint32 SettingsHash = ComputeSettingsHash();
+	const bool bFullRebuild = !bIncrementalRebuild || SettingsHash != GeneratedSettingsHash;
+
+	TArray<FGeneratedTrackSegment> OldSegments = MoveTemp(GeneratedSegments);
+	GeneratedSegments.Reset();
+	GeneratedSegments.SetNum(SplineSegments);
+
+	// Built segments by hash: a segment that only moved index (point inserted / removed) keeps its components
+	TMap<uint32, int32> OldByHash;
+	if (!bFullRebuild)
 	{
-		OutComp = CreateProcMeshComponent(SideSign < 0 ? TEXT("LeftGroundWall") : TEXT("RightGroundWall"));
-		if (!OutComp)
+		for (int32 i = 0; i < OldSegments.Num(); ++i)
 		{
-			ASYNC_LOG(Error, "BuildSingleGroundWall: could not create ProceduralMeshComponent.");
-			return;
+			const FGeneratedTrackSegment& Old = OldSegments[i];
+
+			const bool bComponentsValid = !Old.Meshes.ContainsByPredicate(
+				[](const TObjectPtr<USplineMeshComponent>& Comp) { return !IsValid(Comp); });
+
+			if (Old.Hash != 0 && bComponentsValid && !OldByHash.Contains(Old.Hash))
+			{
+				OldByHash.Add(Old.Hash, i);
+			}
 		}
+	}
 
-		OutComp->SetCollisionEnabled(
-			bEnableCollision ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
+	SegmentsToBuild.Reset();
+
+	// Wall segments still pending from an interrupted build are indexed for the old spline
+	const bool bWallsPending = DirtyWallSegments.Find(true) != INDEX_NONE;
+	DirtyWallSegments.Init(false, SplineSegments);
 
-		if (GroundWallMaterial)
+	for (int32 SegmentIndex = 0; SegmentIndex < SplineSegments; ++SegmentIndex)
+	{
+		int32 OldIndex = INDEX_NONE;
+		if (!bFullRebuild && OldByHash.RemoveAndCopyValue(ComputeSegmentHash(SegmentIndex), OldIndex))
 		{
-			OutComp->SetMaterial(0, GroundWallMaterial);
+			GeneratedSegments[SegmentIndex] = MoveTemp(OldSegments[OldIndex]);
+
+			// Wall sections and drop walls are indexed by segment: a moved segment needs its walls at the new index
+			DirtyWallSegments[SegmentIndex] = (OldIndex != SegmentIndex);
+			continue;
 		}
 
-		OutComp->SetCanEverAffectNavigation(false);
+		SegmentsToBuild.Add(SegmentIndex);
+		DirtyWallSegments[SegmentIndex] = true;
 	}
 
-	if (GroundWallSubdivisions < 2)
+	// Whatever was not reused is stale
+	for (FGeneratedTrackSegment& Old : OldSegments)
 	{
-		ASYNC_LOG(Warning, "GroundWallSubdivisions < 2 -> skipping wall build.");
-		return;
+		DestroySegmentMeshes(Old);
 	}
-	OutComp->ClearAllMeshSections();
 
-	TArray<FVector>          Vertices;
+	GeneratedSettingsHash = SettingsHash;
+
+	// Walls follow the segments: only the wall sections / drop walls of DirtyWallSegments are rebuilt.
+	// Wall setting changes, missing ground walls and walls pending from an interrupted build rebuild all of them
+	// (bWallsDirty is cleared only once walls are committed).
+	PendingWallsHash = ComputeWallsHash();
+	bWallsDirty = bWallsDirty
+		|| bFullRebuild
+		|| bWallsPending
+		|| PendingWallsHash != GeneratedWallsHash
+		|| (bGenerateGroundWalls && (!IsValid(LeftGroundWall) || !IsValid(RightGroundWall)));
+
+	ASYNC_LOG(Log, "Rebuild prepared: %d of %d segments dirty%s, walls of %d segments dirty (%.2f ms).",
+		SegmentsToBuild.Num(),
+		SplineSegments,
+		bFullRebuild ? TEXT(" (full)") : TEXT(""),
+		bWallsDirty ? SplineSegments : DirtyWallSegments.CountSetBits(),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void ASplineGeneratingActor::BuildWallsIfDirty()
+{
+	if (!bWallsDirty && DirtyWallSegments.Find(true) == INDEX_NONE)
+	{
+		return;
+	}
+
+	TBitArray<> DirtySegments = bWallsDirty ? TBitArray<>(true, SplineSegments) : DirtyWallSegments;
+	DirtySegments.SetNum(SplineSegments, false);
+
+	if (bGenerateGroundWalls)
+	{
+		BuildGroundWalls(DirtySegments);
+	}
+	else
+	{
+		ClearGroundWalls();
+	}
+
+	BuildDropCliffWalls(DirtySegments);
+
+	GeneratedWallsHash = PendingWallsHash;
+	bWallsDirty = false;
+	DirtyWallSegments.Reset();
+}
+
+// ============================================================================
+// Geometry Cache
+// ============================================================================
+
+// Finished builds are stored under a hash of all their inputs (see ComputeGeometryCacheKey):
+// spline mesh parameters per segment and the procedural wall sections. A build whose segments
+// are all dirty (first build after loading, full rebuild) restores a matching entry instead of
+// tracing and generating again.
+
+static constexpr uint32 GeometryCacheMagic = 0x31434754; // "TGC1"
+static constexpr uint32 GeometryCacheVersion = 3;
+
+/** One spline mesh component: asset + deform parameters (TrackSpline local) */
+struct FCachedSplineMesh
+{
+	FString MeshPath;
+	bool bRoad = true;
+	uint8 CollisionEnabled = 0;
+
+	FVector StartPos = FVector::ZeroVector;
+	FVector StartTangent = FVector::ZeroVector;
+	FVector EndPos = FVector::ZeroVector;
+	FVector EndTangent = FVector::ZeroVector;
+
+	FVector2D StartScale = FVector2D::UnitVector;
+	FVector2D EndScale = FVector2D::UnitVector;
+	FVector2D StartOffset = FVector2D::ZeroVector;
+	FVector2D EndOffset = FVector2D::ZeroVector;
+
+	float StartRoll = 0.f;
+	float EndRoll = 0.f;
+};
+
+/** One procedural mesh section */
+struct FCachedMeshSection
+{
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector> Normals;
+	TArray<FVector2D> UVs;
+	TArray<FColor> Colors;
+	TArray<FVector> TangentsX;
+	TArray<bool> TangentsFlipY;
+	bool bCollision = false;
+};
+
+struct FCachedProcMesh
+{
+	TArray<FCachedMeshSection> Sections;
+};
+
+struct FTrackGeometryCacheData
+{
+	TArray<uint32> SegmentHashes;
+	TArray<TArray<FCachedSplineMesh>> SegmentMeshes;
+
+	bool bHasGroundWalls = false;
+	FCachedProcMesh LeftGroundWall;
+	FCachedProcMesh RightGroundWall;
+
+	/** One per segment, no sections where the segment has no drop wall */
+	TArray<FCachedProcMesh> DropWalls;
+};
+
+static FArchive& operator<<(FArchive& Ar, FCachedSplineMesh& Mesh)
+{
+	Ar << Mesh.MeshPath << Mesh.bRoad << Mesh.CollisionEnabled;
+	Ar << Mesh.StartPos << Mesh.StartTangent << Mesh.EndPos << Mesh.EndTangent;
+	Ar << Mesh.StartScale << Mesh.EndScale << Mesh.StartOffset << Mesh.EndOffset;
+	Ar << Mesh.StartRoll << Mesh.EndRoll;
+	return Ar;
+}
+
+static FArchive& operator<<(FArchive& Ar, FCachedMeshSection& Section)
+{
+	Ar << Section.Vertices << Section.Triangles << Section.Normals << Section.UVs << Section.Colors;
+	Ar << Section.TangentsX << Section.TangentsFlipY << Section.bCollision;
+	return Ar;
+}
+
+static FArchive& operator<<(FArchive& Ar, FCachedProcMesh& ProcMesh)
+{
+	return Ar << ProcMesh.Sections;
+}
+
+static FArchive& operator<<(FArchive& Ar, FTrackGeometryCacheData& Data)
+{
+	Ar << Data.SegmentHashes << Data.SegmentMeshes;
+	Ar << Data.bHasGroundWalls << Data.LeftGroundWall << Data.RightGroundWall;
+	Ar << Data.DropWalls;
+	return Ar;
+}
+
+static void CaptureProcMesh(UProceduralMeshComponent* Comp, FCachedProcMesh& Out)
+{
+	const int32 NumSections = Comp->GetNumSections();
+	Out.Sections.SetNum(NumSections);
+
+	for (int32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+	{
+		const FProcMeshSection* Section = Comp->GetProcMeshSection(SectionIndex);
+		if (!Section)
+		{
+			continue;
+		}
+
+		FCachedMeshSection& Cached = Out.Sections[SectionIndex];
+		Cached.bCollision = Section->bEnableCollision;
+
+		const int32 NumVerts = Section->ProcVertexBuffer.Num();
+		Cached.Vertices.Reserve(NumVerts);
+		Cached.Normals.Reserve(NumVerts);
+		Cached.UVs.Reserve(NumVerts);
+		Cached.Colors.Reserve(NumVerts);
+		Cached.TangentsX.Reserve(NumVerts);
+		Cached.TangentsFlipY.Reserve(NumVerts);
+
+		for (const FProcMeshVertex& Vertex : Section->ProcVertexBuffer)
+		{
+			Cached.Vertices.Add(Vertex.Position);
+			Cached.Normals.Add(Vertex.Normal);
+			Cached.UVs.Add(Vertex.UV0);
+			Cached.Colors.Add(Vertex.Color);
+			Cached.TangentsX.Add(Vertex.Tangent.TangentX);
+			Cached.TangentsFlipY.Add(Vertex.Tangent.bFlipTangentY);
+		}
+
+		Cached.Triangles.Reserve(Section->ProcIndexBuffer.Num());
+		for (const uint32 Index : Section->ProcIndexBuffer)
+		{
+			Cached.Triangles.Add((int32)Index);
+		}
+	}
+}
+
+static void RestoreProcMesh(UProceduralMeshComponent* Comp, const FCachedProcMesh& Cached, UMaterialInterface* Material)
+{
+	Comp->ClearAllMeshSections();
+
+	for (int32 SectionIndex = 0; SectionIndex < Cached.Sections.Num(); ++SectionIndex)
+	{
+		const FCachedMeshSection& Section = Cached.Sections[SectionIndex];
+
+		TArray<FProcMeshTangent> Tangents;
+		Tangents.Reserve(Section.TangentsX.Num());
+		for (int32 i = 0; i < Section.TangentsX.Num(); ++i)
+		{
+			Tangents.Add(FProcMeshTangent(Section.TangentsX[i], Section.TangentsFlipY.IsValidIndex(i) && Section.TangentsFlipY[i]));
+		}
+
+		Comp->CreateMeshSection(
+			SectionIndex,
+			Section.Vertices,
+			Section.Triangles,
+			Section.Normals,
+			Section.UVs,
+			Section.Colors,
+			Tangents,
+			Section.bCollision
+		);
+
+		if (Material)
+		{
+			Comp->SetMaterial(SectionIndex, Material);
+		}
+	}
+}
+
+FString ASplineGeneratingActor::GetGeometryCacheDir()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AsyncSplineBuilder"), TEXT("GeometryCache"));
+}
+
+static uint32 HashMeshBounds(uint32 Crc, const UStaticMesh* Mesh)
+{
+	return Mesh ? HashPod(Crc, Mesh->GetBounds()) : HashPod(Crc, 0u);
+}
+
+FString ASplineGeneratingActor::ComputeGeometryCacheKey() const
+{
+	TArray<uint32> Words;
+	Words.Reserve(SplineSegments + 6);
+
+	Words.Add(GeometryCacheVersion);
+	Words.Add(ComputeSettingsHash());
+	Words.Add(ComputeWallsHash());
+	Words.Add((uint32)SplineSegments);
+
+	// Piece count, wall width and the deformed extras follow the mesh bounds (a reimport keeps the asset path)
+	uint32 BoundsCrc = HashMeshBounds(0u, StartMesh.Get());
+	BoundsCrc = HashMeshBounds(BoundsCrc, MainMesh.Get());
+	BoundsCrc = HashMeshBounds(BoundsCrc, EndMesh.Get());
+
+	for (const FTrackSplineData& Data : TrackSplineData)
+	{
+		for (const TObjectPtr<UStaticMesh>& Mesh : Data.ExtraMeshStart) BoundsCrc = HashMeshBounds(BoundsCrc, Mesh.Get());
+		for (const TObjectPtr<UStaticMesh>& Mesh : Data.ExtraMesh) BoundsCrc = HashMeshBounds(BoundsCrc, Mesh.Get());
+		for (const TObjectPtr<UStaticMesh>& Mesh : Data.ExtraMeshEnd) BoundsCrc = HashMeshBounds(BoundsCrc, Mesh.Get());
+	}
+	Words.Add(BoundsCrc);
+
+	for (int32 SegmentIndex = 0; SegmentIndex < SplineSegments; ++SegmentIndex)
+	{
+		Words.Add(ComputeSegmentHash(SegmentIndex));
+	}
+
+	FSHAHash Hash;
+	FSHA1::HashBuffer(Words.GetData(), Words.Num() * sizeof(uint32), Hash.Hash);
+	return Hash.ToString();
+}
+
+bool ASplineGeneratingActor::TryRestoreGeometryCache(const FString& Key)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	const FString Path = FPaths::Combine(GetGeometryCacheDir(), Key + TEXT(".tgc"));
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	Reader << Magic << Version;
+
+	if (Magic != GeometryCacheMagic || Version != GeometryCacheVersion)
+	{
+		ASYNC_LOG(Warning, "Geometry cache %s has an unknown format -> ignored.", *Key);
+		return false;
+	}
+
+	FTrackGeometryCacheData Data;
+	Reader << Data;
+
+	if (Reader.IsError() || Data.SegmentHashes.Num() != SplineSegments || Data.SegmentMeshes.Num() != SplineSegments)
+	{
+		ASYNC_LOG(Warning, "Geometry cache %s is corrupt -> ignored.", *Key);
+		return false;
+	}
+
+	// Guard against key collisions and resolve all assets before touching any component
+	TMap<FString, UStaticMesh*> Meshes;
+
+	for (int32 SegmentIndex = 0; SegmentIndex < SplineSegments; ++SegmentIndex)
+	{
+		if (Data.SegmentHashes[SegmentIndex] != ComputeSegmentHash(SegmentIndex))
+		{
+			ASYNC_LOG(Warning, "Geometry cache %s does not match segment %d -> ignored.", *Key, SegmentIndex);
+			return false;
+		}
+
+		for (const FCachedSplineMesh& Cached : Data.SegmentMeshes[SegmentIndex])
+		{
+			if (Meshes.Contains(Cached.MeshPath))
+			{
+				continue;
+			}
+
+			UStaticMesh* Mesh = Cast<UStaticMesh>(FSoftObjectPath(Cached.MeshPath).TryLoad());
+			if (!Mesh)
+			{
+				ASYNC_LOG(Warning, "Geometry cache %s references missing mesh %s -> ignored.", *Key, *Cached.MeshPath);
+				return false;
+			}
+
+			Meshes.Add(Cached.MeshPath, Mesh);
+		}
+	}
+
+	TrackSpline->SetRelativeLocation(FVector(
+		0.f, 0.f,
+		bSnapMeshesToLandscape ? (SplineZOffset + SplineZOffsetLandscapeSnapCorrection) : SplineZOffset));
+
+	// Spline meshes (same component setup as the builders)
+	int32 NumComponents = 0;
+
+	for (int32 SegmentIndex = 0; SegmentIndex < SplineSegments; ++SegmentIndex)
+	{
+		FGeneratedTrackSegment& Segment = GeneratedSegments[SegmentIndex];
+		DestroySegmentMeshes(Segment);
+
+		for (const FCachedSplineMesh& Cached : Data.SegmentMeshes[SegmentIndex])
+		{
+			USplineMeshComponent* SplineMesh = CreateSplineMeshComponent();
+			if (!SplineMesh)
+			{
+				continue;
+			}
+
+			Segment.Meshes.Add(SplineMesh);
+			Segment.NumRoadMeshes += Cached.bRoad ? 1 : 0;
+
+			if (Cached.bRoad && RoadPhysicalMaterial)
+			{
+				SplineMesh->SetPhysMaterialOverride(RoadPhysicalMaterial);
+			}
+
+			SplineMesh->SetStaticMesh(Meshes.FindChecked(Cached.MeshPath));
+			SplineMesh->SetCollisionEnabled((ECollisionEnabled::Type)Cached.CollisionEnabled);
+
+			if (Cached.bRoad)
+			{
+				SplineMesh->SetCollisionResponseToChannel(ECC_Visibility, ECR_Block);
+			}
+
+			SplineMesh->SetCastShadow(bCastShadow);
+			SplineMesh->SetCastContactShadow(bCastContactShadow);
+
+			SplineMesh->SetStartAndEnd(Cached.StartPos, Cached.StartTangent, Cached.EndPos, Cached.EndTangent, false);
+			SplineMesh->SetStartScale(Cached.StartScale, false);
+			SplineMesh->SetEndScale(Cached.EndScale, false);
+			SplineMesh->SetStartOffset(Cached.StartOffset, false);
+			SplineMesh->SetEndOffset(Cached.EndOffset, false);
+			SplineMesh->SetStartRoll(Cached.StartRoll, false);
+			SplineMesh->SetEndRoll(Cached.EndRoll, false);
+			SplineMesh->UpdateMesh();
+
+			++NumComponents;
+		}
+
+		Segment.Hash = Data.SegmentHashes[SegmentIndex];
+	}
+
+	// Walls
+	ClearGroundWalls();
+
+	if (Data.bHasGroundWalls)
+	{
+		if (UProceduralMeshComponent* Left = EnsureGroundWallComponent(-1, LeftGroundWall))
+		{
+			RestoreProcMesh(Left, Data.LeftGroundWall, GroundWallMaterial);
+		}
+		if (UProceduralMeshComponent* Right = EnsureGroundWallComponent(1, RightGroundWall))
+		{
+			RestoreProcMesh(Right, Data.RightGroundWall, GroundWallMaterial);
+		}
+	}
+
+	ClearDropWalls();
+	GeneratedDropWalls.SetNum(SplineSegments);
+
+	for (int32 SegmentIndex = 0; SegmentIndex < FMath::Min(Data.DropWalls.Num(), SplineSegments); ++SegmentIndex)
+	{
+		if (Data.DropWalls[SegmentIndex].Sections.Num() == 0)
+		{
+			continue;
+		}
+
+		if (UProceduralMeshComponent* WallComp = CreateDropWallComponent())
+		{
+			RestoreProcMesh(WallComp, Data.DropWalls[SegmentIndex], DropWallMaterial);
+			GeneratedDropWalls[SegmentIndex] = WallComp;
+		}
+	}
+
+	SegmentsToBuild.Reset();
+	GeneratedWallsHash = PendingWallsHash;
+	bWallsDirty = false;
+	DirtyWallSegments.Reset();
+
+	// Mark as recently used for the eviction in PruneGeometryCache
+	IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+
+	ASYNC_LOG(Log, "Restored track from geometry cache %s (%d spline meshes, %d drop walls, %.2f ms).",
+		*Key, NumComponents, Data.DropWalls.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return true;
+}
+
+void ASplineGeneratingActor::SaveGeometryCache()
+{
+	const bool bRequested = !PendingGeometryCacheKey.IsEmpty();
+	PendingGeometryCacheKey.Reset();
+
+	if (!bUseGeometryCache || !bRequested || GeneratedSegments.Num() != SplineSegments)
+	{
+		return;
+	}
+
+	// Keyed by the snapped spline (what the next build starts from), like the segment hashes
+	const FString Key = ComputeGeometryCacheKey();
+
+	const FString Path = FPaths::Combine(GetGeometryCacheDir(), Key + TEXT(".tgc"));
+	if (IFileManager::Get().FileExists(*Path))
+	{
+		IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+		return;
+	}
+
+	FTrackGeometryCacheData Data;
+	Data.SegmentHashes.SetNum(SplineSegments);
+	Data.SegmentMeshes.SetNum(SplineSegments);
+
+	for (int32 SegmentIndex = 0; SegmentIndex < SplineSegments; ++SegmentIndex)
+	{
+		const FGeneratedTrackSegment& Segment = GeneratedSegments[SegmentIndex];
+		Data.SegmentHashes[SegmentIndex] = Segment.Hash;
+
+		for (int32 MeshIndex = 0; MeshIndex < Segment.Meshes.Num(); ++MeshIndex)
+		{
+			const USplineMeshComponent* SplineMesh = Segment.Meshes[MeshIndex];
+			if (!IsValid(SplineMesh) || !SplineMesh->GetStaticMesh())
+			{
+				// Incomplete build, do not cache it
+				return;
+			}
+
+			const FSplineMeshParams& Params = SplineMesh->SplineParams;
+
+			FCachedSplineMesh& Cached = Data.SegmentMeshes[SegmentIndex].AddDefaulted_GetRef();
+			Cached.MeshPath = SplineMesh->GetStaticMesh()->GetPathName();
+			Cached.bRoad = MeshIndex < Segment.NumRoadMeshes;
+			Cached.CollisionEnabled = (uint8)SplineMesh->GetCollisionEnabled();
+
+			Cached.StartPos = Params.StartPos;
+			Cached.StartTangent = Params.StartTangent;
+			Cached.EndPos = Params.EndPos;
+			Cached.EndTangent = Params.EndTangent;
+			Cached.StartScale = Params.StartScale;
+			Cached.EndScale = Params.EndScale;
+			Cached.StartOffset = Params.StartOffset;
+			Cached.EndOffset = Params.EndOffset;
+			Cached.StartRoll = Params.StartRoll;
+			Cached.EndRoll = Params.EndRoll;
+		}
+	}
+
+	Data.bHasGroundWalls = IsValid(LeftGroundWall) && IsValid(RightGroundWall);
+	if (Data.bHasGroundWalls)
+	{
+		CaptureProcMesh(LeftGroundWall, Data.LeftGroundWall);
+		CaptureProcMesh(RightGroundWall, Data.RightGroundWall);
+	}
+
+	Data.DropWalls.SetNum(GeneratedDropWalls.Num());
+	for (int32 SegmentIndex = 0; SegmentIndex < GeneratedDropWalls.Num(); ++SegmentIndex)
+	{
+		if (IsValid(GeneratedDropWalls[SegmentIndex]))
+		{
+			CaptureProcMesh(GeneratedDropWalls[SegmentIndex], Data.DropWalls[SegmentIndex]);
+		}
+	}
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = GeometryCacheMagic;
+	uint32 Version = GeometryCacheVersion;
+	Writer << Magic << Version;
+	Writer << Data;
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *Path))
+	{
+		ASYNC_LOG(Warning, "Could not write geometry cache %s.", *Path);
+		return;
+	}
+
+	ASYNC_LOG(Verbose, "Geometry cache %s written (%d bytes).", *Key, Bytes.Num());
+
+	PruneGeometryCache();
+}
+
+void ASplineGeneratingActor::PruneGeometryCache() const
+{
+	if (MaxGeometryCacheEntries <= 0)
+	{
+		return;
+	}
+
+	const FString Dir = GetGeometryCacheDir();
+	IFileManager& FileManager = IFileManager::Get();
+
+	TArray<FString> Files;
+	FileManager.FindFiles(Files, *Dir, TEXT("tgc"));
+
+	if (Files.Num() <= MaxGeometryCacheEntries)
+	{
+		return;
+	}
+
+	// Least recently used first (restores and re-saves touch the timestamp)
+	TArray<TPair<FDateTime, FString>> Entries;
+	Entries.Reserve(Files.Num());
+	for (const FString& File : Files)
+	{
+		const FString Path = FPaths::Combine(Dir, File);
+		Entries.Emplace(FileManager.GetTimeStamp(*Path), Path);
+	}
+	Entries.Sort([](const TPair<FDateTime, FString>& A, const TPair<FDateTime, FString>& B) { return A.Key < B.Key; });
+
+	const int32 NumToEvict = Entries.Num() - MaxGeometryCacheEntries;
+	int32 NumEvicted = 0;
+	for (int32 i = 0; i < NumToEvict; ++i)
+	{
+		if (FileManager.Delete(*Entries[i].Value, /*RequireExists*/ false, /*EvenReadOnly*/ true, /*Quiet*/ true))
+		{
+			++NumEvicted;
+		}
+	}
+
+	ASYNC_LOG(Verbose, "Geometry cache pruned: %d of %d entries evicted (max %d).",
+		NumEvicted, Entries.Num(), MaxGeometryCacheEntries);
+}
+
+void ASplineGeneratingActor::ClearGeometryCache()
+{
+	const FString Dir = GetGeometryCacheDir();
+
+	if (IFileManager::Get().DeleteDirectory(*Dir, /*RequireExists*/ false, /*Tree*/ true))
+	{
+		ASYNC_LOG(Log, "Geometry cache cleared (%s).", *Dir);
+	}
+	else
+	{
+		ASYNC_LOG(Warning, "Could not clear geometry cache (%s).", *Dir);
+	}
+}
+
+// ============================================================================
+// Cleanup
+// ============================================================================
+
+void ASplineGeneratingActor::ClearGeneratedMeshes()
+{
+	for (FGeneratedTrackSegment& Segment : GeneratedSegments)
+	{
+		DestroySegmentMeshes(Segment);
+	}
+	GeneratedSegments.Empty();
+	SegmentsToBuild.Empty();
+	GeneratedSettingsHash = 0;
+
+	ClearDropWalls();
+	GeneratedWallsHash = 0;
+}
+
+void ASplineGeneratingActor::DestroySegmentMeshes(FGeneratedTrackSegment& Segment)
+{
+	for (USplineMeshComponent* Comp : Segment.Meshes)
+	{
+		if (IsValid(Comp))
+			Comp->DestroyComponent();
+	}
+	Segment.Meshes.Empty();
+	Segment.NumRoadMeshes = 0;
+	Segment.Hash = 0;
+}
+
+void ASplineGeneratingActor::ClearDropWalls()
+{
+	for (UProceduralMeshComponent* Comp : GeneratedDropWalls)
+	{
+		if (IsValid(Comp))
+			Comp->DestroyComponent();
+	}
+	GeneratedDropWalls.Empty();
+}
+
+void ASplineGeneratingActor::ClearDebugText()
+{
+	for (UTextRenderComponent* Comp : GeneratedDebugText)
+	{
+		if (IsValid(Comp))
+			Comp->DestroyComponent();
+	}
+	GeneratedDebugText.Empty();
+}
+
+void ASplineGeneratingActor::ClearGroundWalls()
+{
+	if (IsValid(LeftGroundWall))
+	{
+		LeftGroundWall->DestroyComponent();
+		LeftGroundWall = nullptr;
+	}
+	if (IsValid(RightGroundWall))
+	{
+		RightGroundWall->DestroyComponent();
+		RightGroundWall = nullptr;
+	}
+}
+
+void ASplineGeneratingActor::ClearGeneratedComponents()
+{
+	ClearGeneratedMeshes();
+	ClearDebugText();
+	ClearGroundWalls();
+	ClearFinalizedChunks();
+}
+
+// ============================================================================
+// Ground Walls (with separate trace settings + UV height scaling)
+// ============================================================================
+
+float ASplineGeneratingActor::GetHalfRoadWidthAtDistance(float DistanceAlongSpline) const
+{
+	if (!TrackSpline || !MainMesh)
+	{
+		return 0.f;
+	}
+
+	const float ScaleY = TrackSpline->GetScaleAtDistanceAlongSpline(DistanceAlongSpline).Y;
+	const float MeshHalfWidth = MainMesh->GetBounds().BoxExtent.Y;
+	return ScaleY * MeshHalfWidth;
+}
+
+// ----------------------------------------------------------------------------
+// Walls are generated in three passes:
+//  1) Snapshot (game thread): spline frames, drop heights and trace params as plain data
+//  2) Generation (ParallelFor): ground traces, vertex / normal / UV / tangent arrays
+//  3) Commit (game thread): procedural mesh components and sections
+// Workers only read the snapshot and run scene queries, never touch the actor.
+// ----------------------------------------------------------------------------
+
+/** One procedural mesh section, filled off the game thread */
+struct FWallMeshData
+{
+	TArray<FVector>          Vertices;
 	TArray<int32>            Triangles;
 	TArray<FVector>          Normals;
 	TArray<FVector2D>        UVs;
-	TArray<FLinearColor>     VertexColors;
+	TArray<FLinearColor>     Colors;
+	TArray<FProcMeshTangent> Tangents;
+};
+
+/** Ground wall column snapshot: top edge point (world) and spline right vector */
+struct FGroundWallColumn
+{
+	float Distance = 0.f;
+	FVector TopWorld = FVector::ZeroVector;
+	FVector Right = FVector::RightVector;
+
+	int32 MeshIndex = 0;   // 2 * dirty range + side (0 = left)
+	int32 ColumnIndex = 0; // within that mesh
+};
+
+/** Drop wall snapshot at one segment boundary */
+struct FDropWallQuad
+{
+	FVector CenterWorld = FVector::ZeroVector;
+	FVector Right = FVector::RightVector;
+	float HalfWidth = 0.f;
+	float TopZ = 0.f;
+	float BottomZ = 0.f;
+};
+
+/** Same section with flipped winding and normals */
+static void MakeBackFaceSection(const FWallMeshData& Front, FWallMeshData& OutBack)
+{
+	OutBack = Front;
+
+	for (int32 t = 0; t < OutBack.Triangles.Num(); t += 3)
+	{
+		Swap(OutBack.Triangles[t + 1], OutBack.Triangles[t + 2]);
+	}
+
+	for (FVector& N : OutBack.Normals)
+	{
+		N *= -1.f;
+	}
+}
+
+static void BuildDropWallMesh(const FDropWallQuad& Quad, const FTransform& ActorTM, float UDenom, float VDenom, FWallMeshData& OutMesh)
+{
+	const FVector TopCenterWorld(Quad.CenterWorld.X, Quad.CenterWorld.Y, Quad.TopZ);
+	const FVector BottomCenterWorld(Quad.CenterWorld.X, Quad.CenterWorld.Y, Quad.BottomZ);
+
+	const FVector TopLeftWorld = TopCenterWorld - Quad.Right * Quad.HalfWidth;
+	const FVector TopRightWorld = TopCenterWorld + Quad.Right * Quad.HalfWidth;
+	const FVector BottomLeftWorld = BottomCenterWorld - Quad.Right * Quad.HalfWidth;
+	const FVector BottomRightWorld = BottomCenterWorld + Quad.Right * Quad.HalfWidth;
+
+	const float WallHeightWorld = FMath::Max(1.f, Quad.TopZ - Quad.BottomZ);
+	const float WallWidthWorld = FMath::Max(1.f, (2.f * Quad.HalfWidth));
+
+	const float UMax = (UDenom > 1.f) ? (WallWidthWorld / UDenom) : 1.f;
+	const float VMax = (VDenom > 1.f) ? (WallHeightWorld / VDenom) : 1.f;
+
+	const FVector NormalWorld =
+		FVector::CrossProduct((BottomLeftWorld - TopLeftWorld), (TopRightWorld - TopLeftWorld)).GetSafeNormal();
+
+	const FVector NormalLocal = ActorTM.InverseTransformVectorNoScale(NormalWorld);
+	const FVector TangentLocal = ActorTM.InverseTransformVectorNoScale(Quad.Right);
+
+	OutMesh.Vertices.Add(ActorTM.InverseTransformPosition(TopLeftWorld));
+	OutMesh.Vertices.Add(ActorTM.InverseTransformPosition(TopRightWorld));
+	OutMesh.Vertices.Add(ActorTM.InverseTransformPosition(BottomRightWorld));
+	OutMesh.Vertices.Add(ActorTM.InverseTransformPosition(BottomLeftWorld));
+
+	for (int32 i = 0; i < 4; ++i)
+	{
+		OutMesh.Normals.Add(NormalLocal);
+		OutMesh.Colors.Add(FLinearColor::White);
+		OutMesh.Tangents.Add(FProcMeshTangent(TangentLocal, false));
+	}
+
+	OutMesh.UVs.Add(FVector2D(0.f, 0.f));
+	OutMesh.UVs.Add(FVector2D(UMax, 0.f));
+	OutMesh.UVs.Add(FVector2D(UMax, VMax));
+	OutMesh.UVs.Add(FVector2D(0.f, VMax));
+
+	OutMesh.Triangles = { 0, 1, 2, 0, 2, 3 };
+}
+
+static void CommitWallSection(UProceduralMeshComponent* Comp, int32 SectionIndex, const FWallMeshData& Mesh, bool bCreateCollision)
+{
+	Comp->CreateMeshSection_LinearColor(
+		SectionIndex,
+		Mesh.Vertices,
+		Mesh.Triangles,
+		Mesh.Normals,
+		Mesh.UVs,
+		Mesh.Colors,
+		Mesh.Tangents,
+		bCreateCollision,
+		false
+	);
+}
+
+void ASplineGeneratingActor::BuildGroundWalls(const TBitArray<>& DirtySegments)
+{
+	if (!TrackSpline || !MainMesh)
+	{
+		ASYNC_LOG(Warning, "BuildGroundWalls: missing TrackSpline or MainMesh.");
+		return;
+	}
+
+	GroundWallSubdivisions = FMath::Max(4, GroundWallSubdivisions);
+	GroundWallSegmentsPerSection = FMath::Max(1, GroundWallSegmentsPerSection);
+
+	UProceduralMeshComponent* WallComps[2] =
+	{
+		EnsureGroundWallComponent(-1, LeftGroundWall),
+		EnsureGroundWallComponent(+1, RightGroundWall)
+	};
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// ---------------------------------------------------------
+	// 1) Snapshot (game thread)
+	// ---------------------------------------------------------
+	// One section (front + back face) per GroundWallSegmentsPerSection segments and side, only ranges
+	// holding a dirty segment are rebuilt. Columns keep the track-wide GroundWallSubdivisions density,
+	// adjacent ranges share their boundary column.
+	const float TotalLength = TrackSpline->GetSplineLength();
+	const float TargetStep = TotalLength / (float)GroundWallSubdivisions;
+	const int32 SegmentsPerRange = GroundWallSegmentsPerSection;
+	const int32 NumRanges = FMath::DivideAndRoundUp(SplineSegments, SegmentsPerRange);
+
+	auto GetSegmentStartDistance = [this, TotalLength](int32 SegmentIndex)
+	{
+		return (SegmentIndex >= SplineSegments) ? TotalLength : TrackSpline->GetDistanceAlongSplineAtSplinePoint(SegmentIndex);
+	};
+
+	TArray<int32> DirtyRanges;
+	for (int32 Range = 0; Range < NumRanges; ++Range)
+	{
+		const int32 FirstSegment = Range * SegmentsPerRange;
+		const int32 LastSegment = FMath::Min(FirstSegment + SegmentsPerRange, SplineSegments - 1);
+
+		// Up to the next range's first segment: the shared end column takes its drop height
+		for (int32 SegmentIndex = FirstSegment; SegmentIndex <= LastSegment; ++SegmentIndex)
+		{
+			if (DirtySegments[SegmentIndex])
+			{
+				DirtyRanges.Add(Range);
+				break;
+			}
+		}
+	}
+
+	// [2 * dirty range + side], side 0 = left
+	TArray<FWallMeshData> Meshes;
+	Meshes.SetNum(2 * DirtyRanges.Num());
+
+	TArray<FGroundWallColumn> Columns;
+
+	for (int32 Slot = 0; Slot < DirtyRanges.Num(); ++Slot)
+	{
+		const int32 FirstSegment = DirtyRanges[Slot] * SegmentsPerRange;
+		const float StartDistance = GetSegmentStartDistance(FirstSegment);
+		const float EndDistance = GetSegmentStartDistance(FMath::Min(FirstSegment + SegmentsPerRange, SplineSegments));
+
+		const int32 NumSubdivisions = FMath::Max(1, FMath::RoundToInt((EndDistance - StartDistance) / FMath::Max(TargetStep, 1.f)));
+		const int32 NumColumns = NumSubdivisions + 1;
+		const float Step = (EndDistance - StartDistance) / (float)NumSubdivisions;
+
+		for (int32 Side = 0; Side < 2; ++Side)
+		{
+			FWallMeshData& Mesh = Meshes[2 * Slot + Side];
+			Mesh.Vertices.SetNumUninitialized(2 * NumColumns);
+			Mesh.Normals.SetNumUninitialized(2 * NumColumns);
+			Mesh.UVs.SetNumUninitialized(2 * NumColumns);
+			Mesh.Colors.Init(FLinearColor::White, 2 * NumColumns);
+			Mesh.Tangents.SetNum(2 * NumColumns);
+			Mesh.Triangles.SetNumUninitialized(6 * NumSubdivisions);
+		}
+
+		for (int32 i = 0; i < NumColumns; ++i)
+		{
+			// Exact end distance: the next range starts its first column there
+			const float Distance = (i == NumSubdivisions) ? EndDistance : StartDistance + i * Step;
+
+			const int32 SegmentIndex = GetSegmentIndexFromDistance(Distance);
+
+			float DropOffset = 0.f;
+			bool  bUseConst = false;
+			float ConstWorldZ = 0.f;
+
+			const bool bHasDropInfo =
+				GetDropInfoForSegmentByPoints(SegmentIndex, DropOffset, bUseConst, ConstWorldZ);
+
+			const FVector RoadLoc = TrackSpline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+			const FVector Right = TrackSpline->GetRightVectorAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+
+			const float HalfRoadWidth = GetHalfRoadWidthAtDistance(Distance) + GroundWallOutset;
+
+			for (int32 Side = 0; Side < 2; ++Side)
+			{
+				const float SideSign = (Side == 0) ? -1.f : 1.f;
+
+				FGroundWallColumn& Column = Columns.AddDefaulted_GetRef();
+				Column.Distance = Distance;
+				Column.Right = Right;
+				Column.TopWorld = RoadLoc + Right * (HalfRoadWidth * SideSign);
+				Column.MeshIndex = 2 * Slot + Side;
+				Column.ColumnIndex = i;
+
+				if (bHasDropInfo)
+				{
+					Column.TopWorld.Z = bUseConst ? ConstWorldZ : (Column.TopWorld.Z + DropOffset);
+				}
+			}
+		}
+	}
+
+	UWorld* World = GetWorld();
+
+	TArray<AActor*> IgnoreActors;
+	BuildTraceIgnoreActors(IgnoreActors);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(GroundWallTrace), /*bTraceComplex*/ true);
+	QueryParams.AddIgnoredActors(IgnoreActors);
+
+	FCollisionObjectQueryParams ObjectParams;
+	for (const TEnumAsByte<EObjectTypeQuery>& ObjectType : GroundWallObjectsToHitForLineTrace)
+	{
+		ObjectParams.AddObjectTypesToQuery(UEngineTypes::ConvertToCollisionChannel(ObjectType));
+	}
+
+	const bool bCanTrace = World && ObjectParams.IsValid();
+	const float TraceEndZ = GroundWallLineTraceEndWorldZ;
+	const float FallbackDepth = FMath::Max(0.f, GroundWallFallbackDepth);
+
+	const FTransform ActorTM = GetActorTransform();
+
+	// prefer new Units vars if you keep both
+	const float UDenom = (GroundWallUVWorldUnitsU > 1.f) ? GroundWallUVWorldUnitsU : GroundWallUVWorldSizeU;
+	const float VDenom = (GroundWallUVWorldUnitsV > 1.f) ? GroundWallUVWorldUnitsV : GroundWallUVWorldSizeV;
+
+	// ---------------------------------------------------------
+	// 2) Generation (workers): one batch over all dirty sections, each column writes its own slots
+	// ---------------------------------------------------------
+	ParallelFor(Columns.Num(), [&](int32 Index)
+	{
+		const FGroundWallColumn& Column = Columns[Index];
+		const int32 Side = Column.MeshIndex % 2;
+		const int32 i = Column.ColumnIndex;
+		const float SideSign = (Side == 0) ? -1.f : 1.f;
+		const bool bFlipWinding = (Side == 0);
+
+		const FVector& TopPosWorld = Column.TopWorld;
+
+		// Keep the existing wall trace start/end style
+		FVector BottomPosWorld = TopPosWorld - FVector(0.f, 0.f, FallbackDepth);
+
+		FHitResult Hit;
+		if (bCanTrace && World->LineTraceSingleByObjectType(
+			Hit,
+			TopPosWorld + FVector(0.f, 0.f, 100.f),
+			FVector(TopPosWorld.X, TopPosWorld.Y, TraceEndZ),
+			ObjectParams,
+			QueryParams))
+		{
+			BottomPosWorld = Hit.ImpactPoint;
+		}
+
+		const float WallHeightWorld = FMath::Max(1.f, (TopPosWorld - BottomPosWorld).Size());
+
+		const FVector WallDirWorld = (BottomPosWorld - TopPosWorld).GetSafeNormal();
+		FVector NormalWorld = FVector::CrossProduct(WallDirWorld, Column.Right * SideSign).GetSafeNormal();
+		if (SideSign < 0.f)
+		{
+			NormalWorld *= -1.f;
+		}
+
+		const FVector TangentDirWorld = Column.Right * SideSign;
+
+		const FVector NormalLocal = ActorTM.InverseTransformVectorNoScale(NormalWorld);
+		const FVector TangentLocal = ActorTM.InverseTransformVectorNoScale(TangentDirWorld);
+
+		FWallMeshData& Mesh = Meshes[Column.MeshIndex];
+		const int32 NumSubdivisions = Mesh.Triangles.Num() / 6;
+		const int32 BaseIndex = 2 * i;
+
+		Mesh.Vertices[BaseIndex + 0] = ActorTM.InverseTransformPosition(TopPosWorld);
+		Mesh.Vertices[BaseIndex + 1] = ActorTM.InverseTransformPosition(BottomPosWorld);
+
+		Mesh.Normals[BaseIndex + 0] = NormalLocal;
+		Mesh.Normals[BaseIndex + 1] = NormalLocal;
+
+		const float U = (UDenom > 1.f) ? (Column.Distance / UDenom) : (float)i;
+		const float VMax = (VDenom > 1.f) ? (WallHeightWorld / VDenom) : 1.f;
+
+		Mesh.UVs[BaseIndex + 0] = FVector2D(U, 0.f);
+		Mesh.UVs[BaseIndex + 1] = FVector2D(U, VMax);
+
+		const FProcMeshTangent Tangent(TangentLocal, false);
+		Mesh.Tangents[BaseIndex + 0] = Tangent;
+		Mesh.Tangents[BaseIndex + 1] = Tangent;
+
+		if (i < NumSubdivisions)
+		{
+			int32* Tri = &Mesh.Triangles[6 * i];
+
+			if (!bFlipWinding)
+			{
+				Tri[0] = BaseIndex + 0; Tri[1] = BaseIndex + 1; Tri[2] = BaseIndex + 2;
+				Tri[3] = BaseIndex + 2; Tri[4] = BaseIndex + 1; Tri[5] = BaseIndex + 3;
+			}
+			else
+			{
+				Tri[0] = BaseIndex + 0; Tri[1] = BaseIndex + 2; Tri[2] = BaseIndex + 1;
+				Tri[3] = BaseIndex + 2; Tri[4] = BaseIndex + 3; Tri[5] = BaseIndex + 1;
+			}
+		}
+	});
+
+	// ---------------------------------------------------------
+	// 3) Commit (game thread)
+	// ---------------------------------------------------------
+	const int32 SectionsPerRange = bGroundWallsDoubleSided ? 2 : 1;
+
+	for (int32 Side = 0; Side < 2; ++Side)
+	{
+		UProceduralMeshComponent* Comp = WallComps[Side];
+		if (!Comp)
+		{
+			continue;
+		}
+
+		for (int32 Slot = 0; Slot < DirtyRanges.Num(); ++Slot)
+		{
+			const int32 FrontSection = DirtyRanges[Slot] * SectionsPerRange;
+			const FWallMeshData& Mesh = Meshes[2 * Slot + Side];
+
+			CommitWallSection(Comp, FrontSection, Mesh, bEnableCollision);
+
+			if (bGroundWallsDoubleSided)
+			{
+				FWallMeshData BackMesh;
+				MakeBackFaceSection(Mesh, BackMesh);
+				CommitWallSection(Comp, FrontSection + 1, BackMesh, false);
+			}
+
+			if (GroundWallMaterial)
+			{
+				for (int32 Section = FrontSection; Section < FrontSection + SectionsPerRange; ++Section)
+				{
+					Comp->SetMaterial(Section, GroundWallMaterial);
+				}
+			}
+		}
+
+		// Sections of segments that no longer exist
+		for (int32 Section = NumRanges * SectionsPerRange; Section < Comp->GetNumSections(); ++Section)
+		{
+			Comp->ClearMeshSection(Section);
+		}
+	}
+
+	ASYNC_LOG(Verbose, "Ground walls built (%d of %d sections per side, %d columns, %.1f ms).",
+		DirtyRanges.Num(), NumRanges, Columns.Num() / 2, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+UProceduralMeshComponent* ASplineGeneratingActor::EnsureGroundWallComponent(int32 SideSign, TObjectPtr<UProceduralMeshComponent>& InOutComp)
+{
+	if (InOutComp)
+	{
+		return InOutComp;
+	}
+
+	InOutComp = CreateProcMeshComponent(SideSign < 0 ? TEXT("LeftGroundWall") : TEXT("RightGroundWall"));
+	if (!InOutComp)
+	{
+		ASYNC_LOG(Error, "EnsureGroundWallComponent: could not create ProceduralMeshComponent.");
+		return nullptr;
+	}
+
+	InOutComp->SetCollisionEnabled(
+		bEnableCollision ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
+
+	if (GroundWallMaterial)
+	{
+		InOutComp->SetMaterial(0, GroundWallMaterial);
+	}
+
+	InOutComp->SetCanEverAffectNavigation(false);
+
+	return InOutComp;
+}
+
+// ============================================================================
+// Drop Walls
+// ============================================================================
+
+void ASplineGeneratingActor::BuildDropCliffWalls(const TBitArray<>& DirtySegments)
+{
+	if (!TrackSpline || SplineSegments <= 1)
+	{
+		ClearDropWalls();
+		return;
+	}
+
+	// Walls at the end of segments that no longer exist
+	for (int32 SegmentIndex = SplineSegments; SegmentIndex < GeneratedDropWalls.Num(); ++SegmentIndex)
+	{
+		if (IsValid(GeneratedDropWalls[SegmentIndex]))
+			GeneratedDropWalls[SegmentIndex]->DestroyComponent();
+	}
+	GeneratedDropWalls.SetNum(SplineSegments);
+
+	// ---------------------------------------------------------
+	// 1) Snapshot (game thread)
+	// ---------------------------------------------------------
+	TArray<FDropWallQuad> Quads;
+	TArray<int32> QuadSegments;
+
+	for (int32 i = 0; i < SplineSegments - 1; ++i)
+	{
+		// The wall between i and i + 1 depends on both segments
+		if (!DirtySegments[i] && !DirtySegments[i + 1])
+		{
+			continue;
+		}
+
+		if (IsValid(GeneratedDropWalls[i]))
+		{
+			GeneratedDropWalls[i]->DestroyComponent();
+		}
+		GeneratedDropWalls[i] = nullptr;
+
+		const bool bSegAHasRoad = !IsSegmentInsideJumpGapByPoints(i);
+		const bool bSegBHasRoad = !IsSegmentInsideJumpGapByPoints(i + 1);
+
+		if (!bSegAHasRoad || !bSegBHasRoad)
+		{
+			continue;
+		}
+
+		const float BoundaryDistance = TrackSpline->GetDistanceAlongSplineAtSplinePoint(i + 1);
+		const FVector CenterWorld = TrackSpline->GetLocationAtDistanceAlongSpline(BoundaryDistance, ESplineCoordinateSpace::World);
+
+		float DropA = 0.f; bool bUseConstA = false; float ConstZA = 0.f;
+		float DropB = 0.f; bool bUseConstB = false; float ConstZB = 0.f;
+
+		const bool bHasDropA = GetDropInfoForSegmentByPoints(i, DropA, bUseConstA, ConstZA);
+		const bool bHasDropB = GetDropInfoForSegmentByPoints(i + 1, DropB, bUseConstB, ConstZB);
+
+		float WorldZA = CenterWorld.Z;
+		float WorldZB = CenterWorld.Z;
+
+		if (bHasDropA) WorldZA = bUseConstA ? ConstZA : (CenterWorld.Z + DropA);
+		if (bHasDropB) WorldZB = bUseConstB ? ConstZB : (CenterWorld.Z + DropB);
+
+		if (FMath::IsNearlyEqual(WorldZA, WorldZB))
+		{
+			continue;
+		}
+
+		FDropWallQuad& Quad = Quads.AddDefaulted_GetRef();
+		Quad.CenterWorld = CenterWorld;
+		Quad.Right = TrackSpline->GetRightVectorAtDistanceAlongSpline(BoundaryDistance, ESplineCoordinateSpace::World);
+		Quad.HalfWidth = GetHalfRoadWidthAtDistance(BoundaryDistance);
+		Quad.TopZ = FMath::Max(WorldZA, WorldZB);
+		Quad.BottomZ = FMath::Min(WorldZA, WorldZB);
+		QuadSegments.Add(i);
+	}
+
+	if (Quads.Num() == 0)
+	{
+		return;
+	}
+
+	// ---------------------------------------------------------
+	// 2) Generation (workers)
+	// ---------------------------------------------------------
+	const FTransform ActorTM = GetActorTransform();
+
+	const float UDenom = (DropWallUVWorldUnitsU > 1.f) ? DropWallUVWorldUnitsU : DropWallUVWorldSizeU;
+	const float VDenom = (DropWallUVWorldUnitsV > 1.f) ? DropWallUVWorldUnitsV : DropWallUVWorldSizeV;
+
+	TArray<FWallMeshData> Meshes;
+	Meshes.SetNum(Quads.Num());
+
+	ParallelFor(Quads.Num(), [&](int32 Index)
+	{
+		BuildDropWallMesh(Quads[Index], ActorTM, UDenom, VDenom, Meshes[Index]);
+	});
+
+	// ---------------------------------------------------------
+	// 3) Commit (game thread)
+	// ---------------------------------------------------------
+	for (int32 Index = 0; Index < Meshes.Num(); ++Index)
+	{
+		UProceduralMeshComponent* WallComp = CreateDropWallComponent();
+		if (!WallComp)
+		{
+			return;
+		}
+
+		CommitWallSection(WallComp, 0, Meshes[Index], bEnableCollision);
+		GeneratedDropWalls[QuadSegments[Index]] = WallComp;
+	}
+}
+
+UProceduralMeshComponent* ASplineGeneratingActor::CreateDropWallComponent()
+{
+	UProceduralMeshComponent* WallComp = CreateProcMeshComponent(TEXT("DropCliffWall"));
+	if (!WallComp)
+	{
+		return nullptr;
+	}
+
+	WallComp->SetCollisionEnabled(bEnableCollision ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
+	WallComp->SetCanEverAffectNavigation(false);
+
+	if (DropWallMaterial)
+	{
+		WallComp->SetMaterial(0, DropWallMaterial);
+	}
+
+	return WallComp;
+}
+
+// ============================================================================
+// Finalize (merged chunks)
+// ============================================================================
+
+// FinalizeTrack bakes the spline mesh deformation into vertices and merges all pieces of a chunk
+// (FinalizeChunkLengthCm of track) into merged components: one per collision class
+// (road / extra pieces, their collision settings and physical material), each with one section
+// per material. The merged collision comes from a lower LOD of the source meshes, colliding sections
+// only. In the editor each component is a baked static mesh asset (LODs, the merged collision as its
+// complex collision mesh, cooked with the asset); otherwise a static procedural mesh with one hidden
+// section carrying the merged collision. Same three passes as the walls: snapshot, deformation on workers, commit.
+
+struct FFinalizeSourceSection
+{
+	int32 MaterialIndex = 0;
+	int32 FirstIndex = 0;
+	int32 NumTriangles = 0;
+	int32 MinVertexIndex = 0;
+	int32 MaxVertexIndex = 0;
+	bool bEnableCollision = true;
+};
+
+/** CPU copy of one static mesh LOD */
+struct FFinalizeSourceMesh
+{
+	TArray<FVector3f> Positions;
+	TArray<FVector3f> Normals;
+	TArray<FVector3f> TangentsX;
+	TArray<FVector2f> UVs;
+	TArray<uint32> Indices;
+	TArray<FFinalizeSourceSection> Sections;
+};
+
+/** One spline mesh component to bake */
+struct FFinalizePiece
+{
+	const USplineMeshComponent* Comp = nullptr;
+	const FFinalizeSourceMesh* Render = nullptr;
+	const FFinalizeSourceMesh* Collision = nullptr; // null: no collision
+	TArray<int32> SectionSlots;                     // render section -> chunk material slot
+	FMatrix ToChunk = FMatrix::Identity;            // spline mesh component space -> chunk space
+	bool bFlipWinding = false;
+	int32 Chunk = 0;
+};
+
+/** Pieces of one chunk sharing a collision class; becomes one component */
+struct FFinalizeChunk
+{
+	TArray<UMaterialInterface*> Materials;
+	TArray<int32> Pieces;
+	const USplineMeshComponent* CollisionSource = nullptr; // collision settings are copied from it
+	bool bRoad = true;
+};
+
+static bool ExtractFinalizeSource(const UStaticMesh* Mesh, int32 LODIndex, FFinalizeSourceMesh& Out)
+{
+	const FStaticMeshRenderData* RenderData = Mesh ? Mesh->GetRenderData() : nullptr;
+	if (!RenderData || RenderData->LODResources.Num() == 0)
+	{
+		return false;
+	}
+
+	const FStaticMeshLODResources& LOD = RenderData->LODResources[FMath::Clamp(LODIndex, 0, RenderData->LODResources.Num() - 1)];
+	const FPositionVertexBuffer& PositionBuffer = LOD.VertexBuffers.PositionVertexBuffer;
+	const FStaticMeshVertexBuffer& VertexBuffer = LOD.VertexBuffers.StaticMeshVertexBuffer;
+
+	// CPU copies only exist in the editor or with bAllowCPUAccess
+	const int32 NumVerts = PositionBuffer.GetNumVertices();
+	if (NumVerts == 0 || !PositionBuffer.GetVertexData() || !VertexBuffer.GetTangentData() || !VertexBuffer.GetTexCoordData())
+	{
+		return false;
+	}
+
+	LOD.IndexBuffer.GetCopy(Out.Indices);
+	if (Out.Indices.Num() == 0)
+	{
+		return false;
+	}
+
+	const bool bHasUVs = VertexBuffer.GetNumTexCoords() > 0;
+
+	Out.Positions.SetNumUninitialized(NumVerts);
+	Out.Normals.SetNumUninitialized(NumVerts);
+	Out.TangentsX.SetNumUninitialized(NumVerts);
+	Out.UVs.SetNumUninitialized(NumVerts);
+
+	for (int32 i = 0; i < NumVerts; ++i)
+	{
+		Out.Positions[i] = PositionBuffer.VertexPosition(i);
+		Out.Normals[i] = FVector3f(VertexBuffer.VertexTangentZ(i));
+		Out.TangentsX[i] = FVector3f(VertexBuffer.VertexTangentX(i));
+		Out.UVs[i] = bHasUVs ? VertexBuffer.GetVertexUV(i, 0) : FVector2f::ZeroVector;
+	}
+
+	for (const FStaticMeshSection& Section : LOD.Sections)
+	{
+		FFinalizeSourceSection& OutSection = Out.Sections.AddDefaulted_GetRef();
+		OutSection.MaterialIndex = Section.MaterialIndex;
+		OutSection.FirstIndex = (int32)Section.FirstIndex;
+		OutSection.NumTriangles = (int32)Section.NumTriangles;
+		OutSection.MinVertexIndex = (int32)Section.MinVertexIndex;
+		OutSection.MaxVertexIndex = (int32)Section.MaxVertexIndex;
+		OutSection.bEnableCollision = Section.bEnableCollision;
+	}
+
+	return true;
+}
+
+/** Spline mesh deformation of one vertex (as USplineMeshComponent does for its collision), then into chunk space */
+static FVector DeformFinalizePosition(const USplineMeshComponent* Comp, const FMatrix& ToChunk, const FVector3f& InPosition, FTransform& OutSlice)
+{
+	FVector Position(InPosition);
+	double& Along = USplineMeshComponent::GetAxisValueRef(Position, Comp->ForwardAxis);
+
+	OutSlice = Comp->CalcSliceTransform((float)Along);
+	Along = 0.0;
+
+	return ToChunk.TransformPosition(OutSlice.TransformPosition(Position));
+}
+
+static void DeformFinalizeRender(const FFinalizePiece& Piece, TArray<FWallMeshData>& OutSections)
+{
+	const FFinalizeSourceMesh& Src = *Piece.Render;
+	const int32 NumVerts = Src.Positions.Num();
+
+	TArray<FVector> Positions;
+	TArray<FVector> Normals;
 	TArray<FProcMeshTangent> Tangents;
+	Positions.SetNumUninitialized(NumVerts);
+	Normals.SetNumUninitialized(NumVerts);
+	Tangents.SetNumUninitialized(NumVerts);
+
+	for (int32 i = 0; i < NumVerts; ++i)
+	{
+		FTransform Slice;
+		Positions[i] = DeformFinalizePosition(Piece.Comp, Piece.ToChunk, Src.Positions[i], Slice);
+
+		// Normals by the inverse scale (keeps them right on mirrored / squashed slices)
+		const FVector Normal = Slice.TransformVectorNoScale(FVector(Src.Normals[i]) * FTransform::GetSafeScaleReciprocal(Slice.GetScale3D()));
+		Normals[i] = Piece.ToChunk.TransformVector(Normal).GetSafeNormal();
+
+		Tangents[i] = FProcMeshTangent(Piece.ToChunk.TransformVector(Slice.TransformVector(FVector(Src.TangentsX[i]))).GetSafeNormal(), false);
+	}
+
+	OutSections.SetNum(Src.Sections.Num());
+
+	for (int32 SectionIndex = 0; SectionIndex < Src.Sections.Num(); ++SectionIndex)
+	{
+		const FFinalizeSourceSection& Section = Src.Sections[SectionIndex];
+		FWallMeshData& Mesh = OutSections[SectionIndex];
+
+		const int32 First = Section.MinVertexIndex;
+		const int32 Count = Section.MaxVertexIndex - Section.MinVertexIndex + 1;
+
+		Mesh.Vertices.Append(Positions.GetData() + First, Count);
+		Mesh.Normals.Append(Normals.GetData() + First, Count);
+		Mesh.Tangents.Append(Tangents.GetData() + First, Count);
+
+		Mesh.UVs.Reserve(Count);
+		for (int32 i = First; i < First + Count; ++i)
+		{
+			Mesh.UVs.Add(FVector2D(Src.UVs[i]));
+		}
+
+		Mesh.Triangles.SetNumUninitialized(Section.NumTriangles * 3);
+		for (int32 t = 0; t < Section.NumTriangles; ++t)
+		{
+			const uint32* Tri = &Src.Indices[Section.FirstIndex + 3 * t];
+
+			Mesh.Triangles[3 * t + 0] = (int32)Tri[0] - First;
+			Mesh.Triangles[3 * t + 1] = (int32)(Piece.bFlipWinding ? Tri[2] : Tri[1]) - First;
+			Mesh.Triangles[3 * t + 2] = (int32)(Piece.bFlipWinding ? Tri[1] : Tri[2]) - First;
+		}
+	}
+}
+
+static void DeformFinalizeCollision(const FFinalizePiece& Piece, FWallMeshData& OutMesh)
+{
+	const FFinalizeSourceMesh& Src = *Piece.Collision;
+
+	OutMesh.Vertices.SetNumUninitialized(Src.Positions.Num());
+	for (int32 i = 0; i < Src.Positions.Num(); ++i)
+	{
+		FTransform Slice;
+		OutMesh.Vertices[i] = DeformFinalizePosition(Piece.Comp, Piece.ToChunk, Src.Positions[i], Slice);
+	}
+
+	// Only the sections the spline mesh itself collides with
+	for (const FFinalizeSourceSection& Section : Src.Sections)
+	{
+		if (!Section.bEnableCollision)
+		{
+			continue;
+		}
 
-	const float TotalLength = TrackSpline->GetSplineLength();
-	const float Step = TotalLength / (float)GroundWallSubdivisions;
+		for (int32 t = 0; t < Section.NumTriangles; ++t)
+		{
+			const int32 i = Section.FirstIndex + 3 * t;
 
-	const FTransform ActorTM = GetActorTransform();
-	const bool bFlipWinding = (SideSign < 0);
+			OutMesh.Triangles.Add((int32)Src.Indices[i]);
+			OutMesh.Triangles.Add((int32)Src.Indices[Piece.bFlipWinding ? i + 2 : i + 1]);
+			OutMesh.Triangles.Add((int32)Src.Indices[Piece.bFlipWinding ? i + 1 : i + 2]);
+		}
+	}
+}
 
-	// prefer new Units vars if you keep both
-	const float UDenom = (GroundWallUVWorldUnitsU > 1.f) ? GroundWallUVWorldUnitsU : GroundWallUVWorldSizeU;
-	const float VDenom = (GroundWallUVWorldUnitsV > 1.f) ? GroundWallUVWorldUnitsV : GroundWallUVWorldSizeV;
+/** Append Src to Dst (indices offset by the existing vertices) */
+static void AppendWallMeshData(FWallMeshData& Dst, const FWallMeshData& Src)
+{
+	const int32 BaseIndex = Dst.Vertices.Num();
+
+	Dst.Vertices.Append(Src.Vertices);
+	Dst.Normals.Append(Src.Normals);
+	Dst.UVs.Append(Src.UVs);
+	Dst.Colors.Append(Src.Colors);
+	Dst.Tangents.Append(Src.Tangents);
 
-	for (int32 i = 0; i <= GroundWallSubdivisions; ++i)
+	Dst.Triangles.Reserve(Dst.Triangles.Num() + Src.Triangles.Num());
+	for (const int32 Index : Src.Triangles)
 	{
-		const float Distance = i * Step;
+		Dst.Triangles.Add(BaseIndex + Index);
+	}
+}
 
-		const int32 SegmentIndex = GetSegmentIndexFromDistance(Distance);
+#if WITH_EDITOR
+/** Editor only: static mesh asset PackageName, created or reused (rebuilt by the caller) */
+static UStaticMesh* FindOrCreateFinalizeAsset(const FString& PackageName, bool& bOutCreated)
+{
+	bOutCreated = false;
+
+	if (!FPackageName::IsValidLongPackageName(PackageName))
+	{
+		return nullptr;
+	}
 
-		float DropOffset = 0.f;
-		bool  bUseConst = false;
-		float ConstWorldZ = 0.f;
+	UPackage* Package = CreatePackage(*PackageName);
+	if (!Package)
+	{
+		return nullptr;
+	}
+	Package->FullyLoad();
 
-		const bool bHasDropInfo =
-			GetDropInfoForSegmentByPoints(SegmentIndex, DropOffset, bUseConst, ConstWorldZ);
+	const FString AssetName = FPackageName::GetShortName(PackageName);
 
-		const FVector RoadLoc = TrackSpline->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
-		const FVector Right = TrackSpline->GetRightVectorAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
+	UStaticMesh* StaticMesh = FindObject<UStaticMesh>(Package, *AssetName);
+	bOutCreated = !StaticMesh;
+	if (bOutCreated)
+	{
+		StaticMesh = NewObject<UStaticMesh>(Package, *AssetName, RF_Public | RF_Standalone | RF_Transactional);
+	}
+	StaticMesh->Modify();
 
-		const float HalfRoadWidth = GetHalfRoadWidthAtDistance(Distance) + GroundWallOutset;
+	return StaticMesh;
+}
 
-		FVector TopPosWorld = RoadLoc + Right * (HalfRoadWidth * SideSign);
+/** One polygon group + material slot per mesh; meshes without normals / tangents / UVs get defaults (recomputed by the build) */
+static void BuildFinalizeMeshDescription(
+	UStaticMesh* StaticMesh,
+	TConstArrayView<FWallMeshData> SlotMeshes,
+	TConstArrayView<UMaterialInterface*> Materials,
+	FMeshDescription& OutDescription)
+{
+	FStaticMeshAttributes Attributes(OutDescription);
+	Attributes.Register();
 
-		if (bHasDropInfo)
-		{
-			TopPosWorld.Z = bUseConst ? ConstWorldZ : (TopPosWorld.Z + DropOffset);
-		}
+	TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+	TVertexInstanceAttributesRef<FVector3f> Tangents = Attributes.GetVertexInstanceTangents();
+	TVertexInstanceAttributesRef<float> BinormalSigns = Attributes.GetVertexInstanceBinormalSigns();
+	TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+	TPolygonGroupAttributesRef<FName> SlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
 
-		FVector ImpactLoc, ImpactNormal;
-		FVector BottomPosWorld = TopPosWorld;
+	TArray<FStaticMaterial>& StaticMaterials = StaticMesh->GetStaticMaterials();
+	StaticMaterials.Reset();
 
-		if (LineTraceHitGroundForWalls(TopPosWorld, ImpactLoc, ImpactNormal))
+	for (int32 Slot = 0; Slot < SlotMeshes.Num(); ++Slot)
+	{
+		const FWallMeshData& Mesh = SlotMeshes[Slot];
+		const FName SlotName(*FString::Printf(TEXT("Slot%d"), Slot));
+
+		const FPolygonGroupID Group = OutDescription.CreatePolygonGroup();
+		SlotNames[Group] = SlotName;
+		StaticMaterials.Add(FStaticMaterial(Materials[Slot], SlotName));
+
+		const bool bHasNormals = Mesh.Normals.Num() == Mesh.Vertices.Num();
+		const bool bHasTangents = Mesh.Tangents.Num() == Mesh.Vertices.Num();
+		const bool bHasUVs = Mesh.UVs.Num() == Mesh.Vertices.Num();
+
+		TArray<FVertexInstanceID> Instances;
+		Instances.Reserve(Mesh.Vertices.Num());
+
+		for (int32 i = 0; i < Mesh.Vertices.Num(); ++i)
 		{
-			BottomPosWorld = ImpactLoc;
+			const FVertexID Vertex = OutDescription.CreateVertex();
+			Positions[Vertex] = FVector3f(Mesh.Vertices[i]);
+
+			const FVertexInstanceID Instance = OutDescription.CreateVertexInstance(Vertex);
+			Normals[Instance] = bHasNormals ? FVector3f(Mesh.Normals[i]) : FVector3f::UpVector;
+			Tangents[Instance] = bHasTangents ? FVector3f(Mesh.Tangents[i].TangentX) : FVector3f::ForwardVector;
+			BinormalSigns[Instance] = (bHasTangents && Mesh.Tangents[i].bFlipTangentY) ? -1.f : 1.f;
+			UVs.Set(Instance, 0, bHasUVs ? FVector2f(Mesh.UVs[i]) : FVector2f::ZeroVector);
+
+			Instances.Add(Instance);
 		}
-		else
+
+		for (int32 i = 0; i + 2 < Mesh.Triangles.Num(); i += 3)
 		{
-			BottomPosWorld = TopPosWorld - FVector(0.f, 0.f, FMath::Max(0.f, GroundWallFallbackDepth));
+			const FVertexInstanceID Triangle[3] = { Instances[Mesh.Triangles[i]], Instances[Mesh.Triangles[i + 1]], Instances[Mesh.Triangles[i + 2]] };
+			OutDescription.CreateTriangle(Group, Triangle);
 		}
+	}
+}
 
-		const float WallHeightWorld = FMath::Max(1.f, (TopPosWorld - BottomPosWorld).Size());
+static void CommitFinalizeAsset(UStaticMesh* StaticMesh, bool bCreated)
+{
+	StaticMesh->Build(/*bInSilent*/ true);
+	StaticMesh->PostEditChange();
+	StaticMesh->MarkPackageDirty();
 
-		const FVector WallDirWorld = (BottomPosWorld - TopPosWorld).GetSafeNormal();
-		FVector NormalWorld = FVector::CrossProduct(WallDirWorld, Right * SideSign).GetSafeNormal();
-		if (SideSign < 0)
+	if (bCreated)
+	{
+		FAssetRegistryModule::AssetCreated(StaticMesh);
+	}
+}
+
+/**
+ * Editor only: merged chunk sections -> static mesh asset (reused if it exists). LOD 1+ are reductions
+ * of LOD 0. A non-empty CollisionMesh (the merged spline mesh collision) is baked into a "<name>_Collision"
+ * asset and used as the complex collision mesh, cooked with the asset; without one the asset has no collision.
+ */
+static UStaticMesh* BakeFinalizeStaticMesh(
+	const FString& PackageName,
+	const TArray<FWallMeshData>& SlotMeshes,
+	const TArray<UMaterialInterface*>& Materials,
+	int32 NumLODs,
+	const FWallMeshData& CollisionMesh)
+{
+	// Collision first, the chunk mesh cooks from it
+	UStaticMesh* CollisionAsset = nullptr;
+	if (CollisionMesh.Triangles.Num() > 0)
+	{
+		bool bCollisionCreated = false;
+		CollisionAsset = FindOrCreateFinalizeAsset(PackageName + TEXT("_Collision"), bCollisionCreated);
+		if (!CollisionAsset)
 		{
-			NormalWorld *= -1.f;
+			return nullptr;
 		}
 
-		const FVector TangentDirWorld = Right * SideSign;
+		FMeshDescription CollisionDescription;
+		UMaterialInterface* const NoMaterial = nullptr;
+		BuildFinalizeMeshDescription(CollisionAsset, MakeArrayView(&CollisionMesh, 1), MakeArrayView(&NoMaterial, 1), CollisionDescription);
 
-		const FVector TopPosLocal = ActorTM.InverseTransformPosition(TopPosWorld);
-		const FVector BottomPosLocal = ActorTM.InverseTransformPosition(BottomPosWorld);
-		const FVector NormalLocal = ActorTM.InverseTransformVectorNoScale(NormalWorld);
-		const FVector TangentLocal = ActorTM.InverseTransformVectorNoScale(TangentDirWorld);
+		CollisionAsset->SetNumSourceModels(1);
+		FStaticMeshSourceModel& CollisionModel = CollisionAsset->GetSourceModel(0);
+		CollisionModel.BuildSettings.bRecomputeNormals = true;
+		CollisionModel.BuildSettings.bRecomputeTangents = true;
+
+		CollisionAsset->CreateMeshDescription(0, MoveTemp(CollisionDescription));
+		CollisionAsset->CommitMeshDescription(0);
+		CommitFinalizeAsset(CollisionAsset, bCollisionCreated);
+	}
 
-		const int32 BaseIndex = Vertices.Num();
+	bool bCreated = false;
+	UStaticMesh* StaticMesh = FindOrCreateFinalizeAsset(PackageName, bCreated);
+	if (!StaticMesh)
+	{
+		return nullptr;
+	}
 
-		Vertices.Add(TopPosLocal);
-		Vertices.Add(BottomPosLocal);
+	FMeshDescription MeshDescription;
+	BuildFinalizeMeshDescription(StaticMesh, SlotMeshes, Materials, MeshDescription);
 
-		Normals.Add(NormalLocal);
-		Normals.Add(NormalLocal);
+	const int32 LODCount = FMath::Clamp(NumLODs, 1, MAX_STATIC_MESH_LODS);
+	StaticMesh->SetNumSourceModels(LODCount);
 
-		const float U = (UDenom > 1.f) ? (Distance / UDenom) : (float)i;
-		const float VMax = (VDenom > 1.f) ? (WallHeightWorld / VDenom) : 1.f;
+	for (int32 LODIndex = 0; LODIndex < LODCount; ++LODIndex)
+	{
+		FStaticMeshSourceModel& SourceModel = StaticMesh->GetSourceModel(LODIndex);
+		SourceModel.BuildSettings.bRecomputeNormals = false;
+		SourceModel.BuildSettings.bRecomputeTangents = false;
+		SourceModel.ReductionSettings.PercentTriangles = FMath::Pow(0.5f, (float)LODIndex);
+	}
+
+	StaticMesh->CreateMeshDescription(0, MoveTemp(MeshDescription));
+	StaticMesh->CommitMeshDescription(0);
+
+	// Render LODs never collide: the merged collision mesh or nothing
+	StaticMesh->ComplexCollisionMesh = CollisionAsset;
+	StaticMesh->CreateBodySetup();
+	StaticMesh->GetBodySetup()->CollisionTraceFlag = CollisionAsset ? CTF_UseComplexAsSimple : CTF_UseDefault;
+	StaticMesh->GetBodySetup()->bNeverNeedsCookedCollisionData = !CollisionAsset;
+
+	CommitFinalizeAsset(StaticMesh, bCreated);
 
-		UVs.Add(FVector2D(U, 0.f));
-		UVs.Add(FVector2D(U, VMax));
+	return StaticMesh;
+}
+#endif
+
+void ASplineGeneratingActor::FinalizeTrack()
+{
+	if (bIsBuilding || bPendingRebuild)
+	{
+		ASYNC_LOG(Warning, "FinalizeTrack: build in progress, finalize after it finished.");
+		return;
+	}
+	if (!TrackSpline || SplineSegments <= 0 || GeneratedSegments.Num() != SplineSegments)
+	{
+		ASYNC_LOG(Warning, "FinalizeTrack: no built track to finalize.");
+		return;
+	}
 
-		VertexColors.Add(FLinearColor::White);
-		VertexColors.Add(FLinearColor::White);
+	const double StartTime = FPlatformTime::Seconds();
+	const FTrackGeometryStats Before = GetGeometryStats();
 
-		FProcMeshTangent Tangent(TangentLocal, false);
-		Tangents.Add(Tangent);
-		Tangents.Add(Tangent);
+	// ---------------------------------------------------------
+	// 1) Snapshot (game thread)
+	// ---------------------------------------------------------
+	TMap<TPair<const UStaticMesh*, int32>, TUniquePtr<FFinalizeSourceMesh>> Sources;
 
-		if (i < GroundWallSubdivisions)
+	auto FindSource = [&Sources](const UStaticMesh* Mesh, int32 LODIndex) -> const FFinalizeSourceMesh*
+	{
+		TUniquePtr<FFinalizeSourceMesh>& Source = Sources.FindOrAdd(MakeTuple(Mesh, LODIndex));
+		if (!Source)
 		{
-			if (!bFlipWinding)
+			Source = MakeUnique<FFinalizeSourceMesh>();
+			if (!ExtractFinalizeSource(Mesh, LODIndex, *Source))
 			{
-				Triangles.Add(BaseIndex + 0);
-				Triangles.Add(BaseIndex + 1);
-				Triangles.Add(BaseIndex + 2);
+				Source->Positions.Reset();
+			}
+		}
+		return Source->Positions.Num() > 0 ? Source.Get() : nullptr;
+	};
+
+	const float ChunkLength = FMath::Max(1000.f, FinalizeChunkLengthCm);
+	const int32 NumChunks = FMath::Max(1, FMath::CeilToInt(TrackSpline->GetSplineLength() / ChunkLength));
+
+	const FMatrix WorldToRoot = RootComponent->GetComponentTransform().ToMatrixWithScale().Inverse();
+
+	TArray<FFinalizePiece> Pieces;
+	TArray<FFinalizeChunk> Chunks;
+
+	// (track chunk, road, collision enabled, physical material) -> Chunks index
+	TMap<TTuple<int32, bool, uint8, const UPhysicalMaterial*>, int32> ChunkLookup;
+
+	for (int32 SegmentIndex = 0; SegmentIndex < SplineSegments; ++SegmentIndex)
+	{
+		const float SegmentStart = TrackSpline->GetDistanceAlongSplineAtSplinePoint(SegmentIndex);
+		const int32 TrackChunk = FMath::Clamp(FMath::FloorToInt(SegmentStart / ChunkLength), 0, NumChunks - 1);
 
-				Triangles.Add(BaseIndex + 2);
-				Triangles.Add(BaseIndex + 1);
-				Triangles.Add(BaseIndex + 3);
+		const FGeneratedTrackSegment& Segment = GeneratedSegments[SegmentIndex];
+
+		for (int32 MeshIndex = 0; MeshIndex < Segment.Meshes.Num(); ++MeshIndex)
+		{
+			const USplineMeshComponent* Comp = Segment.Meshes[MeshIndex];
+			if (!IsValid(Comp) || !Comp->GetStaticMesh())
+			{
+				continue;
 			}
-			else
+
+			const UStaticMesh* Mesh = Comp->GetStaticMesh();
+			const ECollisionEnabled::Type CollisionEnabled = Comp->GetCollisionEnabled();
+			const bool bCollides = CollisionEnabled != ECollisionEnabled::NoCollision;
+			const bool bRoad = MeshIndex < Segment.NumRoadMeshes;
+
+			// Road and extra pieces keep their own collision settings and physical material
+			const TTuple<int32, bool, uint8, const UPhysicalMaterial*> ChunkKey(
+				TrackChunk, bRoad, (uint8)CollisionEnabled, Comp->BodyInstance.PhysMaterialOverride.Get());
+
+			int32& ChunkIndex = ChunkLookup.FindOrAdd(ChunkKey, INDEX_NONE);
+			if (ChunkIndex == INDEX_NONE)
+			{
+				ChunkIndex = Chunks.AddDefaulted();
+				Chunks[ChunkIndex].CollisionSource = Comp;
+				Chunks[ChunkIndex].bRoad = bRoad;
+			}
+
+			FFinalizePiece Piece;
+			Piece.Comp = Comp;
+			Piece.Render = FindSource(Mesh, 0);
+			Piece.Collision = bCollides ? FindSource(Mesh, FinalizeCollisionLOD) : nullptr;
+			Piece.Chunk = ChunkIndex;
+
+			if (!Piece.Render || (bCollides && !Piece.Collision))
 			{
-				Triangles.Add(BaseIndex + 0);
-				Triangles.Add(BaseIndex + 2);
-				Triangles.Add(BaseIndex + 1);
+				ASYNC_LOG(Error, "FinalizeTrack: no CPU mesh data for %s -> finalize aborted.", *Mesh->GetName());
+				return;
+			}
 
-				Triangles.Add(BaseIndex + 2);
-				Triangles.Add(BaseIndex + 3);
-				Triangles.Add(BaseIndex + 1);
+			FFinalizeChunk& Chunk = Chunks[ChunkIndex];
+			for (const FFinalizeSourceSection& Section : Piece.Render->Sections)
+			{
+				Piece.SectionSlots.Add(Chunk.Materials.AddUnique(Comp->GetMaterial(Section.MaterialIndex)));
 			}
+
+			Piece.ToChunk = Comp->GetComponentTransform().ToMatrixWithScale() * WorldToRoot;
+
+			// Mirrored pieces (negative scale) keep their faces outward
+			const FSplineMeshParams& Params = Comp->SplineParams;
+			Piece.bFlipWinding = (Params.StartScale.X * Params.StartScale.Y < 0.0) != (Piece.ToChunk.Determinant() < 0.0);
+
+			Chunk.Pieces.Add(Pieces.Num());
+			Pieces.Add(MoveTemp(Piece));
 		}
 	}
 
-	OutComp->CreateMeshSection_LinearColor(
-		0,
-		Vertices,
-		Triangles,
-		Normals,
-		UVs,
-		VertexColors,
-		Tangents,
-		bEnableCollision,
-		false
-	);
+	// ---------------------------------------------------------
+	// 2) Deformation (workers, spline mesh components are only read)
+	// ---------------------------------------------------------
+	TArray<TArray<FWallMeshData>> PieceSections;
+	TArray<FWallMeshData> PieceCollision;
+	PieceSections.SetNum(Pieces.Num());
+	PieceCollision.SetNum(Pieces.Num());
 
-	if (bGroundWallsDoubleSided)
+	ParallelFor(Pieces.Num(), [&](int32 Index)
 	{
-		TArray<int32> BackTriangles;
-		BackTriangles.Reserve(Triangles.Num());
+		DeformFinalizeRender(Pieces[Index], PieceSections[Index]);
 
-		for (int32 t = 0; t < Triangles.Num(); t += 3)
+		if (Pieces[Index].Collision)
 		{
-			BackTriangles.Add(Triangles[t + 0]);
-			BackTriangles.Add(Triangles[t + 2]);
-			BackTriangles.Add(Triangles[t + 1]);
+			DeformFinalizeCollision(Pieces[Index], PieceCollision[Index]);
 		}
+	});
+
+	// ---------------------------------------------------------
+	// 3) Merge + commit (game thread)
+	// ---------------------------------------------------------
+	ClearFinalizedChunks();
+
+	// Static chunks need a static parent
+	RootComponent->SetMobility(EComponentMobility::Static);
+
+#if WITH_EDITOR
+	const bool bBakeStaticMeshes = bFinalizeToStaticMeshes && GetWorld() && !GetWorld()->IsGameWorld();
+	const FString LevelName = FPackageName::GetShortName(GetPackage());
+#endif
 
-		TArray<FVector> BackNormals = Normals;
-		for (FVector& N : BackNormals)
+	for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+	{
+		const FFinalizeChunk& Chunk = Chunks[ChunkIndex];
+		if (Chunk.Pieces.Num() == 0)
 		{
-			N *= -1.f;
+			continue;
 		}
 
-		OutComp->CreateMeshSection_LinearColor(
-			1,
-			Vertices,
-			BackTriangles,
-			BackNormals,
-			UVs,
-			VertexColors,
-			Tangents,
-			false,
-			false
-		);
+		TArray<FWallMeshData> SlotMeshes;
+		SlotMeshes.SetNum(Chunk.Materials.Num());
+		FWallMeshData CollisionMesh;
 
-		if (GroundWallMaterial)
+		for (const int32 PieceIndex : Chunk.Pieces)
 		{
-			OutComp->SetMaterial(1, GroundWallMaterial);
+			const FFinalizePiece& Piece = Pieces[PieceIndex];
+			for (int32 SectionIndex = 0; SectionIndex < Piece.SectionSlots.Num(); ++SectionIndex)
+			{
+				AppendWallMeshData(SlotMeshes[Piece.SectionSlots[SectionIndex]], PieceSections[PieceIndex][SectionIndex]);
+			}
+			AppendWallMeshData(CollisionMesh, PieceCollision[PieceIndex]);
 		}
-	}
-}
-
-// ============================================================================
-// Drop Walls
-// ============================================================================
 
-void ASplineGeneratingActor::BuildDropCliffWalls()
-{
-	if (!TrackSpline || SplineSegments <= 1)
-	{
-		return;
-	}
+		const bool bHasCollision = CollisionMesh.Triangles.Num() > 0;
+		const TCHAR* ChunkName = Chunk.bRoad ? TEXT("FinalizedTrackChunk") : TEXT("FinalizedExtraChunk");
 
-	for (int32 i = 0; i < SplineSegments - 1; ++i)
-	{
-		const bool bSegAHasRoad = !IsSegmentInsideJumpGapByPoints(i);
-		const bool bSegBHasRoad = !IsSegmentInsideJumpGapByPoints(i + 1);
+		UPrimitiveComponent* ChunkComp = nullptr;
 
-		if (!bSegAHasRoad || !bSegBHasRoad)
+#if WITH_EDITOR
+		// Editor: static mesh asset with LODs and collision cooked with the asset
+		if (bBakeStaticMeshes)
 		{
-			continue;
+			const FString PackageName = FString::Printf(TEXT("%s/SM_%s_%s_%s_%d"),
+				*FinalizeAssetPath, *LevelName, *GetName(), Chunk.bRoad ? TEXT("Road") : TEXT("Extra"), ChunkIndex);
+
+			if (UStaticMesh* ChunkMesh = BakeFinalizeStaticMesh(PackageName, SlotMeshes, Chunk.Materials, FinalizeNumLODs, CollisionMesh))
+			{
+				ChunkComp = CreateStaticMeshComponent(ChunkName, ChunkMesh);
+			}
+			else
+			{
+				ASYNC_LOG(Warning, "FinalizeTrack: could not bake static mesh %s -> procedural chunk.", *PackageName);
+			}
 		}
+#endif
 
-		const float BoundaryDistance = TrackSpline->GetDistanceAlongSplineAtSplinePoint(i + 1);
-		const FVector CenterWorld = TrackSpline->GetLocationAtDistanceAlongSpline(BoundaryDistance, ESplineCoordinateSpace::World);
+		// Runtime (or failed bake): procedural mesh, collision in a hidden section
+		if (!ChunkComp)
+		{
+			UProceduralMeshComponent* ProcComp = CreateProcMeshComponent(ChunkName, EComponentMobility::Static);
+			if (!ProcComp)
+			{
+				ASYNC_LOG(Error, "FinalizeTrack: could not create ProceduralMeshComponent.");
+				continue;
+			}
 
-		float DropA = 0.f; bool bUseConstA = false; float ConstZA = 0.f;
-		float DropB = 0.f; bool bUseConstB = false; float ConstZB = 0.f;
+			for (int32 Slot = 0; Slot < SlotMeshes.Num(); ++Slot)
+			{
+				CommitWallSection(ProcComp, Slot, SlotMeshes[Slot], false);
+				ProcComp->SetMaterial(Slot, Chunk.Materials[Slot]);
+			}
 
-		const bool bHasDropA = GetDropInfoForSegmentByPoints(i, DropA, bUseConstA, ConstZA);
-		const bool bHasDropB = GetDropInfoForSegmentByPoints(i + 1, DropB, bUseConstB, ConstZB);
+			if (bHasCollision)
+			{
+				const int32 CollisionSection = SlotMeshes.Num();
+				CommitWallSection(ProcComp, CollisionSection, CollisionMesh, true);
+				ProcComp->SetMeshSectionVisible(CollisionSection, false);
+			}
 
-		float WorldZA = CenterWorld.Z;
-		float WorldZB = CenterWorld.Z;
+			ChunkComp = ProcComp;
+		}
 
-		if (bHasDropA) WorldZA = bUseConstA ? ConstZA : (CenterWorld.Z + DropA);
-		if (bHasDropB) WorldZB = bUseConstB ? ConstZB : (CenterWorld.Z + DropB);
+		FinalizedChunks.Add(ChunkComp);
 
-		if (FMath::IsNearlyEqual(WorldZA, WorldZB))
+		ChunkComp->SetCastShadow(bCastShadow);
+		ChunkComp->SetCastContactShadow(bCastContactShadow);
+		ChunkComp->SetCanEverAffectNavigation(false);
+
+		if (!bHasCollision)
 		{
+			ChunkComp->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 			continue;
 		}
 
-		BuildDropCliffWallAtDistance(BoundaryDistance, WorldZA, WorldZB);
+		// Same collision as the spline meshes of this class (road: RoadPhysicalMaterial, Visibility block)
+		const USplineMeshComponent* Source = Chunk.CollisionSource;
+		ChunkComp->SetCollisionObjectType(Source->GetCollisionObjectType());
+		ChunkComp->SetCollisionResponseToChannels(Source->GetCollisionResponseToChannels());
+		ChunkComp->SetCollisionEnabled(Source->GetCollisionEnabled());
+
+		if (UPhysicalMaterial* PhysMaterial = Source->BodyInstance.PhysMaterialOverride)
+		{
+			ChunkComp->SetPhysMaterialOverride(PhysMaterial);
+		}
+	}
+
+	// The chunks replace the spline meshes
+	for (FGeneratedTrackSegment& Segment : GeneratedSegments)
+	{
+		DestroySegmentMeshes(Segment);
 	}
+	GeneratedSegments.Empty();
+	GeneratedSettingsHash = 0;
+
+	FinalizedGeometryKey = ComputeGeometryCacheKey();
+
+	const FTrackGeometryStats After = GetGeometryStats();
+
+	ASYNC_LOG(Log, "Track finalized into %d chunks (%.1f ms): components %d -> %d, collision components %d -> %d, sections %d -> %d, triangles %d -> %d, without LODs %d -> %d, runtime-cooked collision triangles %d -> %d.",
+		FinalizedChunks.Num(),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0,
+		Before.NumComponents, After.NumComponents,
+		Before.NumCollisionComponents, After.NumCollisionComponents,
+		Before.NumSections, After.NumSections,
+		Before.NumTriangles, After.NumTriangles,
+		Before.NumComponentsWithoutLODs, After.NumComponentsWithoutLODs,
+		Before.NumRuntimeCookedTriangles, After.NumRuntimeCookedTriangles);
+}
+
+void ASplineGeneratingActor::UnfinalizeTrack()
+{
+	ClearFinalizedChunks();
+	RebuildTrack();
 }
 
-void ASplineGeneratingActor::BuildDropCliffWallAtDistance(float DistanceAlongSpline, float FromWorldZ, float ToWorldZ)
+void ASplineGeneratingActor::ClearFinalizedChunks()
 {
-	if (!TrackSpline || FMath::IsNearlyEqual(FromWorldZ, ToWorldZ))
+	if (FinalizedChunks.Num() == 0)
 	{
+		FinalizedGeometryKey.Reset();
 		return;
 	}
 
-	const float TopZ = FMath::Max(FromWorldZ, ToWorldZ);
-	const float BottomZ = FMath::Min(FromWorldZ, ToWorldZ);
+	for (UPrimitiveComponent* Comp : FinalizedChunks)
+	{
+		if (IsValid(Comp))
+			Comp->DestroyComponent();
+	}
+	FinalizedChunks.Empty();
+	FinalizedGeometryKey.Reset();
 
-	const FVector CenterWorld = TrackSpline->GetLocationAtDistanceAlongSpline(DistanceAlongSpline, ESplineCoordinateSpace::World);
-	const FVector Right = TrackSpline->GetRightVectorAtDistanceAlongSpline(DistanceAlongSpline, ESplineCoordinateSpace::World);
+	// FinalizeTrack made the root static for the chunks
+	if (RootComponent)
+	{
+		RootComponent->SetMobility(EComponentMobility::Movable);
+	}
+}
 
-	const float HalfWidth = GetHalfRoadWidthAtDistance(DistanceAlongSpline);
+FTrackGeometryStats ASplineGeneratingActor::GetGeometryStats() const
+{
+	FTrackGeometryStats Stats;
 
-	const FVector TopCenterWorld(CenterWorld.X, CenterWorld.Y, TopZ);
-	const FVector BottomCenterWorld(CenterWorld.X, CenterWorld.Y, BottomZ);
+	auto AddPrimitive = [&Stats](const UPrimitiveComponent* Comp)
+	{
+		++Stats.NumComponents;
+		if (Comp->GetCollisionEnabled() != ECollisionEnabled::NoCollision)
+		{
+			++Stats.NumCollisionComponents;
+		}
+	};
 
-	const FVector TopLeftWorld = TopCenterWorld - Right * HalfWidth;
-	const FVector TopRightWorld = TopCenterWorld + Right * HalfWidth;
-	const FVector BottomLeftWorld = BottomCenterWorld - Right * HalfWidth;
-	const FVector BottomRightWorld = BottomCenterWorld + Right * HalfWidth;
+	// No LODs, dynamic draw path, collision cooked when the sections are created (every load)
+	auto AddProcMesh = [&Stats, &AddPrimitive](UProceduralMeshComponent* Comp)
+	{
+		if (!IsValid(Comp))
+		{
+			return;
+		}
 
-	const float WallHeightWorld = FMath::Max(1.f, TopZ - BottomZ);
-	const float WallWidthWorld = FMath::Max(1.f, (2.f * HalfWidth));
+		AddPrimitive(Comp);
+		++Stats.NumDynamicComponents;
+		++Stats.NumComponentsWithoutLODs;
 
-	const float UDenom = (DropWallUVWorldUnitsU > 1.f) ? DropWallUVWorldUnitsU : DropWallUVWorldSizeU;
-	const float VDenom = (DropWallUVWorldUnitsV > 1.f) ? DropWallUVWorldUnitsV : DropWallUVWorldSizeV;
+		const bool bCollides = Comp->GetCollisionEnabled() != ECollisionEnabled::NoCollision;
 
-	const float UMax = (UDenom > 1.f) ? (WallWidthWorld / UDenom) : 1.f;
-	const float VMax = (VDenom > 1.f) ? (WallHeightWorld / VDenom) : 1.f;
+		for (int32 SectionIndex = 0; SectionIndex < Comp->GetNumSections(); ++SectionIndex)
+		{
+			const FProcMeshSection* Section = Comp->GetProcMeshSection(SectionIndex);
+			if (!Section || Section->ProcIndexBuffer.Num() == 0)
+			{
+				continue;
+			}
 
-	const FTransform ActorTM = GetActorTransform();
+			if (Section->bSectionVisible)
+			{
+				++Stats.NumSections;
+				Stats.NumTriangles += Section->ProcIndexBuffer.Num() / 3;
+			}
+			if (bCollides && Section->bEnableCollision)
+			{
+				Stats.NumRuntimeCookedTriangles += Section->ProcIndexBuffer.Num() / 3;
+			}
+		}
+	};
 
-	const FVector TopLeftLocal = ActorTM.InverseTransformPosition(TopLeftWorld);
-	const FVector TopRightLocal = ActorTM.InverseTransformPosition(TopRightWorld);
-	const FVector BottomLeftLocal = ActorTM.InverseTransformPosition(BottomLeftWorld);
-	const FVector BottomRightLocal = ActorTM.InverseTransformPosition(BottomRightWorld);
+	// Spline meshes and baked chunks: cooked collision, LODs of the asset
+	auto AddStaticMesh = [&Stats, &AddPrimitive](const UStaticMeshComponent* Comp)
+	{
+		if (!IsValid(Comp))
+		{
+			return;
+		}
 
-	FVector NormalWorld =
-		FVector::CrossProduct((BottomLeftWorld - TopLeftWorld), (TopRightWorld - TopLeftWorld)).GetSafeNormal();
+		AddPrimitive(Comp);
 
-	const FVector NormalLocal = ActorTM.InverseTransformVectorNoScale(NormalWorld);
-	const FVector TangentLocal = ActorTM.InverseTransformVectorNoScale(Right);
+		const UStaticMesh* Mesh = Comp->GetStaticMesh();
+		const FStaticMeshRenderData* RenderData = Mesh ? Mesh->GetRenderData() : nullptr;
+		if (RenderData && RenderData->LODResources.Num() > 0)
+		{
+			Stats.NumSections += RenderData->LODResources[0].Sections.Num();
+			Stats.NumTriangles += RenderData->LODResources[0].GetNumTriangles();
 
-	UProceduralMeshComponent* WallComp = CreateProcMeshComponent(TEXT("DropCliffWall"));
-	if (!WallComp)
+			if (RenderData->LODResources.Num() == 1)
+			{
+				++Stats.NumComponentsWithoutLODs;
+			}
+		}
+	};
+
+	for (const FGeneratedTrackSegment& Segment : GeneratedSegments)
 	{
-		return;
+		for (const TObjectPtr<USplineMeshComponent>& Comp : Segment.Meshes)
+		{
+			AddStaticMesh(Comp);
+		}
 	}
 
-	WallComp->SetCollisionEnabled(bEnableCollision ? ECollisionEnabled::QueryAndPhysics : ECollisionEnabled::NoCollision);
-	WallComp->SetCanEverAffectNavigation(false);
+	AddProcMesh(LeftGroundWall);
+	AddProcMesh(RightGroundWall);
 
-	if (DropWallMaterial)
+	for (UProceduralMeshComponent* Comp : GeneratedDropWalls)
 	{
-		WallComp->SetMaterial(0, DropWallMaterial);
+		AddProcMesh(Comp);
+	}
+	for (UPrimitiveComponent* Comp : FinalizedChunks)
+	{
+		if (UProceduralMeshComponent* ProcComp = Cast<UProceduralMeshComponent>(Comp))
+		{
+			AddProcMesh(ProcComp);
+		}
+		else
+		{
+			AddStaticMesh(Cast<UStaticMeshComponent>(Comp));
+		}
 	}
 
-	GeneratedDropWalls.Add(WallComp);
-
-	TArray<FVector>          Vertices;
-	TArray<int32>            Triangles;
-	TArray<FVector>          Normals;
-	TArray<FVector2D>        UVs;
-	TArray<FLinearColor>     Colors;
-	TArray<FProcMeshTangent> Tangents;
-
-	Vertices.Add(TopLeftLocal);
-	Vertices.Add(TopRightLocal);
-	Vertices.Add(BottomRightLocal);
-	Vertices.Add(BottomLeftLocal);
+	return Stats;
+}
 
-	for (int32 i = 0; i < 4; ++i)
-	{
-		Normals.Add(NormalLocal);
-		Colors.Add(FLinearColor::White);
-		Tangents.Add(FProcMeshTangent(TangentLocal, false));
-	}
-
-	UVs.Add(FVector2D(0.f, 0.f));
-	UVs.Add(FVector2D(UMax, 0.f));
-	UVs.Add(FVector2D(UMax, VMax));
-	UVs.Add(FVector2D(0.f, VMax));
-
-	Triangles.Add(0);
-	Triangles.Add(1);
-	Triangles.Add(2);
-
-	Triangles.Add(0);
-	Triangles.Add(2);
-	Triangles.Add(3);
-
-	WallComp->CreateMeshSection_LinearColor(
-		0,
-		Vertices,
-		Triangles,
-		Normals,
-		UVs,
-		Colors,
-		Tangents,
-		bEnableCollision,
-		false
-	);
+void ASplineGeneratingActor::LogGeometryStats() const
+{
+	const FTrackGeometryStats Stats = GetGeometryStats();
+
+	ASYNC_LOG(Log, "Track geometry%s: %d components (%d with collision, %d without LODs, %d dynamic draw), %d sections, %d triangles, %d collision triangles cooked at runtime.",
+		IsTrackFinalized() ? TEXT(" (finalized)") : TEXT(""),
+		Stats.NumComponents,
+		Stats.NumCollisionComponents,
+		Stats.NumComponentsWithoutLODs,
+		Stats.NumDynamicComponents,
+		Stats.NumSections,
+		Stats.NumTriangles,
+		Stats.NumRuntimeCookedTriangles);
 }
 
 // ============================================================================
@@ -1775,24 +3755,34 @@ int32 ASplineGeneratingActor::GetSegmentIndexFromDistance(float Distance) const
 		return 0;
 	}
 
-	for (int32 Seg = 0; Seg < SplineSegments; ++Seg)
-	{
-		const float D0 = TrackSpline->GetDistanceAlongSplineAtSplinePoint(Seg);
+	const int32 NumPoints = TrackSpline->GetNumberOfSplinePoints();
 
-		float D1 = 0.f;
-		if (bClosedLoop && Seg == TrackSpline->GetNumberOfSplinePoints() - 1)
+	auto SegmentEndDistance = [this, NumPoints](int32 Seg)
+	{
+		return (bClosedLoop && Seg == NumPoints - 1)
+			? TrackSpline->GetSplineLength()
+			: TrackSpline->GetDistanceAlongSplineAtSplinePoint(Seg + 1);
+	};
+
+	// Segment ends ascend with the index: binary search for the first segment ending at or after Distance
+	int32 Lo = 0;
+	int32 Hi = SplineSegments;
+	while (Lo < Hi)
+	{
+		const int32 Mid = Lo + (Hi - Lo) / 2;
+		if (SegmentEndDistance(Mid) < Distance)
 		{
-			D1 = TrackSpline->GetSplineLength();
+			Lo = Mid + 1;
 		}
 		else
 		{
-			D1 = TrackSpline->GetDistanceAlongSplineAtSplinePoint(Seg + 1);
+			Hi = Mid;
 		}
+	}
 
-		if (Distance >= D0 && Distance <= D1)
-		{
-			return Seg;
-		}
+	if (Lo < SplineSegments && Distance >= TrackSpline->GetDistanceAlongSplineAtSplinePoint(Lo))
+	{
+		return Lo;
 	}
 
 	return SplineSegments - 1;
@@ -1946,7 +3936,7 @@ void ASplineGeneratingActor::SmoothSplineTangents()
 			TrackSpline->SetSplinePointType(i, ESplinePointType::CurveCustomTangent, false);
 		}
 
-		TrackSpline->UpdateSpline();
+		UpdateSpline();
 	}
 
 	ASYNC_LOG(Log, "SmoothSplineTangents: Applied %d pass(es), Tension=%.2f", Passes, Tension);
@@ -1987,7 +3977,7 @@ void ASplineGeneratingActor::RotateSplinePointsForward()
 	{
 		TrackSpline->AddPoint(P, false);
 	}
-	TrackSpline->UpdateSpline();
+	UpdateSpline();
 
 	ASYNC_LOG(Log, "RotateSplinePointsForward: Rotated %d spline points forward.", Num);
 
@@ -2030,7 +4020,7 @@ void ASplineGeneratingActor::RotateSplinePointsBackward()
 	{
 		TrackSpline->AddPoint(P, false);
 	}
-	TrackSpline->UpdateSpline();
+	UpdateSpline();
 
 	ASYNC_LOG(Log, "RotateSplinePointsBackward: Rotated %d spline points backward.", Num);
 
@@ -21,6 +21,8 @@ class USplineMeshComponent;
 class USplinePointListAsset;
 class UTextRenderComponent;
 class UProceduralMeshComponent;
+class UPrimitiveComponent;
+class UStaticMeshComponent;
 class UMaterialInterface;
 class UPhysicalMaterial;
 
@@ -67,6 +69,58 @@ struct FStuntDropByPoints
 	float ConstantGapWorldZ = 0.f;
 };
 
+/** Components generated for one spline segment, with the hash of the inputs they were built from */
+USTRUCT()
+struct FGeneratedTrackSegment
+{
+	GENERATED_BODY()
+
+	/** Road pieces and extra meshes of the segment */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<USplineMeshComponent>> Meshes;
+
+	/** Leading entries of Meshes that are road pieces, the rest are extra meshes */
+	int32 NumRoadMeshes = 0;
+
+	/** Segment inputs at build time (0 = not built) */
+	uint32 Hash = 0;
+};
+
+/** Generated geometry of a track actor (spline meshes, walls, finalized chunks) */
+USTRUCT(BlueprintType)
+struct FTrackGeometryStats
+{
+	GENERATED_BODY()
+
+	/** Generated primitive components */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "TrackTools")
+	int32 NumComponents = 0;
+
+	/** Components with collision enabled (one physics body each) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "TrackTools")
+	int32 NumCollisionComponents = 0;
+
+	/** Rendered mesh sections (LOD 0), roughly one draw call each */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "TrackTools")
+	int32 NumSections = 0;
+
+	/** Rendered triangles (LOD 0) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "TrackTools")
+	int32 NumTriangles = 0;
+
+	/** Rendered components with a single LOD (procedural meshes, static meshes without LODs) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "TrackTools")
+	int32 NumComponentsWithoutLODs = 0;
+
+	/** Procedural mesh components: drawn through the dynamic path, no cached draw commands */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "TrackTools")
+	int32 NumDynamicComponents = 0;
+
+	/** Collision triangles of procedural meshes, cooked at runtime on every load instead of with the assets */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "TrackTools")
+	int32 NumRuntimeCookedTriangles = 0;
+};
+
 UCLASS(
 	hidecategories = (
 		Display, Attachment, "LOD", "LOD|Advanced",
@@ -99,6 +153,43 @@ public:
 	UFUNCTION(CallInEditor, Category = "TrackTools")
 	void CancelAsyncBuild();
 
+	/** Delete all cached track geometry (e.g. after the landscape under a track changed) */
+	UFUNCTION(CallInEditor, Category = "TrackTools|Cache")
+	void ClearGeometryCache();
+
+	/**
+	 * Bake the deformed road and extra spline meshes into a few merged chunks (FinalizeChunkLengthCm)
+	 * with merged collision from FinalizeCollisionLOD, then remove the spline mesh components.
+	 * Road and extra pieces get separate components with their own collision settings and physical material.
+	 * In the editor the chunks are baked into static mesh assets (FinalizeAssetPath) with FinalizeNumLODs LODs
+	 * and collision cooked with the asset; otherwise they are static procedural meshes.
+	 * The finalized track is kept until its inputs change.
+	 */
+	UFUNCTION(CallInEditor, Category = "TrackTools|Finalize")
+	void FinalizeTrack();
+
+	/** Drop the finalized chunks and rebuild the spline mesh components */
+	UFUNCTION(CallInEditor, Category = "TrackTools|Finalize")
+	void UnfinalizeTrack();
+
+	UFUNCTION(BlueprintPure, Category = "TrackTools|Finalize")
+	bool IsTrackFinalized() const { return FinalizedChunks.Num() > 0; }
+
+	/** Component, section and triangle counts of the generated geometry */
+	UFUNCTION(BlueprintCallable, Category = "TrackTools|Finalize")
+	FTrackGeometryStats GetGeometryStats() const;
+
+	UFUNCTION(CallInEditor, Category = "TrackTools|Finalize")
+	void LogGeometryStats() const;
+
+	/** Progress of the running async build (0..1, 1 when idle) */
+	UFUNCTION(BlueprintPure, Category = "TrackTools|Async")
+	float GetBuildProgress() const { return BuildProgress; }
+
+	/** Estimated seconds until the running async build finishes (0 when idle) */
+	UFUNCTION(BlueprintPure, Category = "TrackTools|Async")
+	float GetBuildEtaSeconds() const { return BuildEtaSeconds; }
+
 	// ---------------------------------------------------------
 	// Data Asset
 	// ---------------------------------------------------------
@@ -289,34 +380,141 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Async")
 	bool bUseAsyncBuild = true;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Async", meta = (EditCondition = "bUseAsyncBuild", ClampMin = "1", UIMin = "1"))
-	int32 SegmentsPerTick = 2;
+	/** Editor time slice per tick for the async build (ms). At least one segment is built per tick. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Async", meta = (EditCondition = "bUseAsyncBuild", ClampMin = "0.5", UIMin = "0.5"))
+	float BuildBudgetMs = 8.f;
+
+	/** Build the segments closest to the editor camera first */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Async", meta = (EditCondition = "bUseAsyncBuild"))
+	bool bPrioritizeNearCamera = true;
+
+	UPROPERTY(VisibleInstanceOnly, Transient, Category = "TrackTools|Async")
+	float BuildProgress = 1.f;
+
+	UPROPERTY(VisibleInstanceOnly, Transient, Category = "TrackTools|Async")
+	float BuildEtaSeconds = 0.f;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Async")
 	bool bAutoRebuildOnConstruction = true;
 
+	/**
+	 * Only rebuild segments whose inputs changed (spline points incl. one neighbour per side,
+	 * segment data, gaps / drops). Unchanged segments keep their components.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Async")
+	bool bIncrementalRebuild = true;
+
+	/**
+	 * Store finished builds in Saved/AsyncSplineBuilder/GeometryCache, keyed by a hash of the spline
+	 * points, segment data, gaps / drops and settings. A full build with a matching entry restores
+	 * the spline meshes and walls without tracing or generating. Trace targets are not hashed:
+	 * clear the cache after editing the ground under a track.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Cache")
+	bool bUseGeometryCache = true;
+
+	/** Cache files kept on disk; the least recently used ones are deleted after a save (0 = no limit) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Cache", meta = (ClampMin = "0"))
+	int32 MaxGeometryCacheEntries = 32;
+
 	UPROPERTY(Transient)
 	bool bIsBuilding = false;
 
 	UPROPERTY(Transient)
 	bool bPendingRebuild = false;
 
+	/** Position in SegmentsToBuild of the async build */
 	UPROPERTY(Transient)
 	int32 CurrentBuildSegmentIndex = INDEX_NONE;
 
+	/** Dirty segments of the current build (ascending, the async build reorders the rest by camera distance) */
+	UPROPERTY(Transient)
+	TArray<int32> SegmentsToBuild;
+
+	/** One entry per spline segment */
 	UPROPERTY(Transient)
-	TArray<TObjectPtr<USplineMeshComponent>> GeneratedSplineMeshes;
+	TArray<FGeneratedTrackSegment> GeneratedSegments;
 
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UTextRenderComponent>> GeneratedDebugText;
 
+	/** One entry per spline segment: drop wall at the segment's end, null if there is none */
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<UProceduralMeshComponent>> GeneratedDropWalls;
 
+	// ---------------------------------------------------------
+	// Frame Table (baked after each build, see FTrackFrameTable)
+	// ---------------------------------------------------------
+
+	/** Sample step of the baked track frame table */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Frame Table", meta = (ClampMin = "5.0", UIMin = "5.0"))
+	float FrameTableStepCm = 50.f;
+
+	/** Curvature window (+/-) of the baked track frame table */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Frame Table", meta = (ClampMin = "10.0", UIMin = "10.0"))
+	float FrameTableCurvatureWindowCm = 300.f;
+
+	// ---------------------------------------------------------
+	// Finalize (merged chunks, see FinalizeTrack)
+	// ---------------------------------------------------------
+
+	/** Track length per merged chunk */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Finalize", meta = (ClampMin = "1000.0", UIMin = "1000.0"))
+	float FinalizeChunkLengthCm = 20000.f;
+
+	/** Source mesh LOD used for the merged collision (clamped to the last LOD of each mesh, colliding sections only); baked chunk meshes get it as their complex collision mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Finalize", meta = (ClampMin = "0", UIMin = "0"))
+	int32 FinalizeCollisionLOD = 1;
+
+	/** Editor: bake the chunks into static mesh assets instead of procedural meshes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Finalize")
+	bool bFinalizeToStaticMeshes = true;
+
+	/** Content folder of the baked chunk meshes (one asset per chunk, reused when finalizing again) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Finalize", meta = (EditCondition = "bFinalizeToStaticMeshes"))
+	FString FinalizeAssetPath = TEXT("/Game/AsyncSplineBuilder/Finalized");
+
+	/** LODs of the baked chunk meshes, each with half the triangles of the previous one */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TrackTools|Finalize", meta = (ClampMin = "1", ClampMax = "8", EditCondition = "bFinalizeToStaticMeshes"))
+	int32 FinalizeNumLODs = 3;
+
+	/** Merged chunks of a finalized track (saved with the level): static mesh or procedural mesh components */
+	UPROPERTY()
+	TArray<TObjectPtr<UPrimitiveComponent>> FinalizedChunks;
+
+	/** Geometry cache key of the inputs the chunks were baked from */
+	UPROPERTY()
+	FString FinalizedGeometryKey;
+
 private:
+	/** Immutable once baked, readers keep their copy alive across rebuilds */
+	mutable TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> TrackFrameTable;
+
+	void BakeTrackFrameTable() const;
+
 	double LastRebuildRequestTime = 0.0;
 	double RebuildDelaySeconds = 0.1;
 
+	/** Inputs shared by all segments / by the walls at the last build (0 = nothing built) */
+	uint32 GeneratedSettingsHash = 0;
+	uint32 GeneratedWallsHash = 0;
+	uint32 PendingWallsHash = 0;
+	bool bWallsDirty = true;
+
+	/** Segments whose walls are rebuilt by the current build (changed or moved index), all of them while bWallsDirty */
+	TBitArray<> DirtyWallSegments;
+
+	// Async build scheduler: measured cost per work unit (1 + extra meshes of a segment)
+	double AvgMsPerWorkUnit = 0.5;
+	double AvgTickSeconds = 1.0 / 30.0;
+	int32 TotalWorkUnits = 0;
+	int32 DoneWorkUnits = 0;
+	FVector LastPriorityCameraLocation = FVector::ZeroVector;
+	bool bHasPriorityCamera = false;
+
+	/** Geometry cache key of the running build, written once it finished */
+	FString PendingGeometryCacheKey;
+
 	// ---------------------------------------------------------
 	// Ground Walls
 	// ---------------------------------------------------------
@@ -327,6 +525,10 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "AsyncSpline|GroundWalls", meta = (ClampMin = "4", ClampMax = "4096"))
 	int32 GroundWallSubdivisions = 64;
 
+	/** Spline segments per wall section: editing a point only rebuilds the sections of the segments it changed */
+	UPROPERTY(EditAnywhere, Category = "AsyncSpline|GroundWalls", meta = (ClampMin = "1", ClampMax = "256"))
+	int32 GroundWallSegmentsPerSection = 8;
+
 	UPROPERTY(EditAnywhere, Category = "AsyncSpline|GroundWalls")
 	float GroundWallOutset = 0.f;
 
@@ -380,8 +582,9 @@ protected:
 	UPROPERTY(Transient)
 	TObjectPtr<UProceduralMeshComponent> RightGroundWall = nullptr;
 
-	void BuildGroundWalls();
-	void BuildSingleGroundWall(int32 SideSign, TObjectPtr<UProceduralMeshComponent>& OutComp);
+	/** Sections of both walls covering a dirty segment: spline snapshot, parallel traces + mesh arrays on workers, commit to the components */
+	void BuildGroundWalls(const TBitArray<>& DirtySegments);
+	UProceduralMeshComponent* EnsureGroundWallComponent(int32 SideSign, TObjectPtr<UProceduralMeshComponent>& InOutComp);
 	void ClearGroundWalls();
 
 	float GetHalfRoadWidthAtDistance(float DistanceAlongSpline) const;
@@ -439,6 +642,7 @@ private:
 	float CalculateSplineSegmentLength(const int32 SegmentIndex) const;
 
 	void AddRoadAndExtraMeshesToSpline();
+	void BuildSegment(int32 SegmentIndex);
 	void BuildSplineMeshComponents(const int32 SegmentIndex);
 	void BuildExtraSplineMeshComponent(const int32 SegmentIndex, const int32 MeshIndex);
 
@@ -448,7 +652,6 @@ private:
 	void SnapToLandscape();
 
 	bool LineTraceHitLandscape(const FVector& StartPoint, FVector& ImpactPoint, FVector& ImpactNormal) const;
-	bool LineTraceHitGroundForWalls(const FVector& StartPoint, FVector& ImpactPoint, FVector& ImpactNormal) const;
 
 	void UpdateSpline() const;
 	float GetDivisor() const;
@@ -456,19 +659,45 @@ private:
 	// Async control
 	void RequestBuild();
 	void StartBuild_Internal();
-	void BuildNextSegments(int32 NumSegments);
+	void BuildNextSegmentsWithinBudget(double BudgetMs);
+	int32 GetSegmentWorkUnits(int32 SegmentIndex) const;
+	void SortBuildQueueByCamera();
+	void UpdateBuildProgress();
 	void FinishBuild_Internal();
 
+	// Incremental rebuild
+	void PrepareIncrementalBuild();
+	void BuildWallsIfDirty();
+	uint32 ComputeSettingsHash() const;
+	uint32 ComputeWallsHash() const;
+	uint32 ComputeSegmentHash(int32 SegmentIndex) const;
+	/** Rehash the built segments from the current (snapped) spline points */
+	void RehashBuiltSegments();
+	void DestroySegmentMeshes(FGeneratedTrackSegment& Segment);
+
+	// Geometry cache
+	static FString GetGeometryCacheDir();
+	FString ComputeGeometryCacheKey() const;
+	bool TryRestoreGeometryCache(const FString& Key);
+	void SaveGeometryCache();
+	void PruneGeometryCache() const;
+
+	// Finalize
+	void ClearFinalizedChunks();
+
 	// Cleanup
 	void ClearGeneratedMeshes();
+	void ClearDropWalls();
 	void ClearDebugText();
 	void ClearGeneratedComponents();
 
 	// Drop walls
-	void BuildDropCliffWalls();
-	void BuildDropCliffWallAtDistance(float DistanceAlongSpline, float FromWorldZ, float ToWorldZ);
+	/** Drop walls at the boundaries next to a dirty segment */
+	void BuildDropCliffWalls(const TBitArray<>& DirtySegments);
+	UProceduralMeshComponent* CreateDropWallComponent();
 
 	// Segment/drops helpers
+	/** Binary search over the spline point distances */
 	int32 GetSegmentIndexFromDistance(float Distance) const;
 	bool IsSegmentInsideJumpGapByPoints(int32 SegmentIndex) const;
 
@@ -489,7 +718,8 @@ private:
 	// ---------------------------------------------------------
 	USplineMeshComponent* CreateSplineMeshComponent();
 	UTextRenderComponent* CreateTextComponent(const FTransform& WorldTransform);
-	UProceduralMeshComponent* CreateProcMeshComponent(FName DebugName);
+	UProceduralMeshComponent* CreateProcMeshComponent(FName DebugName, EComponentMobility::Type Mobility = EComponentMobility::Movable);
+	UStaticMeshComponent* CreateStaticMeshComponent(FName DebugName, UStaticMesh* Mesh);
 
 	// Local conversion helpers for spline mesh (expects LOCAL)
 	FVector WorldToActorLocalPos(const FVector& WorldPos) const;
@@ -509,6 +739,11 @@ private:
 	static bool IsLandscapeHit(const FHitResult& Hit);
 
 	virtual class USplineComponent* GetRoadSpline_Implementation() const override;
+
+public:
+	/** Baked frame table of TrackSpline, baked lazily (game thread) if no build ran yet, e.g. in cooked games */
+	virtual TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> GetTrackFrameTable() const override;
+
 protected:
 #if WITH_EDITOR
 	UFUNCTION(CallInEditor, Category = "Landscape|Ignore")
@@ -1,5 +1,6 @@
 #include "Actors/NoSpawnZoneActor.h"
 #include "GameInstance/RespawnGameInstanceSubsystem.h"
+#include "Subsystems/NoSpawnZoneSubsystem.h"
 #include "Components/BoxComponent.h"
 
 ANoSpawnZoneActor::ANoSpawnZoneActor()
@@ -16,6 +17,17 @@ ANoSpawnZoneActor::ANoSpawnZoneActor()
 #endif
 }
 
+void ANoSpawnZoneActor::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+
+	// Keeps the spatial index current while the zone is placed / moved in the editor
+	if (UNoSpawnZoneSubsystem* ZoneIndex = GetWorld() ? GetWorld()->GetSubsystem<UNoSpawnZoneSubsystem>() : nullptr)
+	{
+		ZoneIndex->RegisterZone(this);
+	}
+}
+
 void ANoSpawnZoneActor::BeginPlay()
 {
 	Super::BeginPlay();
@@ -44,9 +56,25 @@ void ANoSpawnZoneActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 		}
 	}
 
+	if (UNoSpawnZoneSubsystem* ZoneIndex = GetWorld() ? GetWorld()->GetSubsystem<UNoSpawnZoneSubsystem>() : nullptr)
+	{
+		ZoneIndex->UnregisterZone(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
+void ANoSpawnZoneActor::Destroyed()
+{
+	// Editor deletes don't go through EndPlay
+	if (UNoSpawnZoneSubsystem* ZoneIndex = GetWorld() ? GetWorld()->GetSubsystem<UNoSpawnZoneSubsystem>() : nullptr)
+	{
+		ZoneIndex->UnregisterZone(this);
+	}
+
+	Super::Destroyed();
+}
+
 bool ANoSpawnZoneActor::ContainsPoint(const FVector& WorldPoint) const
 {
 	return ContainsPointWithMargin(WorldPoint, SafetyExtraCm);
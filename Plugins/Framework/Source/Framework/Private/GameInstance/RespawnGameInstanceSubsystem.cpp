@@ -21,6 +21,8 @@
 #include "Logging/StructuredLog.h"
 
 #include "Actors/NoSpawnZoneActor.h"
+#include "Subsystems/NoSpawnZoneSubsystem.h"
+#include "Track/TrackFrameTable.h"
 
 DEFINE_LOG_CATEGORY_STATIC(Log_RespawnSubsystem, Log, All);
 
@@ -139,6 +141,30 @@ static FQuat MakeRespawnRotationFromSpline(const USplineComponent* Spline, float
 	return RollQuat * YawQuat;
 }
 
+// ------------------------------------------------------------
+// Spline point: baked frame table of the track if it has one, else the spline
+// ------------------------------------------------------------
+static FVector GetTrackLocationAtDistance(const USplineComponent* Spline, const FTrackFrameTable* Table, float DistanceCm)
+{
+	return Table
+		? Table->GetLocationAtDistance(DistanceCm)
+		: Spline->GetLocationAtDistanceAlongSpline(DistanceCm, ESplineCoordinateSpace::World);
+}
+
+// ------------------------------------------------------------
+// Closest distance without a prior: spatial hash of the baked table (heading-filtered), else global spline search
+// ------------------------------------------------------------
+static float FindTrackDistanceNear(const USplineComponent* Spline, const FTrackFrameTable* Table, const FVector& WorldLocation, const FVector& Forward)
+{
+	if (Table)
+	{
+		return Table->Relocalize(WorldLocation, Forward);
+	}
+
+	const float Key = Spline->FindInputKeyClosestToWorldLocation(WorldLocation);
+	return Spline->GetDistanceAlongSplineAtSplineInputKey(Key);
+}
+
 // ------------------------------------------------------------
 // Surface trace: start above spline and trace down to find REAL track Z (drop-safe)
 // ------------------------------------------------------------
@@ -191,12 +217,30 @@ static bool TraceTrackSurfaceBelow(
 	return true;
 }
 
+static void GatherValidActors(const TSet<TWeakObjectPtr<AActor>>& Actors, TArray<AActor*>& OutActors)
+{
+	OutActors.Reset(Actors.Num());
+
+	for (const TWeakObjectPtr<AActor>& Weak : Actors)
+	{
+		if (AActor* A = Weak.Get())
+		{
+			OutActors.Add(A);
+		}
+	}
+}
+
 // ============================================================================
 // Subsystem lifetime
 // ============================================================================
 void URespawnGameInstanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	// Bake the respawn table once the level's actors (track, zones) are in
+	WorldInitializedActorsHandle = FWorldDelegates::OnWorldInitializedActors.AddUObject(
+		this, &URespawnGameInstanceSubsystem::HandleWorldInitializedActors);
+
 	if (bDebug)
 		RSP_LOGFMT(Display, "Initialized");
 }
@@ -211,12 +255,18 @@ void URespawnGameInstanceSubsystem::Deinitialize()
 		{
 			TM.ClearTimer(It.Value);
 		}
+		TM.ClearTimer(RespawnTableBakeTimer);
 	}
 
+	FWorldDelegates::OnWorldInitializedActors.Remove(WorldInitializedActorsHandle);
+	WorldInitializedActorsHandle.Reset();
+
 	RespawnTimers.Empty();
 	ActorsToRespawn.Empty();
 	NoSpawnZoneActors.Empty();
 	CachedTrackProviderActor.Reset();
+	RespawnTable = FRespawnTable();
+	PendingRespawnTable = FRespawnTable();
 
 	if (bDebug)
 		RSP_LOGFMT(Display, "Deinitialized");
@@ -244,6 +294,18 @@ void URespawnGameInstanceSubsystem::RegisterNoSpawnZone_Implementation(AActor* Z
 	}
 
 	NoSpawnZoneActors.Add(ZoneWeak);
+
+	if (ANoSpawnZoneActor* Zone = Cast<ANoSpawnZoneActor>(ZoneActor))
+	{
+		if (UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(ZoneActor->GetWorld()))
+		{
+			ZoneIndex->RegisterZone(Zone);
+		}
+	}
+
+	// Zones changed: rebake in the background (coalesces with other registrations this frame)
+	RequestRespawnTableBake();
+
 	if (bDebug)
 		RSP_LOGFMT(Log, "No-spawn zone registered. Actor={Actor}", ("Actor", GetNameSafe(ZoneActor)));
 }
@@ -265,6 +327,17 @@ void URespawnGameInstanceSubsystem::UnRegisterNoSpawnZone_Implementation(AActor*
 	}
 
 	NoSpawnZoneActors.Remove(ZoneWeak);
+
+	if (ANoSpawnZoneActor* Zone = Cast<ANoSpawnZoneActor>(ZoneActor))
+	{
+		if (UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(ZoneActor->GetWorld()))
+		{
+			ZoneIndex->UnregisterZone(Zone);
+		}
+	}
+
+	RequestRespawnTableBake();
+
 	if (bDebug)
 		RSP_LOGFMT(Log, "No-spawn zone unregistered. Actor={Actor}", ("Actor", GetNameSafe(ZoneActor)));
 }
@@ -313,6 +386,9 @@ void URespawnGameInstanceSubsystem::NotifyRespawn(AActor* ActorToRespawn)
 		RSP_LOGFMT(Verbose, "Engine OFF for Actor={Actor}", ("Actor", GetNameSafe(ActorToRespawn)));
 	}
 
+	// Start rebaking a stale respawn table in the background; until it is done DoRespawn searches
+	RequestRespawnTableBake();
+
 	// Schedule timer (store handle per actor)
 	const FVector ActorLocation = ActorToRespawn->GetActorLocation();
 
@@ -340,35 +416,24 @@ void URespawnGameInstanceSubsystem::NotifyRespawn(AActor* ActorToRespawn)
 // ============================================================================
 ANoSpawnZoneActor* URespawnGameInstanceSubsystem::FindBlockingNoSpawnZone(
 	const FVector& WorldPoint,
-	float ActorRadiusCm
+	float ActorRadiusCm,
+	const USplineComponent* Spline,
+	float DistanceCm
 )
 {
-	for (auto It = NoSpawnZoneActors.CreateIterator(); It; ++It)
+	const UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(GetWorld());
+	if (!ZoneIndex)
 	{
-		TWeakObjectPtr<AActor>& Weak = *It;
-
-		if (!Weak.IsValid())
-		{
-			It.RemoveCurrent();
-			continue;
-		}
-
-		AActor* A = Weak.Get();
-		ANoSpawnZoneActor* Zone = Cast<ANoSpawnZoneActor>(A);
-		if (!Zone)
-		{
-			continue;
-		}
-
-		const float Extra = Zone->GetSafetyExtraCm() + ActorRadiusCm;
-
-		if (Zone->ContainsPointWithMargin(WorldPoint, Extra))
-		{
-			return Zone;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	// Zone SafetyExtraCm is applied by the index, ActorRadiusCm on top
+	FNoSpawnZoneHit Hit;
+	const bool bBlocked = Spline
+		? ZoneIndex->FindZoneAtDistance(Spline, DistanceCm, WorldPoint, ActorRadiusCm, Hit)
+		: ZoneIndex->FindZoneAtPoint(WorldPoint, ActorRadiusCm, Hit);
+
+	return bBlocked ? Hit.Zone.Get() : nullptr;
 }
 
 // ============================================================================
@@ -389,14 +454,21 @@ bool URespawnGameInstanceSubsystem::FindSafeDistanceOnTrackSpline(
 
 	const float ActorRadiusCm = GetActorRadius2D(Actor);
 
+	if (UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(GetWorld()))
+	{
+		ZoneIndex->RegisterSpline(Spline);
+	}
+
+	const TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Table = FTrackFrameTable::FindBaked(Spline);
+
 	float S = WrapOrClampDistance(Spline, StartDistanceCm);
 
 	const int32 MaxIter = 32;
 	for (int32 Iter = 0; Iter < MaxIter; ++Iter)
 	{
-		const FVector P = Spline->GetLocationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
+		const FVector P = GetTrackLocationAtDistance(Spline, Table.Get(), S);
 
-		if (ANoSpawnZoneActor* Blocking = FindBlockingNoSpawnZone(P, ActorRadiusCm))
+		if (ANoSpawnZoneActor* Blocking = FindBlockingNoSpawnZone(P, ActorRadiusCm, Spline, S))
 		{
 			const int32 Sign = (Blocking->GetExitMode() == ENoSpawnExitMode::Backward) ? -1 : +1;
 
@@ -457,8 +529,14 @@ bool URespawnGameInstanceSubsystem::FindSafeTrackTransform(
 		return false;
 	}
 
-	const float BaseKey = SplineComp->FindInputKeyClosestToWorldLocation(QueryWorldLocation);
-	const float BaseS = SplineComp->GetDistanceAlongSplineAtSplineInputKey(BaseKey);
+	if (UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(World))
+	{
+		ZoneIndex->RegisterSpline(SplineComp);
+	}
+
+	const TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Table = FTrackFrameTable::FindBaked(SplineComp);
+
+	const float BaseS = FindTrackDistanceNear(SplineComp, Table.Get(), QueryWorldLocation, FVector::ZeroVector);
 
 	const int32 Steps = FMath::Max(0, MaxSearchSteps);
 	const float Step = FMath::Max(1.f, SearchStepCm);
@@ -473,10 +551,10 @@ bool URespawnGameInstanceSubsystem::FindSafeTrackTransform(
 			const float Sign = (t == 0) ? +1.f : -1.f;
 			const float CandS = WrapOrClampDistance(SplineComp, BaseS + Sign * D);
 
-			const FVector SplineLoc = SplineComp->GetLocationAtDistanceAlongSpline(CandS, ESplineCoordinateSpace::World);
+			const FVector SplineLoc = GetTrackLocationAtDistance(SplineComp, Table.Get(), CandS);
 
 			// Check zones (use SafetyExtra as a "radius")
-			if (FindBlockingNoSpawnZone(SplineLoc, SafetyExtraCm) != nullptr)
+			if (FindBlockingNoSpawnZone(SplineLoc, SafetyExtraCm, SplineComp, CandS) != nullptr)
 			{
 				continue;
 			}
@@ -509,6 +587,320 @@ bool URespawnGameInstanceSubsystem::FindSafeTrackTransform(
 
 	return false;
 }
+
+// ============================================================================
+// Respawn table
+// ============================================================================
+bool URespawnGameInstanceSubsystem::BakeRespawnTable()
+{
+	USplineComponent* Spline = ResolveTrackSpline(GetWorld(), CachedTrackProviderActor);
+	if (!Spline)
+	{
+		return false;
+	}
+
+	// Finish the pending bake in this call instead of spreading it over frames
+	if (!EnsureRespawnTable(Spline))
+	{
+		while (!BakePendingRespawnTable(/*BudgetSeconds*/ 0.0))
+		{
+		}
+	}
+	return IsRespawnTableFor(RespawnTable, Spline);
+}
+
+void URespawnGameInstanceSubsystem::RequestRespawnTableBake()
+{
+	if (!bUseRespawnTable)
+	{
+		return;
+	}
+
+	if (USplineComponent* Spline = ResolveTrackSpline(GetWorld(), CachedTrackProviderActor))
+	{
+		EnsureRespawnTable(Spline);
+	}
+}
+
+void URespawnGameInstanceSubsystem::HandleWorldInitializedActors(const UWorld::FActorsInitializedParams& Params)
+{
+	if (Params.World && Params.World->GetGameInstance() == GetGameInstance())
+	{
+		RequestRespawnTableBake();
+	}
+}
+
+bool URespawnGameInstanceSubsystem::IsRespawnTableFor(const FRespawnTable& Table, const USplineComponent* Spline) const
+{
+	const UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(GetWorld());
+	const uint32 ZoneRevision = ZoneIndex ? ZoneIndex->GetRevision() : 0;
+
+	return Spline
+		&& Table.Entries.Num() > 0
+		&& Table.Spline.Get() == Spline
+		&& Table.ZoneRevision == ZoneRevision
+		&& Table.ClearanceCm == RespawnTableClearanceCm
+		// Same staleness rules as FTrackFrameTable::IsUpToDate
+		&& Table.SplineRevision == FTrackFrameTable::GetSplineRevision(Spline)
+		&& Table.NumPoints == Spline->GetNumberOfSplinePoints()
+		&& Table.bClosedLoop == Spline->IsClosedLoop()
+		&& FMath::IsNearlyEqual(Table.LengthCm, Spline->GetSplineLength(), 1.f)
+		&& Table.SplineTransform.Equals(Spline->GetComponentTransform(), 0.01);
+}
+
+bool URespawnGameInstanceSubsystem::EnsureRespawnTable(const USplineComponent* Spline)
+{
+	check(IsInGameThread());
+
+	UWorld* World = GetWorld();
+	if (!World || !Spline || Spline->GetSplineLength() <= 1.f)
+	{
+		return false;
+	}
+
+	if (IsRespawnTableFor(RespawnTable, Spline))
+	{
+		return true;
+	}
+
+	// Already baking this spline for the current zones: let it run
+	if (IsRespawnTableFor(PendingRespawnTable, Spline))
+	{
+		ScheduleRespawnTableBake();
+		return false;
+	}
+
+	UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(World);
+	if (ZoneIndex)
+	{
+		ZoneIndex->RegisterSpline(Spline);
+	}
+
+	const float Len = Spline->GetSplineLength();
+	const bool bLoop = Spline->IsClosedLoop();
+	const int32 NumIntervals = FMath::Max(1, FMath::CeilToInt(Len / FMath::Max(50.f, RespawnTableBucketCm)));
+
+	PendingRespawnTable = FRespawnTable();
+	PendingRespawnTable.Spline = Spline;
+	PendingRespawnTable.SplineTransform = Spline->GetComponentTransform();
+	PendingRespawnTable.SplineRevision = FTrackFrameTable::GetSplineRevision(Spline);
+	PendingRespawnTable.LengthCm = Len;
+	PendingRespawnTable.NumPoints = Spline->GetNumberOfSplinePoints();
+	PendingRespawnTable.bClosedLoop = bLoop;
+	PendingRespawnTable.StepCm = Len / NumIntervals;
+	PendingRespawnTable.ClearanceCm = RespawnTableClearanceCm;
+	PendingRespawnTable.ZoneRevision = ZoneIndex ? ZoneIndex->GetRevision() : 0;
+	PendingRespawnTable.Entries.SetNum(bLoop ? NumIntervals : NumIntervals + 1);
+
+	PendingBakeBucket = 0;
+	PendingBakeNumSafe = 0;
+	PendingBakeFrames = 0;
+	PendingBakeStartTime = FPlatformTime::Seconds();
+
+	ScheduleRespawnTableBake();
+	return false;
+}
+
+void URespawnGameInstanceSubsystem::ScheduleRespawnTableBake()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FTimerManager& TM = World->GetTimerManager();
+	if (!TM.TimerExists(RespawnTableBakeTimer))
+	{
+		RespawnTableBakeTimer = TM.SetTimerForNextTick(
+			FTimerDelegate::CreateUObject(this, &URespawnGameInstanceSubsystem::TickRespawnTableBake));
+	}
+}
+
+void URespawnGameInstanceSubsystem::TickRespawnTableBake()
+{
+	// The handle stays valid while this callback runs; drop it so a reschedule is not skipped
+	RespawnTableBakeTimer.Invalidate();
+
+	if (!BakePendingRespawnTable(RespawnTableBakeBudgetMs / 1000.0))
+	{
+		ScheduleRespawnTableBake();
+	}
+}
+
+bool URespawnGameInstanceSubsystem::BakePendingRespawnTable(double BudgetSeconds)
+{
+	check(IsInGameThread());
+
+	UWorld* World = GetWorld();
+	const USplineComponent* Spline = PendingRespawnTable.Spline.Get();
+	if (!World || !Spline || PendingRespawnTable.Entries.Num() == 0)
+	{
+		PendingRespawnTable = FRespawnTable();
+		return true;
+	}
+
+	// Spline or zones changed mid-bake: start over with the current state
+	if (!IsRespawnTableFor(PendingRespawnTable, Spline))
+	{
+		PendingRespawnTable = FRespawnTable();
+		EnsureRespawnTable(Spline);
+		return PendingRespawnTable.Entries.Num() == 0;
+	}
+
+	const double StepStartTime = FPlatformTime::Seconds();
+	++PendingBakeFrames;
+
+	const TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Table = FTrackFrameTable::FindBaked(Spline);
+
+	TArray<AActor*> Ignore;
+	GatherValidActors(NoSpawnZoneActors, Ignore);
+
+	// Zones + surface, once per bucket, until the frame budget is used up
+	const int32 N = PendingRespawnTable.Entries.Num();
+	const int32 FirstBucket = PendingBakeBucket;
+	while (PendingBakeBucket < N)
+	{
+		// Budget checked every 8 buckets; at least one batch per frame so the bake always advances
+		if (BudgetSeconds > 0.0 && PendingBakeBucket != FirstBucket && (PendingBakeBucket & 7) == 0
+			&& FPlatformTime::Seconds() - StepStartTime >= BudgetSeconds)
+		{
+			break;
+		}
+
+		const int32 b = PendingBakeBucket++;
+		FRespawnTableEntry& E = PendingRespawnTable.Entries[b];
+
+		const float S = FMath::Min(b * PendingRespawnTable.StepCm, PendingRespawnTable.LengthCm);
+		E.SplineLocation = GetTrackLocationAtDistance(Spline, Table.Get(), S);
+
+		if (ANoSpawnZoneActor* Blocking = FindBlockingNoSpawnZone(E.SplineLocation, RespawnTableClearanceCm, Spline, S))
+		{
+			E.ExitSign = (Blocking->GetExitMode() == ENoSpawnExitMode::Backward) ? -1 : +1;
+			continue;
+		}
+
+		// No surface below (gap / drop): not a spawn point, keep driving forward
+		FVector SurfaceNormal = FVector::UpVector;
+		if (!TraceTrackSurfaceBelow(World, E.SplineLocation, /*ActorToIgnore*/ nullptr, Ignore, E.SurfacePoint, SurfaceNormal))
+		{
+			E.ExitSign = +1;
+			continue;
+		}
+
+		E.bSafe = true;
+		E.Rotation = MakeRespawnRotationFromSpline(Spline, S);
+		++PendingBakeNumSafe;
+	}
+
+	if (PendingBakeBucket < N)
+	{
+		return false;
+	}
+
+	// Next safe bucket per direction; a second pass wraps around the seam of closed loops
+	TArray<FRespawnTableEntry>& Entries = PendingRespawnTable.Entries;
+	const int32 Passes = PendingRespawnTable.bClosedLoop ? 2 : 1;
+
+	int32 Next = INDEX_NONE;
+	for (int32 i = Passes * N - 1; i >= 0; --i)
+	{
+		const int32 b = i % N;
+		if (Entries[b].bSafe)
+		{
+			Next = b;
+		}
+		Entries[b].NextSafeForward = Next;
+	}
+
+	Next = INDEX_NONE;
+	for (int32 i = 0; i < Passes * N; ++i)
+	{
+		const int32 b = i % N;
+		if (Entries[b].bSafe)
+		{
+			Next = b;
+		}
+		Entries[b].NextSafeBackward = Next;
+	}
+
+	RespawnTable = MoveTemp(PendingRespawnTable);
+	PendingRespawnTable = FRespawnTable();
+
+	if (bDebug)
+		RSP_LOGFMT(Log, "Respawn table baked. Buckets={Buckets}, Safe={Safe}, Frames={Frames}, Ms={Ms}",
+			("Buckets", N),
+			("Safe", PendingBakeNumSafe),
+			("Frames", PendingBakeFrames),
+			("Ms", (FPlatformTime::Seconds() - PendingBakeStartTime) * 1000.0));
+
+	return true;
+}
+
+bool URespawnGameInstanceSubsystem::FindRespawnTransformFromTable(
+	USplineComponent* Spline,
+	float StartDistanceCm,
+	AActor* Actor,
+	FTransform& OutTransform,
+	float& OutSafeDistanceCm
+)
+{
+	if (!Actor || !EnsureRespawnTable(Spline))
+	{
+		return false;
+	}
+
+	const TArray<FRespawnTableEntry>& Entries = RespawnTable.Entries;
+	const int32 N = Entries.Num();
+
+	int32 Bucket = FMath::RoundToInt(WrapOrClampDistance(Spline, StartDistanceCm) / RespawnTable.StepCm);
+	Bucket = RespawnTable.bClosedLoop ? Bucket % N : FMath::Clamp(Bucket, 0, N - 1);
+
+	// Leave the zone in its exit direction; at the end of an open track try the other way
+	const FRespawnTableEntry& Start = Entries[Bucket];
+	int32 SafeBucket = (Start.ExitSign < 0) ? Start.NextSafeBackward : Start.NextSafeForward;
+	if (SafeBucket == INDEX_NONE)
+	{
+		SafeBucket = (Start.ExitSign < 0) ? Start.NextSafeForward : Start.NextSafeBackward;
+	}
+	if (SafeBucket == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FRespawnTableEntry& Safe = Entries[SafeBucket];
+	const float SafeS = FMath::Min(SafeBucket * RespawnTable.StepCm, RespawnTable.LengthCm);
+
+	// Baked with a fixed clearance: wider actors need their own zone check
+	const float ActorRadiusCm = GetActorRadius2D(Actor);
+	if (ActorRadiusCm > RespawnTable.ClearanceCm && FindBlockingNoSpawnZone(Safe.SplineLocation, ActorRadiusCm, Spline, SafeS))
+	{
+		return false;
+	}
+
+	// Validation trace: the surface may have moved or been removed since the bake
+	TArray<AActor*> Ignore;
+	GatherValidActors(NoSpawnZoneActors, Ignore);
+
+	FVector SurfacePoint = Safe.SurfacePoint;
+	FVector SurfaceNormal = FVector::UpVector;
+	if (!TraceTrackSurfaceBelow(GetWorld(), Safe.SplineLocation, Actor, Ignore, SurfacePoint, SurfaceNormal))
+	{
+		if (bDebug)
+			RSP_LOGFMT(Log, "Respawn table: surface gone at S={S}, falling back to search", ("S", SafeS));
+		return false;
+	}
+
+	const float HeightOffsetCm = FMath::Max(RespawnHeightOffsetCm, GetActorHalfHeight(Actor) + 25.f);
+
+	FVector FinalLoc = SurfacePoint;
+	FinalLoc.Z += HeightOffsetCm;
+
+	OutTransform = FTransform(Safe.Rotation, FinalLoc);
+	OutSafeDistanceCm = SafeS;
+	return true;
+}
+
 #include "Kismet/GameplayStatics.h"
 #include "Interfaces/TrackDebugInterface.h"
 // ============================================================================
@@ -541,17 +933,23 @@ void URespawnGameInstanceSubsystem::DoRespawn(TWeakObjectPtr<AActor> ActorToResp
 
 	if (SplineComp)
 	{
-		const float Key = SplineComp->FindInputKeyClosestToWorldLocation(ActorLocation);
-		const float StartS = SplineComp->GetDistanceAlongSplineAtSplineInputKey(Key);
+		// Prefer the track part the car was heading along (loops / crossings)
+		const TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Table = FTrackFrameTable::FindBaked(SplineComp);
+		const float StartS = FindTrackDistanceNear(SplineComp, Table.Get(), ActorLocation, Actor->GetActorForwardVector());
 
 		float SafeS = StartS;
-		bool bSafeOk = FindSafeDistanceOnTrackSpline(SplineComp, StartS, Actor, SafeS);
+		FTransform FinalXf;
+
+		// Baked respawn table: lookup + one validation trace
+		bool bHasTransform = bUseRespawnTable && FindRespawnTransformFromTable(SplineComp, StartS, Actor, FinalXf, SafeS);
+		bool bSafeOk = bHasTransform || FindSafeDistanceOnTrackSpline(SplineComp, StartS, Actor, SafeS);
 
 		// Wenn FindSafeDistanceOnTrackSpline fehlschlägt, versuche FindSafeTrackTransform als Fallback
-		FTransform FinalXf;
-		bool bHasTransform = false;
-		
-		if (bSafeOk)
+		if (bHasTransform)
+		{
+			// Tabellen-Treffer, Transform steht bereits fest
+		}
+		else if (bSafeOk)
 		{
 			// FindSafeDistanceOnTrackSpline hat einen sicheren Punkt gefunden
 			const FVector SplineLoc = SplineComp->GetLocationAtDistanceAlongSpline(SafeS, ESplineCoordinateSpace::World);
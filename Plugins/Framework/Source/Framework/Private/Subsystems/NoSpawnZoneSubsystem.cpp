@@ -0,0 +1,421 @@
+#include "Subsystems/NoSpawnZoneSubsystem.h"
+
+#include "Components/BoxComponent.h"
+#include "Components/SplineComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+// ============================================================================
+// Subsystem lifetime
+// ============================================================================
+void UNoSpawnZoneSubsystem::Deinitialize()
+{
+	{
+		FWriteScopeLock WriteLock(Lock);
+		Shapes.Empty();
+		ZoneIds.Empty();
+		Grid.Empty();
+		SplineIndex.Empty();
+	}
+
+	bSeeded = false;
+
+	Super::Deinitialize();
+}
+
+UNoSpawnZoneSubsystem* UNoSpawnZoneSubsystem::Get(const UWorld* World)
+{
+	UNoSpawnZoneSubsystem* Subsystem = World ? World->GetSubsystem<UNoSpawnZoneSubsystem>() : nullptr;
+
+	// Editor worlds never run BeginPlay: pick up the zones already placed on first use
+	if (Subsystem && !Subsystem->bSeeded && IsInGameThread())
+	{
+		Subsystem->SeedFromWorld();
+	}
+
+	return Subsystem;
+}
+
+void UNoSpawnZoneSubsystem::SeedFromWorld()
+{
+	bSeeded = true;
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	for (TActorIterator<ANoSpawnZoneActor> It(World); It; ++It)
+	{
+		RegisterZone(*It);
+	}
+}
+
+// ============================================================================
+// Zone registration
+// ============================================================================
+void UNoSpawnZoneSubsystem::RegisterZone(ANoSpawnZoneActor* Zone)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(Zone))
+	{
+		return;
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+
+	// Refresh = remove + add (zone may have moved in the editor)
+	if (const int32* Existing = ZoneIds.Find(Zone))
+	{
+		RemoveZoneLocked(*Existing);
+	}
+
+	AddZoneLocked(Zone);
+	++Revision;
+}
+
+void UNoSpawnZoneSubsystem::UnregisterZone(ANoSpawnZoneActor* Zone)
+{
+	check(IsInGameThread());
+
+	FWriteScopeLock WriteLock(Lock);
+
+	if (const int32* Existing = ZoneIds.Find(Zone))
+	{
+		RemoveZoneLocked(*Existing);
+		++Revision;
+	}
+}
+
+void UNoSpawnZoneSubsystem::AddZoneLocked(ANoSpawnZoneActor* Zone)
+{
+	const UBoxComponent* Box = Zone->FindComponentByClass<UBoxComponent>();
+	if (!Box)
+	{
+		return;
+	}
+
+	FZoneShape Shape;
+	Shape.Info.Zone = Zone;
+	Shape.Info.ExitMode = Zone->GetExitMode();
+	Shape.Info.PushDistanceCm = Zone->GetPushDistanceCm();
+	Shape.Info.SafetyExtraCm = Zone->GetSafetyExtraCm();
+	Shape.BoxTransform = Box->GetComponentTransform();
+	Shape.Extent = Box->GetScaledBoxExtent();
+	Shape.Level = Zone->GetLevel();
+
+	// World AABB of the oriented box incl. safety margin
+	const FVector SafeExtent = Shape.Extent + FVector(Shape.Info.SafetyExtraCm);
+	Shape.Bounds = FBox(-SafeExtent, SafeExtent).TransformBy(Shape.BoxTransform);
+
+	const FIntPoint MinCell = CellOf(Shape.Bounds.Min);
+	const FIntPoint MaxCell = CellOf(Shape.Bounds.Max);
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			Shape.Cells.Add(FIntPoint(X, Y));
+		}
+	}
+
+	const int32 ZoneId = Shapes.Add(MoveTemp(Shape));
+	ZoneIds.Add(Zone, ZoneId);
+
+	for (const FIntPoint& Cell : Shapes[ZoneId].Cells)
+	{
+		Grid.FindOrAdd(Cell).Add(ZoneId);
+	}
+
+	for (TPair<const USplineComponent*, FSplineIntervals>& Pair : SplineIndex)
+	{
+		AddZoneIntervalsLocked(Pair.Value, ZoneId);
+	}
+}
+
+void UNoSpawnZoneSubsystem::RemoveZoneLocked(int32 ZoneId)
+{
+	const FZoneShape& Shape = Shapes[ZoneId];
+
+	for (const FIntPoint& Cell : Shape.Cells)
+	{
+		if (TArray<int32>* Ids = Grid.Find(Cell))
+		{
+			Ids->RemoveSingleSwap(ZoneId);
+			if (Ids->IsEmpty())
+			{
+				Grid.Remove(Cell);
+			}
+		}
+	}
+
+	for (TPair<const USplineComponent*, FSplineIntervals>& Pair : SplineIndex)
+	{
+		RemoveZoneIntervalsLocked(Pair.Value, ZoneId);
+	}
+
+	// The actor may already be gone (GC), so look the key up by id
+	for (auto It = ZoneIds.CreateIterator(); It; ++It)
+	{
+		if (It.Value() == ZoneId)
+		{
+			It.RemoveCurrent();
+			break;
+		}
+	}
+
+	Shapes.RemoveAt(ZoneId);
+}
+
+// ============================================================================
+// Spline interval index
+// ============================================================================
+void UNoSpawnZoneSubsystem::RegisterSpline(const USplineComponent* Spline)
+{
+	check(IsInGameThread());
+
+	if (!Spline)
+	{
+		return;
+	}
+
+	const float Length = Spline->GetSplineLength();
+	const int32 NumPoints = Spline->GetNumberOfSplinePoints();
+	const bool bClosedLoop = Spline->IsClosedLoop();
+
+	{
+		FReadScopeLock ReadLock(Lock);
+		const FSplineIntervals* Existing = SplineIndex.Find(Spline);
+		if (Existing && Existing->Spline.IsValid() &&
+			Existing->LengthCm == Length && Existing->NumPoints == NumPoints && Existing->bClosedLoop == bClosedLoop)
+		{
+			return;
+		}
+	}
+
+	if (Length <= 1.f)
+	{
+		return;
+	}
+
+	// Sample outside the lock, zones are tested against these points only
+	FSplineIntervals Intervals;
+	Intervals.Spline = Spline;
+	Intervals.LengthCm = Length;
+	Intervals.NumPoints = NumPoints;
+	Intervals.bClosedLoop = bClosedLoop;
+
+	const int32 NumSteps = FMath::Max(1, FMath::CeilToInt(Length / FMath::Max(10.f, SplineSampleStepCm)));
+	Intervals.StepCm = Length / NumSteps;
+	Intervals.Samples.SetNumUninitialized(NumSteps + 1);
+	for (int32 k = 0; k <= NumSteps; ++k)
+	{
+		Intervals.Samples[k] = Spline->GetLocationAtDistanceAlongSpline(k * Intervals.StepCm, ESplineCoordinateSpace::World);
+	}
+
+	Intervals.Buckets.SetNum(FMath::Max(1, FMath::CeilToInt(Length / FMath::Max(100.f, IntervalBucketCm))));
+
+	FWriteScopeLock WriteLock(Lock);
+
+	// Drop splines that were destroyed (their pointer may get reused)
+	for (auto It = SplineIndex.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().Spline.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (TSparseArray<FZoneShape>::TConstIterator It(Shapes); It; ++It)
+	{
+		AddZoneIntervalsLocked(Intervals, It.GetIndex());
+	}
+
+	SplineIndex.Add(Spline, MoveTemp(Intervals));
+}
+
+void UNoSpawnZoneSubsystem::AddZoneIntervalsLocked(FSplineIntervals& Intervals, int32 ZoneId)
+{
+	const FZoneShape& Shape = Shapes[ZoneId];
+	const FVector PaddedExtent = Shape.Extent + FVector(Shape.Info.SafetyExtraCm + IntervalPaddingCm);
+	const FBox PaddedBounds = FBox(-PaddedExtent, PaddedExtent).TransformBy(Shape.BoxTransform);
+
+	const int32 NumBuckets = Intervals.Buckets.Num();
+	const float BucketCm = Intervals.LengthCm / NumBuckets;
+
+	TBitArray<> Marked(false, NumBuckets);
+
+	auto MarkDistance = [&](float S)
+	{
+		if (Intervals.bClosedLoop)
+		{
+			S = FMath::Fmod(S, Intervals.LengthCm);
+			if (S < 0.f) S += Intervals.LengthCm;
+		}
+		Marked[FMath::Clamp(FMath::FloorToInt(S / BucketCm), 0, NumBuckets - 1)] = true;
+	};
+
+	for (int32 k = 0; k < Intervals.Samples.Num(); ++k)
+	{
+		const FVector& P = Intervals.Samples[k];
+		if (!PaddedBounds.IsInside(P) || !ShapeContains(Shape, P, IntervalPaddingCm))
+		{
+			continue;
+		}
+
+		// One step either side: the zone may start between two samples
+		const float S = k * Intervals.StepCm;
+		MarkDistance(S - Intervals.StepCm);
+		MarkDistance(S);
+		MarkDistance(S + Intervals.StepCm);
+	}
+
+	for (TConstSetBitIterator<> It(Marked); It; ++It)
+	{
+		Intervals.Buckets[It.GetIndex()].Add(ZoneId);
+	}
+}
+
+void UNoSpawnZoneSubsystem::RemoveZoneIntervalsLocked(FSplineIntervals& Intervals, int32 ZoneId)
+{
+	for (TArray<int32>& Bucket : Intervals.Buckets)
+	{
+		Bucket.RemoveSingleSwap(ZoneId);
+	}
+}
+
+// ============================================================================
+// Queries (any thread)
+// ============================================================================
+FIntPoint UNoSpawnZoneSubsystem::CellOf(const FVector& P) const
+{
+	const float Cell = FMath::Max(100.f, CellSizeCm);
+	return FIntPoint(FMath::FloorToInt(P.X / Cell), FMath::FloorToInt(P.Y / Cell));
+}
+
+bool UNoSpawnZoneSubsystem::ShapeContains(const FZoneShape& Shape, const FVector& WorldPoint, float ExtraCm)
+{
+	// Same test as ANoSpawnZoneActor::ContainsPointWithMargin
+	const FVector Local = Shape.BoxTransform.InverseTransformPosition(WorldPoint);
+	const FVector Ext = Shape.Extent + FVector(Shape.Info.SafetyExtraCm + ExtraCm);
+
+	return (FMath::Abs(Local.X) <= Ext.X) &&
+		(FMath::Abs(Local.Y) <= Ext.Y) &&
+		(FMath::Abs(Local.Z) <= Ext.Z);
+}
+
+bool UNoSpawnZoneSubsystem::FindZoneAtPointLocked(
+	const FVector& WorldPoint,
+	float ExtraCm,
+	FNoSpawnZoneHit& OutHit,
+	const ULevel* OnlyLevel
+) const
+{
+	if (Grid.IsEmpty())
+	{
+		return false;
+	}
+
+	// Cells are filled with each zone's own safety margin, only ExtraCm widens the search
+	const FVector Margin(FMath::Max(0.f, ExtraCm));
+	const FIntPoint MinCell = CellOf(WorldPoint - Margin);
+	const FIntPoint MaxCell = CellOf(WorldPoint + Margin);
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<int32>* Ids = Grid.Find(FIntPoint(X, Y));
+			if (!Ids)
+			{
+				continue;
+			}
+
+			for (int32 ZoneId : *Ids)
+			{
+				const FZoneShape& Shape = Shapes[ZoneId];
+				if (OnlyLevel && Shape.Level != OnlyLevel)
+				{
+					continue;
+				}
+
+				if (ShapeContains(Shape, WorldPoint, ExtraCm))
+				{
+					OutHit = Shape.Info;
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+bool UNoSpawnZoneSubsystem::FindZoneAtPoint(
+	const FVector& WorldPoint,
+	float ExtraCm,
+	FNoSpawnZoneHit& OutHit,
+	const ULevel* OnlyLevel
+) const
+{
+	FReadScopeLock ReadLock(Lock);
+	return FindZoneAtPointLocked(WorldPoint, ExtraCm, OutHit, OnlyLevel);
+}
+
+bool UNoSpawnZoneSubsystem::IsPointBlocked(const FVector& WorldPoint, float ExtraCm, const ULevel* OnlyLevel) const
+{
+	FNoSpawnZoneHit Hit;
+	return FindZoneAtPoint(WorldPoint, ExtraCm, Hit, OnlyLevel);
+}
+
+bool UNoSpawnZoneSubsystem::FindZoneAtDistance(
+	const USplineComponent* Spline,
+	float DistanceCm,
+	const FVector& WorldPoint,
+	float ExtraCm,
+	FNoSpawnZoneHit& OutHit
+) const
+{
+	FReadScopeLock ReadLock(Lock);
+
+	const FSplineIntervals* Intervals = SplineIndex.Find(Spline);
+	if (!Intervals || ExtraCm > IntervalPaddingCm)
+	{
+		return FindZoneAtPointLocked(WorldPoint, ExtraCm, OutHit, nullptr);
+	}
+
+	float S = DistanceCm;
+	if (Intervals->bClosedLoop)
+	{
+		S = FMath::Fmod(S, Intervals->LengthCm);
+		if (S < 0.f) S += Intervals->LengthCm;
+	}
+
+	const int32 NumBuckets = Intervals->Buckets.Num();
+	const int32 Bucket = FMath::Clamp(FMath::FloorToInt(S * NumBuckets / Intervals->LengthCm), 0, NumBuckets - 1);
+
+	for (int32 ZoneId : Intervals->Buckets[Bucket])
+	{
+		const FZoneShape& Shape = Shapes[ZoneId];
+		if (ShapeContains(Shape, WorldPoint, ExtraCm))
+		{
+			OutHit = Shape.Info;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32 UNoSpawnZoneSubsystem::GetNumZones() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Shapes.Num();
+}
+
+uint32 UNoSpawnZoneSubsystem::GetRevision() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Revision;
+}
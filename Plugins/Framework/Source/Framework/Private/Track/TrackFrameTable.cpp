@@ -0,0 +1,614 @@
+#include "Track/TrackFrameTable.h"
+
+#include "Components/SplineComponent.h"
+#include "Algo/Unique.h"
+#include "Interfaces/RoadSplineInterface.h"
+#include "UObject/ObjectKey.h"
+
+/** Shape revision per spline, bumped by MarkSplineEdited (game thread only) */
+static TMap<FObjectKey, uint32> GSplineRevisions;
+static uint32 GLastSplineRevision = 0;
+
+// ============================================================================
+// Build
+// ============================================================================
+TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> FTrackFrameTable::Build(
+	const USplineComponent* Spline,
+	float InStepCm,
+	float InCurvatureWindowCm,
+	const FHalfWidthFunc& HalfWidthAtDistance
+)
+{
+	check(IsInGameThread());
+
+	if (!Spline)
+	{
+		return nullptr;
+	}
+
+	const float Length = Spline->GetSplineLength();
+	if (Length <= 1.f)
+	{
+		return nullptr;
+	}
+
+	TSharedRef<FTrackFrameTable, ESPMode::ThreadSafe> Table = MakeShared<FTrackFrameTable, ESPMode::ThreadSafe>();
+	Table->SourceSpline = Spline;
+	Table->SourceTransform = Spline->GetComponentTransform();
+	Table->SourceRevision = GetSplineRevision(Spline);
+	Table->LengthCm = Length;
+	Table->bClosedLoop = Spline->IsClosedLoop();
+	Table->CurvatureWindowCm = FMath::Max(10.f, InCurvatureWindowCm);
+
+	// Closed loops don't duplicate the start sample
+	const int32 NumSteps = FMath::Max(2, FMath::CeilToInt(Length / FMath::Max(InStepCm, 1.f)));
+	const int32 N = Table->bClosedLoop ? NumSteps : NumSteps + 1;
+	Table->StepCm = Length / NumSteps;
+	Table->InvStepCm = 1.f / Table->StepCm;
+
+	Table->Position.SetNumUninitialized(N);
+	Table->Tangent.SetNumUninitialized(N);
+	Table->Right.SetNumUninitialized(N);
+	Table->Up.SetNumUninitialized(N);
+	Table->Curvature.SetNumUninitialized(N);
+	Table->Slope.SetNumUninitialized(N);
+	Table->HalfWidth.SetNumUninitialized(N);
+
+	for (int32 k = 0; k < N; ++k)
+	{
+		const float Dist = FMath::Min(k * Table->StepCm, Length);
+
+		FVector T = Spline->GetDirectionAtDistanceAlongSpline(Dist, ESplineCoordinateSpace::World).GetSafeNormal();
+		if (T.IsNearlyZero())
+		{
+			T = FVector::ForwardVector;
+		}
+
+		// Spline rotation for banking, then orthonormalize around the tangent
+		const FVector SplineUp = Spline->GetRotationAtDistanceAlongSpline(Dist, ESplineCoordinateSpace::World).RotateVector(FVector::UpVector);
+		FVector R = FVector::CrossProduct(SplineUp, T).GetSafeNormal();
+		if (R.IsNearlyZero())
+		{
+			R = FVector::CrossProduct(FVector::UpVector, T).GetSafeNormal();
+		}
+
+		Table->Position[k] = Spline->GetLocationAtDistanceAlongSpline(Dist, ESplineCoordinateSpace::World);
+		Table->Tangent[k] = T;
+		Table->Right[k] = R;
+		Table->Up[k] = FVector::CrossProduct(T, R).GetSafeNormal();
+		Table->Slope[k] = T.Z;
+		Table->HalfWidth[k] = HalfWidthAtDistance ? HalfWidthAtDistance(Dist) : 0.f;
+	}
+
+	// Curvature from the baked tangents (no further spline evaluation)
+	for (int32 k = 0; k < N; ++k)
+	{
+		Table->Curvature[k] = Table->ComputeCurvatureInvCm(k * Table->StepCm, Table->CurvatureWindowCm);
+	}
+
+	Table->BuildSpatialHash();
+
+	return Table;
+}
+
+TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> FTrackFrameTable::FindBaked(const USplineComponent* Spline)
+{
+	if (!Spline)
+	{
+		return nullptr;
+	}
+
+	const IRoadSplineInterface* Provider = Cast<IRoadSplineInterface>(Spline->GetOwner());
+	if (!Provider)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Table = Provider->GetTrackFrameTable();
+	return (Table.IsValid() && Table->IsUpToDate(Spline)) ? Table : nullptr;
+}
+
+TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> FTrackFrameTable::FindOrBuild(const USplineComponent* Spline, float InStepCm)
+{
+	if (TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Baked = FindBaked(Spline))
+	{
+		return Baked;
+	}
+
+	return Build(Spline, InStepCm);
+}
+
+bool FTrackFrameTable::IsUpToDate(const USplineComponent* Spline) const
+{
+	return Spline && SourceSpline.Get() == Spline &&
+		FMath::IsNearlyEqual(LengthCm, Spline->GetSplineLength(), 0.1f) &&
+		bClosedLoop == Spline->IsClosedLoop() &&
+		SourceRevision == GetSplineRevision(Spline) &&
+		SourceTransform.Equals(Spline->GetComponentTransform(), 0.01);
+}
+
+uint32 FTrackFrameTable::GetSplineRevision(const USplineComponent* Spline)
+{
+	check(IsInGameThread());
+
+	const uint32* Revision = Spline ? GSplineRevisions.Find(FObjectKey(Spline)) : nullptr;
+	return Revision ? *Revision : 0;
+}
+
+void FTrackFrameTable::MarkSplineEdited(const USplineComponent* Spline)
+{
+	check(IsInGameThread());
+
+	if (!Spline)
+	{
+		return;
+	}
+
+	// Destroyed splines leave their entry behind, drop those now and then
+	if (GSplineRevisions.Num() >= 64)
+	{
+		for (auto It = GSplineRevisions.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	// Unique across splines: a pruned and re-added entry never repeats an old revision
+	GSplineRevisions.Add(FObjectKey(Spline), ++GLastSplineRevision);
+}
+
+void FTrackFrameTable::BuildSpatialHash()
+{
+	// A few segments per cell, cells well above a car length
+	HashCellCm = FMath::Max(1000.f, 8.f * StepCm);
+	SegmentHash.Reset();
+
+	const int32 N = Position.Num();
+	for (int32 K = 0; K < GetNumSegments(); ++K)
+	{
+		const FIntVector C0 = CellOf(Position[K]);
+		const FIntVector C1 = CellOf(Position[(K + 1) % N]);
+
+		// Segments are much shorter than a cell: at most a few cells each
+		for (int32 X = FMath::Min(C0.X, C1.X); X <= FMath::Max(C0.X, C1.X); ++X)
+		{
+			for (int32 Y = FMath::Min(C0.Y, C1.Y); Y <= FMath::Max(C0.Y, C1.Y); ++Y)
+			{
+				for (int32 Z = FMath::Min(C0.Z, C1.Z); Z <= FMath::Max(C0.Z, C1.Z); ++Z)
+				{
+					SegmentHash.FindOrAdd(FIntVector(X, Y, Z)).Add(K);
+				}
+			}
+		}
+	}
+
+	SegmentHash.Compact();
+}
+
+FIntVector FTrackFrameTable::CellOf(const FVector& P) const
+{
+	return FIntVector(
+		FMath::FloorToInt(P.X / HashCellCm),
+		FMath::FloorToInt(P.Y / HashCellCm),
+		FMath::FloorToInt(P.Z / HashCellCm));
+}
+
+// ============================================================================
+// Lookup (any thread)
+// ============================================================================
+float FTrackFrameTable::WrapDistance(float S) const
+{
+	if (LengthCm <= 1.f)
+	{
+		return 0.f;
+	}
+
+	if (bClosedLoop)
+	{
+		float X = FMath::Fmod(S, LengthCm);
+		if (X < 0.f) X += LengthCm;
+		return X;
+	}
+
+	return FMath::Clamp(S, 0.f, LengthCm);
+}
+
+void FTrackFrameTable::Locate(float S, int32& OutIndex0, int32& OutIndex1, float& OutAlpha) const
+{
+	const int32 N = Position.Num();
+	const float U = WrapDistance(S) * InvStepCm;
+
+	OutIndex0 = FMath::Clamp(FMath::FloorToInt(U), 0, N - 1);
+	OutAlpha = FMath::Clamp(U - OutIndex0, 0.f, 1.f);
+	OutIndex1 = bClosedLoop ? (OutIndex0 + 1) % N : FMath::Min(OutIndex0 + 1, N - 1);
+}
+
+FTrackFrameSample FTrackFrameTable::Sample(float S) const
+{
+	FTrackFrameSample Out;
+	if (!IsValid())
+	{
+		return Out;
+	}
+
+	int32 I0, I1;
+	float Alpha;
+	Locate(S, I0, I1, Alpha);
+
+	Out.Position = FMath::Lerp(Position[I0], Position[I1], Alpha);
+	Out.Tangent = FMath::Lerp(Tangent[I0], Tangent[I1], Alpha).GetSafeNormal();
+	Out.Right = FMath::Lerp(Right[I0], Right[I1], Alpha).GetSafeNormal();
+	Out.Up = FMath::Lerp(Up[I0], Up[I1], Alpha).GetSafeNormal();
+	Out.CurvatureInvCm = FMath::Lerp(Curvature[I0], Curvature[I1], Alpha);
+	Out.SlopeZ = FMath::Lerp(Slope[I0], Slope[I1], Alpha);
+	Out.HalfWidthCm = FMath::Lerp(HalfWidth[I0], HalfWidth[I1], Alpha);
+	return Out;
+}
+
+void FTrackFrameTable::SampleFrame(float S, FVector& OutPosition, FVector& OutTangent, FVector& OutRight, FVector& OutUp) const
+{
+	if (!IsValid())
+	{
+		OutPosition = FVector::ZeroVector;
+		OutTangent = FVector::ForwardVector;
+		OutRight = FVector::RightVector;
+		OutUp = FVector::UpVector;
+		return;
+	}
+
+	int32 I0, I1;
+	float Alpha;
+	Locate(S, I0, I1, Alpha);
+
+	OutPosition = FMath::Lerp(Position[I0], Position[I1], Alpha);
+	OutTangent = FMath::Lerp(Tangent[I0], Tangent[I1], Alpha).GetSafeNormal();
+	OutRight = FMath::Lerp(Right[I0], Right[I1], Alpha).GetSafeNormal();
+	OutUp = FMath::Lerp(Up[I0], Up[I1], Alpha).GetSafeNormal();
+}
+
+FVector FTrackFrameTable::GetLocationAtDistance(float S) const
+{
+	if (!IsValid())
+	{
+		return FVector::ZeroVector;
+	}
+
+	int32 I0, I1;
+	float Alpha;
+	Locate(S, I0, I1, Alpha);
+	return FMath::Lerp(Position[I0], Position[I1], Alpha);
+}
+
+FVector FTrackFrameTable::GetDirectionAtDistance(float S) const
+{
+	if (!IsValid())
+	{
+		return FVector::ForwardVector;
+	}
+
+	int32 I0, I1;
+	float Alpha;
+	Locate(S, I0, I1, Alpha);
+	return FMath::Lerp(Tangent[I0], Tangent[I1], Alpha).GetSafeNormal();
+}
+
+FVector FTrackFrameTable::GetRightAtDistance(float S) const
+{
+	if (!IsValid())
+	{
+		return FVector::RightVector;
+	}
+
+	int32 I0, I1;
+	float Alpha;
+	Locate(S, I0, I1, Alpha);
+	return FMath::Lerp(Right[I0], Right[I1], Alpha).GetSafeNormal();
+}
+
+FVector FTrackFrameTable::GetUpAtDistance(float S) const
+{
+	if (!IsValid())
+	{
+		return FVector::UpVector;
+	}
+
+	int32 I0, I1;
+	float Alpha;
+	Locate(S, I0, I1, Alpha);
+	return FMath::Lerp(Up[I0], Up[I1], Alpha).GetSafeNormal();
+}
+
+float FTrackFrameTable::GetCurvatureAtDistance(float S) const
+{
+	if (!IsValid())
+	{
+		return 0.f;
+	}
+
+	int32 I0, I1;
+	float Alpha;
+	Locate(S, I0, I1, Alpha);
+	return FMath::Lerp(Curvature[I0], Curvature[I1], Alpha);
+}
+
+float FTrackFrameTable::ComputeCurvatureInvCm(float S, float WindowCm) const
+{
+	if (!IsValid())
+	{
+		return 0.f;
+	}
+
+	const float W = FMath::Max(10.f, WindowCm);
+
+	// WrapDistance wraps (loop) or clamps the window ends
+	const FVector F0 = GetDirectionAtDistance(S - W);
+	const FVector F1 = GetDirectionAtDistance(S + W);
+
+	const float AngleRad = FMath::Acos(FMath::Clamp(FVector::DotProduct(F0, F1), -1.f, 1.f));
+	return AngleRad / FMath::Max(1.f, 2.f * W); // 1/cm
+}
+
+float FTrackFrameTable::GetSlopeAtDistance(float S) const
+{
+	if (!IsValid())
+	{
+		return 0.f;
+	}
+
+	int32 I0, I1;
+	float Alpha;
+	Locate(S, I0, I1, Alpha);
+	return FMath::Lerp(Slope[I0], Slope[I1], Alpha);
+}
+
+float FTrackFrameTable::GetHalfWidthAtDistance(float S) const
+{
+	if (!IsValid())
+	{
+		return 0.f;
+	}
+
+	int32 I0, I1;
+	float Alpha;
+	Locate(S, I0, I1, Alpha);
+	return FMath::Lerp(HalfWidth[I0], HalfWidth[I1], Alpha);
+}
+
+// ============================================================================
+// Closest point (any thread)
+// ============================================================================
+float FTrackFrameTable::ProjectOnSegment(const FVector& WorldPoint, int32 K, float& OutT) const
+{
+	const FVector& A = Position[K];
+	const FVector AB = Position[(K + 1) % Position.Num()] - A;
+
+	const float LenSq = AB.SizeSquared();
+	OutT = (LenSq > KINDA_SMALL_NUMBER) ? FMath::Clamp(FVector::DotProduct(WorldPoint - A, AB) / LenSq, 0.f, 1.f) : 0.f;
+	return FVector::DistSquared(A + AB * OutT, WorldPoint);
+}
+
+void FTrackFrameTable::ScanSegments(const FVector& WorldPoint, int32 First, int32 Count, int32& InOutBestSegment, float& InOutBestT, float& InOutBestDistSq) const
+{
+	const int32 N = Position.Num();
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const int32 K = (First + i) % N;
+
+		float T;
+		const float DistSq = ProjectOnSegment(WorldPoint, K, T);
+
+		if (DistSq < InOutBestDistSq)
+		{
+			InOutBestDistSq = DistSq;
+			InOutBestSegment = K;
+			InOutBestT = T;
+		}
+	}
+}
+
+float FTrackFrameTable::FindClosestDistance(const FVector& WorldPoint, float HintS, float WindowCm, float* OutDistSq) const
+{
+	if (!IsValid())
+	{
+		if (OutDistSq) *OutDistSq = 0.f;
+		return 0.f;
+	}
+
+	const int32 NumSegments = GetNumSegments();
+
+	int32 BestSegment = 0;
+	float BestT = 0.f;
+	float BestDistSq = TNumericLimits<float>::Max();
+
+	bool bSearched = false;
+	if (HintS >= 0.f && WindowCm > 0.f)
+	{
+		const int32 HalfCount = FMath::CeilToInt(WindowCm * InvStepCm);
+		if (2 * HalfCount + 1 < NumSegments)
+		{
+			const int32 Center = FMath::Clamp(FMath::FloorToInt(WrapDistance(HintS) * InvStepCm), 0, NumSegments - 1);
+
+			int32 First = Center - HalfCount;
+			int32 Count = 2 * HalfCount + 1;
+			if (bClosedLoop)
+			{
+				First = (First % NumSegments + NumSegments) % NumSegments;
+			}
+			else
+			{
+				First = FMath::Max(First, 0);
+				Count = FMath::Min(Center + HalfCount, NumSegments - 1) - First + 1;
+			}
+
+			ScanSegments(WorldPoint, First, Count, BestSegment, BestT, BestDistSq);
+
+			// Minimum on the window edge (not a spline end): the point left the window
+			const bool bAtFirst = BestSegment == First && BestT <= 0.f && (bClosedLoop || First > 0);
+			const int32 Last = (First + Count - 1) % Position.Num();
+			const bool bAtLast = BestSegment == Last && BestT >= 1.f && (bClosedLoop || Last < NumSegments - 1);
+			bSearched = !(bAtFirst || bAtLast);
+		}
+	}
+
+	if (!bSearched)
+	{
+		BestDistSq = TNumericLimits<float>::Max();
+		ScanSegments(WorldPoint, 0, NumSegments, BestSegment, BestT, BestDistSq);
+	}
+
+	if (OutDistSq) *OutDistSq = BestDistSq;
+	return WrapDistance((BestSegment + BestT) * StepCm);
+}
+
+// ============================================================================
+// Relocalization (any thread)
+// ============================================================================
+void FTrackFrameTable::GatherSegments(const FVector& WorldPoint, float RadiusCm, TArray<int32>& OutSegments) const
+{
+	OutSegments.Reset();
+
+	const FIntVector Lo = CellOf(WorldPoint - FVector(RadiusCm));
+	const FIntVector Hi = CellOf(WorldPoint + FVector(RadiusCm));
+
+	for (int32 X = Lo.X; X <= Hi.X; ++X)
+	{
+		for (int32 Y = Lo.Y; Y <= Hi.Y; ++Y)
+		{
+			for (int32 Z = Lo.Z; Z <= Hi.Z; ++Z)
+			{
+				if (const TArray<int32>* Cell = SegmentHash.Find(FIntVector(X, Y, Z)))
+				{
+					OutSegments.Append(*Cell);
+				}
+			}
+		}
+	}
+
+	// Segments spanning two cells show up twice
+	OutSegments.Sort();
+	OutSegments.SetNum(Algo::Unique(OutSegments));
+}
+
+void FTrackFrameTable::FindCandidateIntervals(const FVector& WorldPoint, float RadiusCm, const FVector& Forward, float MinHeadingDot, TArray<FFloatInterval>& OutIntervals) const
+{
+	OutIntervals.Reset();
+	if (!IsValid())
+	{
+		return;
+	}
+
+	TArray<int32> Segments;
+	GatherSegments(WorldPoint, RadiusCm, Segments);
+
+	const FVector Fwd = Forward.GetSafeNormal();
+	const float RadiusSq = FMath::Square(RadiusCm);
+
+	int32 RunStart = INDEX_NONE;
+	int32 RunEnd = INDEX_NONE;
+
+	auto FlushRun = [&]()
+	{
+		if (RunStart != INDEX_NONE)
+		{
+			OutIntervals.Add(FFloatInterval(RunStart * StepCm, FMath::Min((RunEnd + 1) * StepCm, LengthCm)));
+		}
+	};
+
+	for (const int32 K : Segments)
+	{
+		float T;
+		if (ProjectOnSegment(WorldPoint, K, T) > RadiusSq)
+		{
+			continue;
+		}
+		if (!Fwd.IsZero() && FVector::DotProduct(Tangent[K], Fwd) < MinHeadingDot)
+		{
+			continue;
+		}
+
+		if (RunStart != INDEX_NONE && K == RunEnd + 1)
+		{
+			RunEnd = K;
+			continue;
+		}
+
+		FlushRun();
+		RunStart = RunEnd = K;
+	}
+	FlushRun();
+
+	// Closed loop: join the run ending at the seam with the one starting at 0
+	if (bClosedLoop && OutIntervals.Num() > 1 &&
+		OutIntervals[0].Min <= 0.f && OutIntervals.Last().Max >= LengthCm)
+	{
+		OutIntervals.Last().Max = LengthCm + OutIntervals[0].Max;
+		OutIntervals.RemoveAt(0);
+	}
+}
+
+float FTrackFrameTable::Relocalize(const FVector& WorldPoint, const FVector& Forward, float RadiusCm, float MinHeadingDot, float* OutDistSq) const
+{
+	if (!IsValid())
+	{
+		if (OutDistSq) *OutDistSq = 0.f;
+		return 0.f;
+	}
+
+	TArray<int32> Segments;
+	GatherSegments(WorldPoint, RadiusCm, Segments);
+
+	const FVector Fwd = Forward.GetSafeNormal();
+	const float RadiusSq = FMath::Square(RadiusCm);
+
+	// Best heading-consistent segment and best segment overall (both within the radius)
+	int32 BestAgree = INDEX_NONE;
+	float BestAgreeT = 0.f;
+	float BestAgreeDistSq = TNumericLimits<float>::Max();
+
+	int32 BestAny = INDEX_NONE;
+	float BestAnyT = 0.f;
+	float BestAnyDistSq = TNumericLimits<float>::Max();
+
+	for (const int32 K : Segments)
+	{
+		float T;
+		const float DistSq = ProjectOnSegment(WorldPoint, K, T);
+		if (DistSq > RadiusSq)
+		{
+			continue;
+		}
+
+		if (DistSq < BestAnyDistSq)
+		{
+			BestAny = K;
+			BestAnyT = T;
+			BestAnyDistSq = DistSq;
+		}
+
+		const bool bAgrees = Fwd.IsZero() || FVector::DotProduct(Tangent[K], Fwd) >= MinHeadingDot;
+		if (bAgrees && DistSq < BestAgreeDistSq)
+		{
+			BestAgree = K;
+			BestAgreeT = T;
+			BestAgreeDistSq = DistSq;
+		}
+	}
+
+	if (BestAgree != INDEX_NONE)
+	{
+		if (OutDistSq) *OutDistSq = BestAgreeDistSq;
+		return WrapDistance((BestAgree + BestAgreeT) * StepCm);
+	}
+	if (BestAny != INDEX_NONE)
+	{
+		if (OutDistSq) *OutDistSq = BestAnyDistSq;
+		return WrapDistance((BestAny + BestAnyT) * StepCm);
+	}
+
+	// Nothing nearby (far off track): full scan
+	return FindClosestDistance(WorldPoint, -1.f, 0.f, OutDistSq);
+}
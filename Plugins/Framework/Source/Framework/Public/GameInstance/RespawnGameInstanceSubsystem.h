@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/World.h"
 #include "RespawnGameInstanceSubsystem.generated.h"
 
 class USplineComponent;
@@ -17,6 +18,13 @@ class ANoSpawnZoneActor;
  * Track spline discovery:
  * - Finds an actor tagged "Track" that implements URoadSplineInterface
  * - Caches it (weak) and refreshes if invalid
+ *
+ * Respawn table:
+ * - Baked per track when the level's actors are initialized, when no-spawn zones (un)register and when a
+ *   respawn finds it stale; the bake is spread over frames (RespawnTableBakeBudgetMs per frame)
+ * - BakeRespawnTable bakes synchronously, e.g. once a track finished building
+ * - Per distance bucket: next safe bucket in both exit directions, pre-traced surface and rotation
+ * - A respawn is a lookup plus one validation trace; the iterative search is the fallback
  */
 UCLASS()
 class FRAMEWORK_API URespawnGameInstanceSubsystem : public UGameInstanceSubsystem
@@ -59,13 +67,77 @@ public:
 		float SafetyExtraCm = 100.f
 	);
 
+	/** Bake the respawn table of the current track now, in one call (e.g. once the track finished loading) */
+	UFUNCTION(BlueprintCallable, Category = "Respawn")
+	bool BakeRespawnTable();
+
 protected:
 	void AddUISupportForRespawn();
 
 private:
 	void DoRespawn(TWeakObjectPtr<AActor> ActorToRespawn, FVector ActorLocation);
 
-	ANoSpawnZoneActor* FindBlockingNoSpawnZone(const FVector& WorldPoint, float ActorRadiusCm);
+	/** Zone lookup via UNoSpawnZoneSubsystem; with a spline the distance interval index is used */
+	ANoSpawnZoneActor* FindBlockingNoSpawnZone(
+		const FVector& WorldPoint,
+		float ActorRadiusCm,
+		const USplineComponent* Spline = nullptr,
+		float DistanceCm = 0.f
+	);
+
+	/** One distance bucket of the respawn table */
+	struct FRespawnTableEntry
+	{
+		int32 NextSafeForward = INDEX_NONE;  // first safe bucket at or after this one (wraps on loops)
+		int32 NextSafeBackward = INDEX_NONE; // first safe bucket at or before this one (wraps on loops)
+		int8 ExitSign = 0;                   // exit direction of the blocking zone (+1 if blocked by a missing surface)
+		bool bSafe = false;                  // outside all zones (plus clearance) with track surface below
+		FVector SplineLocation = FVector::ZeroVector;
+		FVector SurfacePoint = FVector::ZeroVector;
+		FQuat Rotation = FQuat::Identity;
+	};
+
+	/** Respawn table of one spline, valid for its revision and placement (as FTrackFrameTable) and one zone index revision */
+	struct FRespawnTable
+	{
+		TWeakObjectPtr<const USplineComponent> Spline;
+		FTransform SplineTransform;
+		uint32 SplineRevision = 0;
+		float LengthCm = 0.f;
+		int32 NumPoints = 0;
+		bool bClosedLoop = false;
+		float StepCm = 0.f;
+		float ClearanceCm = 0.f;
+		uint32 ZoneRevision = 0;
+		TArray<FRespawnTableEntry> Entries;
+	};
+
+	/** True if RespawnTable is current for Spline; otherwise starts (or continues) a bake over the next frames (game thread only) */
+	bool EnsureRespawnTable(const USplineComponent* Spline);
+
+	/** EnsureRespawnTable for the current track spline, if the table is enabled */
+	void RequestRespawnTableBake();
+
+	void HandleWorldInitializedActors(const UWorld::FActorsInitializedParams& Params);
+
+	/** Table was baked for Spline's current revision and placement, the current zone revision and clearance */
+	bool IsRespawnTableFor(const FRespawnTable& Table, const USplineComponent* Spline) const;
+
+	/** Bake step on the next tick, unless one is already scheduled */
+	void ScheduleRespawnTableBake();
+	void TickRespawnTableBake();
+
+	/** Bake buckets of PendingRespawnTable for up to BudgetSeconds (0 = no limit); true once nothing is left to bake */
+	bool BakePendingRespawnTable(double BudgetSeconds);
+
+	/** Table lookup from StartDistanceCm plus one validation trace; false if the caller should search instead */
+	bool FindRespawnTransformFromTable(
+		USplineComponent* Spline,
+		float StartDistanceCm,
+		AActor* Actor,
+		FTransform& OutTransform,
+		float& OutSafeDistanceCm
+	);
 
 private:
 	/** Respawn delay in seconds */
@@ -93,4 +165,32 @@ private:
 	/** Cached track spline provider actor (weak) */
 	UPROPERTY(Transient)
 	TWeakObjectPtr<AActor> CachedTrackProviderActor;
+
+	/** Respawn via the baked table (the iterative search stays as fallback) */
+	UPROPERTY(EditAnywhere, Category = "Respawn|Table")
+	bool bUseRespawnTable = true;
+
+	/** Distance bucket length of the respawn table */
+	UPROPERTY(EditAnywhere, Category = "Respawn|Table", meta = (ClampMin = 50.0))
+	float RespawnTableBucketCm = 200.f;
+
+	/** Distance a bucket needs from every no-spawn zone to count as safe (about one car length) */
+	UPROPERTY(EditAnywhere, Category = "Respawn|Table", meta = (ClampMin = 0.0))
+	float RespawnTableClearanceCm = 400.f;
+
+	/** Time per frame spent baking the respawn table */
+	UPROPERTY(EditAnywhere, Category = "Respawn|Table", meta = (ClampMin = 0.1))
+	float RespawnTableBakeBudgetMs = 1.f;
+
+	FRespawnTable RespawnTable;
+
+	/** Table being baked; replaces RespawnTable once all buckets are done */
+	FRespawnTable PendingRespawnTable;
+	int32 PendingBakeBucket = 0;
+	int32 PendingBakeNumSafe = 0;
+	int32 PendingBakeFrames = 0;
+	double PendingBakeStartTime = 0.0;
+
+	FTimerHandle RespawnTableBakeTimer;
+	FDelegateHandle WorldInitializedActorsHandle;
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Interface.h"
+#include "Track/TrackFrameTable.h"
 #include "RoadSplineInterface.generated.h"
 
 // This class does not need to be modified.
@@ -23,4 +24,7 @@ class FRAMEWORK_API IRoadSplineInterface
 public:
 	UFUNCTION(BlueprintCallable, BlueprintNativeEvent, Category = Default)
 	class USplineComponent* GetRoadSpline() const;
+
+	/** Baked frame table of the road spline, null if the provider doesn't bake one (C++ only, game thread) */
+	virtual TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> GetTrackFrameTable() const { return nullptr; }
 };
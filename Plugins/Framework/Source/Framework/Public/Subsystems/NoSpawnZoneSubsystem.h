@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Misc/ScopeRWLock.h"
+#include "Actors/NoSpawnZoneActor.h"
+#include "NoSpawnZoneSubsystem.generated.h"
+
+class USplineComponent;
+class ULevel;
+
+/** Result of a zone query (plain data, safe to copy on any thread) */
+struct FNoSpawnZoneHit
+{
+	/** Only dereference on the game thread */
+	TWeakObjectPtr<ANoSpawnZoneActor> Zone;
+
+	ENoSpawnExitMode ExitMode = ENoSpawnExitMode::Backward;
+	float PushDistanceCm = 0.f;
+	float SafetyExtraCm = 0.f;
+};
+
+/**
+ * World-level spatial index over all ANoSpawnZoneActors.
+ *
+ * - Uniform XY grid over the zone bounds for point queries
+ * - Per registered spline, a bucketed interval index over distance along the spline
+ *
+ * Zones are added/removed incrementally (construction in the editor, BeginPlay/EndPlay and
+ * URespawnGameInstanceSubsystem::RegisterNoSpawnZone at runtime). The index only holds plain
+ * data behind a read/write lock: writes happen on the game thread, queries may run on any
+ * thread (e.g. inside ParallelFor).
+ */
+UCLASS()
+class FRAMEWORK_API UNoSpawnZoneSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	/** Subsystem of World with all zones already in the world indexed (game thread only) */
+	static UNoSpawnZoneSubsystem* Get(const UWorld* World);
+
+	/** Add or refresh a zone (game thread only) */
+	void RegisterZone(ANoSpawnZoneActor* Zone);
+
+	/** Remove a zone (game thread only) */
+	void UnregisterZone(ANoSpawnZoneActor* Zone);
+
+	/** Build the distance interval index for Spline, or refresh it if the spline changed (game thread only) */
+	void RegisterSpline(const USplineComponent* Spline);
+
+	/**
+	 * First zone containing WorldPoint (zone SafetyExtraCm + ExtraCm).
+	 * OnlyLevel restricts the query to zones of one level (never dereferenced).
+	 */
+	bool FindZoneAtPoint(const FVector& WorldPoint, float ExtraCm, FNoSpawnZoneHit& OutHit, const ULevel* OnlyLevel = nullptr) const;
+
+	bool IsPointBlocked(const FVector& WorldPoint, float ExtraCm = 0.f, const ULevel* OnlyLevel = nullptr) const;
+
+	/**
+	 * Same test, prefiltered by the interval index of Spline at DistanceCm (WorldPoint is the
+	 * spline point there). Falls back to the grid if Spline is not registered or ExtraCm exceeds
+	 * the interval padding.
+	 */
+	bool FindZoneAtDistance(const USplineComponent* Spline, float DistanceCm, const FVector& WorldPoint, float ExtraCm, FNoSpawnZoneHit& OutHit) const;
+
+	int32 GetNumZones() const;
+
+	/** Bumped on every zone add / refresh / remove (lets callers invalidate data derived from the zones) */
+	uint32 GetRevision() const;
+
+	/** Grid cell size (XY) */
+	UPROPERTY(EditAnywhere, Category = "NoSpawn|Index", meta = (ClampMin = 100.0))
+	float CellSizeCm = 2500.f;
+
+	/** Spline sampling step when computing a zone's distance intervals */
+	UPROPERTY(EditAnywhere, Category = "NoSpawn|Index", meta = (ClampMin = 10.0))
+	float SplineSampleStepCm = 50.f;
+
+	/** Extra margin baked into the intervals, covers ExtraCm of distance queries (e.g. actor radius) */
+	UPROPERTY(EditAnywhere, Category = "NoSpawn|Index", meta = (ClampMin = 0.0))
+	float IntervalPaddingCm = 500.f;
+
+	/** Bucket length of the distance interval index */
+	UPROPERTY(EditAnywhere, Category = "NoSpawn|Index", meta = (ClampMin = 100.0))
+	float IntervalBucketCm = 1000.f;
+
+private:
+	struct FZoneShape
+	{
+		FNoSpawnZoneHit Info;
+		FTransform BoxTransform;
+		FVector Extent = FVector::ZeroVector; // scaled box extent, without safety margin
+		FBox Bounds;                          // world AABB incl. safety margin
+		const ULevel* Level = nullptr;
+		TArray<FIntPoint> Cells;
+	};
+
+	struct FSplineIntervals
+	{
+		TWeakObjectPtr<const USplineComponent> Spline;
+		float LengthCm = 0.f;
+		int32 NumPoints = 0;
+		bool bClosedLoop = false;
+		float StepCm = 0.f;
+		TArray<FVector> Samples;
+		TArray<TArray<int32>> Buckets;
+	};
+
+	void SeedFromWorld();
+
+	void AddZoneLocked(ANoSpawnZoneActor* Zone);
+	void RemoveZoneLocked(int32 ZoneId);
+
+	void AddZoneIntervalsLocked(FSplineIntervals& Intervals, int32 ZoneId);
+	void RemoveZoneIntervalsLocked(FSplineIntervals& Intervals, int32 ZoneId);
+
+	FIntPoint CellOf(const FVector& P) const;
+
+	bool FindZoneAtPointLocked(const FVector& WorldPoint, float ExtraCm, FNoSpawnZoneHit& OutHit, const ULevel* OnlyLevel) const;
+
+	static bool ShapeContains(const FZoneShape& Shape, const FVector& WorldPoint, float ExtraCm);
+
+	mutable FRWLock Lock;
+
+	TSparseArray<FZoneShape> Shapes;
+	TMap<TWeakObjectPtr<ANoSpawnZoneActor>, int32> ZoneIds;
+	TMap<FIntPoint, TArray<int32>> Grid;
+	TMap<const USplineComponent*, FSplineIntervals> SplineIndex;
+
+	uint32 Revision = 0;
+
+	bool bSeeded = false;
+};
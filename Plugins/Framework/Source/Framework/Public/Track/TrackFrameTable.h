@@ -0,0 +1,153 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USplineComponent;
+
+/** Interpolated track frame at one distance */
+struct FTrackFrameSample
+{
+	FVector Position = FVector::ZeroVector;
+	FVector Tangent = FVector::ForwardVector;
+	FVector Right = FVector::RightVector;
+	FVector Up = FVector::UpVector;
+
+	float CurvatureInvCm = 0.f; // unsigned, over the baked curvature window
+	float SlopeZ = 0.f;         // tangent Z
+	float HalfWidthCm = 0.f;    // road half width, 0 if unknown
+};
+
+/**
+ * Baked arc-length table of a road spline.
+ *
+ * Uniformly spaced samples (SoA) of position, orthonormal basis (tangent / right / up, same
+ * construction as UTrackFrameProviderComponent), curvature, slope and road half width.
+ * Lookups by distance are O(1) with linear interpolation. A 3D spatial hash over the sample
+ * segments serves global relocalization (no prior distance, self-overlapping tracks).
+ *
+ * Built once on the game thread and immutable afterwards: share it as
+ * TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> and read it from any thread.
+ * A rebuilt track hands out a new table, readers keep the old one alive until they let go.
+ */
+class FRAMEWORK_API FTrackFrameTable
+{
+public:
+	using FHalfWidthFunc = TFunction<float(float /*DistanceCm*/)>;
+
+	/** Sample Spline every StepCm (game thread only). Null for a missing / degenerate spline. */
+	static TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Build(
+		const USplineComponent* Spline,
+		float StepCm = 50.f,
+		float CurvatureWindowCm = 300.f,
+		const FHalfWidthFunc& HalfWidthAtDistance = nullptr
+	);
+
+	/** Table baked by the spline's owner (IRoadSplineInterface), null if none or outdated (game thread only) */
+	static TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> FindBaked(const USplineComponent* Spline);
+
+	/** Baked table if available, else a freshly built one (game thread only) */
+	static TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> FindOrBuild(const USplineComponent* Spline, float StepCm = 50.f);
+
+	bool IsValid() const { return Position.Num() >= 2 && LengthCm > 1.f; }
+
+	/** True if this table was built from Spline at its current revision and placement, O(1) (game thread only) */
+	bool IsUpToDate(const USplineComponent* Spline) const;
+
+	/** Shape revision of Spline, 0 until it is first marked edited (game thread only) */
+	static uint32 GetSplineRevision(const USplineComponent* Spline);
+
+	/** Outdates every table built from Spline: call after changing its points, tangents or point types (game thread only) */
+	static void MarkSplineEdited(const USplineComponent* Spline);
+
+	float GetLengthCm() const { return LengthCm; }
+	float GetStepCm() const { return StepCm; }
+	bool IsClosedLoop() const { return bClosedLoop; }
+	int32 GetNumSamples() const { return Position.Num(); }
+
+	/** Wrap (closed loop) or clamp S into [0, LengthCm] */
+	float WrapDistance(float S) const;
+
+	FTrackFrameSample Sample(float S) const;
+
+	FVector GetLocationAtDistance(float S) const;
+	FVector GetDirectionAtDistance(float S) const;
+	FVector GetRightAtDistance(float S) const;
+	FVector GetUpAtDistance(float S) const;
+
+	/** Position / tangent / right / up in one lookup */
+	void SampleFrame(float S, FVector& OutPosition, FVector& OutTangent, FVector& OutRight, FVector& OutUp) const;
+
+	/** Curvature over the baked window (1/cm) */
+	float GetCurvatureAtDistance(float S) const;
+
+	/** Curvature over a custom window: angle between the tangents at S -/+ WindowCm over 2 * WindowCm (1/cm) */
+	float ComputeCurvatureInvCm(float S, float WindowCm) const;
+
+	float GetSlopeAtDistance(float S) const;
+	float GetHalfWidthAtDistance(float S) const;
+
+	/**
+	 * Closest distance to WorldPoint (projection onto the sample polyline).
+	 * With HintS >= 0 only segments within +/- WindowCm of HintS are searched; falls back to all
+	 * segments if the minimum lies on the window edge.
+	 */
+	float FindClosestDistance(const FVector& WorldPoint, float HintS = -1.f, float WindowCm = 0.f, float* OutDistSq = nullptr) const;
+
+	/**
+	 * Distance intervals of the segments within RadiusCm of WorldPoint (spatial hash).
+	 * With a non-zero Forward only segments whose tangent agrees (dot >= MinHeadingDot) are returned.
+	 * Intervals are sorted and merged; an interval may cross the loop seam (Max > LengthCm).
+	 */
+	void FindCandidateIntervals(const FVector& WorldPoint, float RadiusCm, const FVector& Forward, float MinHeadingDot, TArray<FFloatInterval>& OutIntervals) const;
+
+	/**
+	 * Closest distance without a prior (after respawn / teleport): the closest hashed segment within
+	 * RadiusCm whose tangent agrees with Forward, else the closest one within RadiusCm regardless of
+	 * heading, else a full scan. Zero Forward disables the heading filter.
+	 */
+	float Relocalize(const FVector& WorldPoint, const FVector& Forward, float RadiusCm = 3000.f, float MinHeadingDot = 0.f, float* OutDistSq = nullptr) const;
+
+private:
+	/** Lower sample index, upper sample index and blend factor for S */
+	void Locate(float S, int32& OutIndex0, int32& OutIndex1, float& OutAlpha) const;
+
+	/** Number of polyline segments (closed loops include the closing one) */
+	int32 GetNumSegments() const { return bClosedLoop ? Position.Num() : Position.Num() - 1; }
+
+	/** Best segment projection over segments [First, First + Count) (indices wrap on loops) */
+	void ScanSegments(const FVector& WorldPoint, int32 First, int32 Count, int32& InOutBestSegment, float& InOutBestT, float& InOutBestDistSq) const;
+
+	/** Projection of WorldPoint onto segment K */
+	float ProjectOnSegment(const FVector& WorldPoint, int32 K, float& OutT) const;
+
+	void BuildSpatialHash();
+
+	FIntVector CellOf(const FVector& P) const;
+
+	/** Unique segments in the hash cells overlapping the sphere (sorted) */
+	void GatherSegments(const FVector& WorldPoint, float RadiusCm, TArray<int32>& OutSegments) const;
+
+	TWeakObjectPtr<const USplineComponent> SourceSpline;
+
+	/** Spline state at build time: a moved or edited spline at the same length is stale too */
+	FTransform SourceTransform;
+	uint32 SourceRevision = 0;
+
+	float LengthCm = 0.f;
+	float StepCm = 0.f;
+	float InvStepCm = 0.f;
+	float CurvatureWindowCm = 0.f;
+	bool bClosedLoop = false;
+
+	TArray<FVector> Position;
+	TArray<FVector> Tangent;
+	TArray<FVector> Right;
+	TArray<FVector> Up;
+	TArray<float> Curvature;
+	TArray<float> Slope;
+	TArray<float> HalfWidth;
+
+	/** Spatial hash: cell -> segments overlapping it */
+	float HashCellCm = 1000.f;
+	TMap<FIntVector, TArray<int32>> SegmentHash;
+};
@@ -0,0 +1,483 @@
+#!/usr/bin/env python3
+"""
+Multi-Process Training Coordinator
+===================================
+
+Launches N headless game instances on this machine and farms policy
+evaluations out to them over localhost TCP. Every instance runs
+URacingTrainingWorkerSubsystem, gets its own seed, map and agent slice, and
+reports one result (fitness + episode stats) per finished episode.
+
+Throughput scales with the number of instances instead of one game thread.
+
+Workflow:
+1. One job per (policy file, episode) is queued; each worker keeps one job per agent in flight
+2. Workers load the USimpleNeuralNetwork weight file named in the job onto the agent
+3. Per-episode results are written to Rollouts/policy_eval.jsonl
+
+NEAT populations are not supported: workers can only run USimpleNeuralNetwork
+weight files, and there is no genome -> network conversion yet, so every genome
+would be scored with the same policy. Use train_neat.py with UNEATTrainingManager.
+
+Protocol: newline-delimited JSON (see RacingTrainingWorkerSubsystem.h)
+
+Usage:
+    # 8 local instances, 4 episodes per policy file
+    python train_coordinator.py --exe <UnrealEditor-Cmd> --uproject <StuntCarRacer.uproject> \\
+        --maps /Game/Maps/TrackA /Game/Maps/TrackB --instances 8 \\
+        --policies Saved/Training/policy_a.bin Saved/Training/policy_b.bin --episodes 4
+
+    # Additional box: only launch workers that connect to a remote coordinator
+    python train_coordinator.py --launch-only --coordinator 10.0.0.5:5555 --exe ... --uproject ... --instances 16
+"""
+
+import os
+import sys
+import json
+import time
+import asyncio
+import argparse
+import threading
+import subprocess
+from collections import deque
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Dict, List, Optional
+
+# ============================================================================
+# Jobs / Workers
+# ============================================================================
+
+@dataclass
+class Job:
+    job_id: int
+    genome_id: int
+    generation: int = 0
+    policy_file: str = ""
+    attempts: int = 0
+    dispatched_at: float = 0.0
+
+    def to_message(self) -> dict:
+        return {
+            "type": "job",
+            "job_id": self.job_id,
+            "genome_id": self.genome_id,
+            "generation": self.generation,
+            "policy_file": self.policy_file,
+        }
+
+
+@dataclass
+class WorkerConnection:
+    writer: asyncio.StreamWriter
+    worker_id: int = -1
+    slots: int = 0
+    map_name: str = ""
+    in_flight: Dict[int, Job] = field(default_factory=dict)
+
+    def send(self, message: dict):
+        self.writer.write((json.dumps(message, separators=(",", ":")) + "\n").encode("utf-8"))
+
+
+# ============================================================================
+# Coordinator (TCP server)
+# ============================================================================
+
+class TrainingCoordinator:
+    """Work queue over all connected workers. Runs its own event loop thread."""
+
+    def __init__(self, host: str, port: int, fitness_ceiling_rank: int = 0,
+                 job_timeout: float = 600.0, max_attempts: int = 2, no_worker_timeout: float = 120.0):
+        self.host = host
+        self.port = port
+        self.fitness_ceiling_rank = fitness_ceiling_rank
+        self.job_timeout = job_timeout
+        self.max_attempts = max(1, max_attempts)
+        self.no_worker_timeout = no_worker_timeout
+
+        self.workers: List[WorkerConnection] = []
+        self.pending: deque = deque()
+        self.results: Dict[int, dict] = {}
+        self.failed: List[Job] = []
+        self.expected_jobs = 0
+        self.batch_done: Optional[asyncio.Event] = None
+
+        self.loop = asyncio.new_event_loop()
+        self.thread = threading.Thread(target=self.loop.run_forever, daemon=True)
+        self.server = None
+
+    # ----- lifecycle (called from the main thread) -----
+
+    def start(self):
+        self.thread.start()
+        self._call(self._start_server())
+        print(f"🛰️  Coordinator listening on {self.host}:{self.port}")
+
+    def stop(self):
+        self._call(self._shutdown())
+        self.loop.call_soon_threadsafe(self.loop.stop)
+        self.thread.join(timeout=5)
+
+    def wait_for_workers(self, count: int, timeout: float) -> int:
+        deadline = time.time() + timeout
+        while time.time() < deadline:
+            connected = self._call(self._num_ready_workers())
+            if connected >= count:
+                break
+            time.sleep(0.5)
+        return self._call(self._num_ready_workers())
+
+    def evaluate(self, jobs: List[Job]) -> Dict[int, dict]:
+        """
+        Blocks until every job has a result. Returns job_id -> result message.
+        Jobs running longer than job_timeout or lost with their worker are requeued in their
+        original order (max_attempts dispatches in total); jobs that run out of attempts, or are
+        outstanding when no worker has been connected for no_worker_timeout, get a failed result
+        (fitness 0, reason "Timeout" / "WorkerLost" / "NoWorkers") and are listed in self.failed.
+        """
+        return self._call(self._evaluate(jobs))
+
+    def _call(self, coro):
+        return asyncio.run_coroutine_threadsafe(coro, self.loop).result()
+
+    # ----- event loop side -----
+
+    async def _start_server(self):
+        self.server = await asyncio.start_server(self._handle_worker, self.host, self.port)
+
+    async def _shutdown(self):
+        for worker in self.workers:
+            try:
+                worker.send({"type": "shutdown"})
+                await worker.writer.drain()
+                worker.writer.close()
+            except ConnectionError:
+                pass
+        self.workers.clear()
+
+        if self.server:
+            self.server.close()
+
+    async def _num_ready_workers(self) -> int:
+        return sum(1 for w in self.workers if w.slots > 0)
+
+    async def _evaluate(self, jobs: List[Job]) -> Dict[int, dict]:
+        self.results = {}
+        self.failed = []
+        self.expected_jobs = len(jobs)
+        self.batch_done = asyncio.Event()
+        self.pending.extend(jobs)
+
+        self._broadcast({"type": "cutoff", "fitness": 0.0})
+        self._dispatch()
+
+        no_worker_since = None
+        while len(self.results) < self.expected_jobs:
+            try:
+                await asyncio.wait_for(self.batch_done.wait(), timeout=1.0)
+                break
+            except asyncio.TimeoutError:
+                pass
+
+            now = self.loop.time()
+            if await self._num_ready_workers() > 0:
+                no_worker_since = None
+            else:
+                no_worker_since = no_worker_since if no_worker_since is not None else now
+                if now - no_worker_since >= self.no_worker_timeout:
+                    print(f"❌ No workers for {self.no_worker_timeout:.0f}s, failing "
+                          f"{self.expected_jobs - len(self.results)} outstanding jobs")
+                    self._fail_outstanding("NoWorkers")
+                    break
+
+            self._requeue_stale_jobs(now)
+
+        return self.results
+
+    def _fail_job(self, job: Job, reason: str):
+        if job.job_id in self.results:
+            return
+
+        self.failed.append(job)
+        self.results[job.job_id] = {
+            "type": "result",
+            "job_id": job.job_id,
+            "genome_id": job.genome_id,
+            "generation": job.generation,
+            "fitness": 0.0,
+            "reason": reason,
+            "duration_s": 0.0,
+        }
+
+    def _fail_outstanding(self, reason: str):
+        while self.pending:
+            self._fail_job(self.pending.popleft(), reason)
+
+        for worker in self.workers:
+            for job in worker.in_flight.values():
+                self._fail_job(job, reason)
+            worker.in_flight.clear()
+
+    def _requeue_jobs(self, jobs: List[Job], reason: str):
+        """Put jobs back at the front of the queue in dispatch order, failing those out of attempts."""
+        requeue = []
+        for job in sorted(jobs, key=lambda j: j.dispatched_at):
+            if job.attempts < self.max_attempts:
+                requeue.append(job)
+            else:
+                print(f"⚠️  Job {job.job_id} failed {job.attempts}x ({reason}), scoring 0")
+                self._fail_job(job, reason)
+
+        # extendleft inserts one by one, so feed it reversed to keep the order
+        self.pending.extendleft(reversed(requeue))
+
+    def _requeue_stale_jobs(self, now: float):
+        if self.job_timeout <= 0:
+            return
+
+        for worker in self.workers:
+            stale = [job for job in worker.in_flight.values() if now - job.dispatched_at >= self.job_timeout]
+            for job in stale:
+                del worker.in_flight[job.job_id]
+
+            if stale:
+                print(f"⚠️  {len(stale)} jobs timed out on worker {worker.worker_id}, requeueing")
+                self._requeue_jobs(stale, "Timeout")
+
+        if self.batch_done and len(self.results) >= self.expected_jobs:
+            self.batch_done.set()
+
+        self._dispatch()
+
+    def _broadcast(self, message: dict):
+        for worker in self.workers:
+            worker.send(message)
+
+    def _dispatch(self):
+        for worker in self.workers:
+            while self.pending and len(worker.in_flight) < worker.slots:
+                job = self.pending.popleft()
+                job.attempts += 1
+                job.dispatched_at = self.loop.time()
+                worker.in_flight[job.job_id] = job
+                worker.send(job.to_message())
+
+    def _update_cutoff(self):
+        """Push the N-th best fitness of this batch (see URacingAgentComponent::FitnessCutoff)."""
+        rank = self.fitness_ceiling_rank
+        if rank <= 0 or len(self.results) < rank:
+            return
+
+        best = sorted((r["fitness"] for r in self.results.values()), reverse=True)
+        self._broadcast({"type": "cutoff", "fitness": best[rank - 1]})
+
+    async def _handle_worker(self, reader: asyncio.StreamReader, writer: asyncio.StreamWriter):
+        worker = WorkerConnection(writer=writer)
+        self.workers.append(worker)
+
+        try:
+            while True:
+                line = await reader.readline()
+                if not line:
+                    break
+
+                try:
+                    message = json.loads(line)
+                except json.JSONDecodeError:
+                    print(f"⚠️  Invalid message from worker {worker.worker_id}: {line[:200]!r}")
+                    continue
+
+                msg_type = message.get("type")
+
+                if msg_type == "hello":
+                    worker.worker_id = message.get("worker_id", -1)
+                    worker.slots = max(0, int(message.get("slots", 0)))
+                    worker.map_name = message.get("map", "")
+                    print(f"🔌 Worker {worker.worker_id} ready: {worker.slots} agents, map {worker.map_name}")
+
+                elif msg_type == "result":
+                    job = worker.in_flight.pop(message.get("job_id"), None)
+                    if job is not None and job.job_id not in self.results:
+                        self.results[job.job_id] = message
+                        self._update_cutoff()
+
+                        if self.batch_done and len(self.results) >= self.expected_jobs:
+                            self.batch_done.set()
+
+                self._dispatch()
+                await writer.drain()
+        except ConnectionError:
+            pass
+        finally:
+            # Hand unfinished jobs to the remaining workers
+            if worker in self.workers:
+                self.workers.remove(worker)
+
+            if worker.in_flight:
+                print(f"⚠️  Worker {worker.worker_id} lost, requeueing {len(worker.in_flight)} jobs")
+                self._requeue_jobs(list(worker.in_flight.values()), "WorkerLost")
+                worker.in_flight.clear()
+
+                if self.batch_done and len(self.results) >= self.expected_jobs:
+                    self.batch_done.set()
+
+            self._dispatch()
+
+
+# ============================================================================
+# Worker Launcher
+# ============================================================================
+
+class WorkerLauncher:
+    """Starts headless game instances that connect back to the coordinator."""
+
+    def __init__(self, args):
+        self.args = args
+        self.processes: List[subprocess.Popen] = []
+
+    def launch(self, coordinator_address: str):
+        log_dir = Path(self.args.output_root) / "Workers"
+        log_dir.mkdir(parents=True, exist_ok=True)
+
+        for i in range(self.args.instances):
+            worker_id = self.args.worker_id_offset + i
+            map_name = self.args.maps[i % len(self.args.maps)] if self.args.maps else ""
+            seed = self.args.seed + 1000 * worker_id
+
+            cmd = [self.args.exe, str(Path(self.args.uproject).resolve())]
+            if map_name:
+                cmd.append(map_name)
+
+            cmd += [
+                "-game", "-nullrhi", "-nosound", "-unattended", "-nosplash", "-NoVerifyGC",
+                # Fixed timestep, run as fast as possible
+                "-BENCHMARK", f"-FPS={self.args.fps}",
+                f"-CarAIWorker={coordinator_address}",
+                f"-CarAIWorkerId={worker_id}",
+                f"-CarAISeed={seed}",
+                f"-abslog={(log_dir / f'worker_{worker_id}.log').resolve()}",
+            ]
+
+            if self.args.agents_per_instance > 0:
+                cmd.append(f"-CarAIAgents={self.args.agents_per_instance}")
+            if self.args.vehicle_class:
+                cmd.append(f"-CarAIVehicleClass={self.args.vehicle_class}")
+
+            self.processes.append(subprocess.Popen(cmd, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL))
+
+        print(f"🚀 Launched {len(self.processes)} worker instances -> {coordinator_address}")
+
+    def wait(self):
+        for proc in self.processes:
+            proc.wait()
+
+    def terminate(self, timeout: float = 15.0):
+        deadline = time.time() + timeout
+        for proc in self.processes:
+            try:
+                proc.wait(timeout=max(0.1, deadline - time.time()))
+            except subprocess.TimeoutExpired:
+                proc.kill()
+
+
+# ============================================================================
+# Training Modes
+# ============================================================================
+
+def run_policies(coordinator: TrainingCoordinator, args):
+    jobs = []
+    for episode in range(args.episodes):
+        for index, policy in enumerate(args.policies):
+            jobs.append(Job(job_id=len(jobs), genome_id=index, generation=episode,
+                            policy_file=str(Path(policy).resolve())))
+
+    results = coordinator.evaluate(jobs)
+
+    output_root = Path(args.output_root)
+    (output_root / "Rollouts").mkdir(parents=True, exist_ok=True)
+    with open(output_root / "Rollouts" / "policy_eval.jsonl", "w") as f:
+        for r in results.values():
+            f.write(json.dumps(r) + "\n")
+
+    for index, policy in enumerate(args.policies):
+        fitness = [r["fitness"] for r in results.values() if r["genome_id"] == index]
+        avg = sum(fitness) / len(fitness) if fitness else 0.0
+        print(f"📊 {Path(policy).name}: avg fitness {avg:.2f} over {len(fitness)} episodes")
+
+
+# ============================================================================
+# Main
+# ============================================================================
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Multi-process CarAI training coordinator")
+
+    parser.add_argument("--exe", help="Game / UnrealEditor-Cmd executable")
+    parser.add_argument("--uproject", help="Path to StuntCarRacer.uproject")
+    parser.add_argument("--maps", nargs="*", default=[], help="Maps, assigned round-robin to instances")
+    parser.add_argument("--instances", type=int, default=max(1, (os.cpu_count() or 2) // 2))
+    parser.add_argument("--agents-per-instance", type=int, default=0, help="Agent slice per instance (0 = all in map)")
+    parser.add_argument("--vehicle-class", default="", help="Spawn the agent slice from the vehicle pool")
+    parser.add_argument("--seed", type=int, default=1337)
+    parser.add_argument("--fps", type=int, default=60, help="Fixed simulation rate of the instances")
+
+    parser.add_argument("--host", default="127.0.0.1", help="Bind address (0.0.0.0 for remote workers)")
+    parser.add_argument("--port", type=int, default=5555)
+    parser.add_argument("--connect-timeout", type=float, default=300.0)
+    parser.add_argument("--min-workers", type=int, default=0, help="Workers to wait for (default: --instances)")
+    parser.add_argument("--job-timeout", type=float, default=600.0,
+                        help="Requeue a job that has no result after this many seconds (0 = never)")
+    parser.add_argument("--job-attempts", type=int, default=2, help="Dispatches per job before it is scored 0")
+    parser.add_argument("--no-worker-timeout", type=float, default=120.0,
+                        help="Fail the outstanding jobs once no worker has been connected for this long")
+
+    parser.add_argument("--launch-only", action="store_true", help="Only launch workers for a remote coordinator")
+    parser.add_argument("--coordinator", default="", help="host:port of the remote coordinator (--launch-only)")
+    parser.add_argument("--worker-id-offset", type=int, default=0, help="Unique worker ids across boxes")
+
+    parser.add_argument("--policies", nargs="*", default=[], help="USimpleNeuralNetwork weight files to evaluate")
+    parser.add_argument("--episodes", type=int, default=1, help="Episodes per policy (--policies)")
+    parser.add_argument("--fitness-ceiling-rank", type=int, default=0,
+                        help="Stop episodes that can no longer beat the N-th best fitness (0 = off)")
+    parser.add_argument("--output-root", default="Saved/Training")
+
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    launcher = WorkerLauncher(args)
+
+    if not args.launch_only and not args.policies:
+        sys.exit("--policies is required: NEAT genomes cannot be run by the workers (no genome -> network loader)")
+
+    if args.launch_only:
+        if not (args.exe and args.uproject and args.coordinator):
+            sys.exit("--launch-only needs --exe, --uproject and --coordinator")
+        launcher.launch(args.coordinator)
+        launcher.wait()
+        return
+
+    coordinator = TrainingCoordinator(args.host, args.port, args.fitness_ceiling_rank,
+                                      args.job_timeout, args.job_attempts, args.no_worker_timeout)
+    coordinator.start()
+
+    try:
+        if args.exe and args.uproject and args.instances > 0:
+            connect_host = "127.0.0.1" if args.host in ("0.0.0.0", "") else args.host
+            launcher.launch(f"{connect_host}:{args.port}")
+
+        min_workers = args.min_workers or args.instances
+        connected = coordinator.wait_for_workers(min_workers, args.connect_timeout)
+        if connected == 0:
+            sys.exit("❌ No workers connected")
+        print(f"✓ {connected} workers connected")
+
+        run_policies(coordinator, args)
+    finally:
+        coordinator.stop()
+        launcher.terminate()
+
+
+if __name__ == "__main__":
+    main()
@@ -1,5 +1,7 @@
 #include "Editor/CurriculumEditorWidget.h"
 #include "Editor/CurriculumSpawner.h"
+#include "Pool/RacingVehiclePoolSubsystem.h"
+#include "Track/RacingTrackInstance.h"
 
 #include "Editor.h"
 #include "Engine/World.h"
@@ -131,8 +133,19 @@ void UCurriculumEditorWidget::SpawnCurriculumCars()
 		return;
 	}
 
-	USplineComponent* Spline = FindTrackSpline();
-	if (!Spline)
+	// Multi-Track: alle RacingTrackInstances, sonst die eine Track-Spline
+	TArray<ARacingTrackInstance*> Tracks;
+	if (bSpawnOnAllTracks)
+	{
+		Tracks = ARacingTrackInstance::GetAllTrackInstances(World);
+		for (ARacingTrackInstance* Track : Tracks)
+		{
+			Track->ResolveReferences();
+		}
+	}
+
+	USplineComponent* Spline = Tracks.Num() > 0 ? nullptr : FindTrackSpline();
+	if (!Spline && Tracks.Num() == 0)
 	{
 		LastStatus = TEXT("ERROR: No track found!");
 		return;
@@ -147,6 +160,15 @@ void UCurriculumEditorWidget::SpawnCurriculumCars()
 	// Clear existing first
 	ClearAllCars();
 
+	// Pool vorwärmen, damit der Spawn selbst nur noch teleportiert
+	if (bUseVehiclePool)
+	{
+		if (URacingVehiclePoolSubsystem* Pool = World->GetSubsystem<URacingVehiclePoolSubsystem>())
+		{
+			Pool->Prewarm(CarPawnClass, NumCars + PoolPrewarmExtra);
+		}
+	}
+
 	// Erstelle Spawner und konfiguriere ihn
 	UCurriculumSpawner* Spawner = NewObject<UCurriculumSpawner>(this);
 
@@ -160,6 +182,7 @@ void UCurriculumEditorWidget::SpawnCurriculumCars()
 	Spawner->CurvatureWindowCm = CurvatureWindowCm;
 	Spawner->CurvatureBadInvCm = CurvatureBadInvCm;
 	Spawner->CurvatureExponent = CurvatureExponent;
+	Spawner->bUseVehiclePool = bUseVehiclePool;
 
 	// Spawne mit lateralem Offset (asynchron)
 	LastStatus = TEXT("Spawning cars (async)...");
@@ -167,25 +190,47 @@ void UCurriculumEditorWidget::SpawnCurriculumCars()
 	// Kopiere Member-Variablen für Lambda-Capture
 	TSubclassOf<APawn> LocalPawnClass = CarPawnClass;
 	
-	Spawner->SpawnCurriculumCarsAsync(
-		World,
-		Spline,
-		LocalPawnClass,
-		NumCars,
-		[this, LocalPawnClass](int32 SpawnedCount)
+	TFunction<void(int32)> OnSpawned = [this, LocalPawnClass](int32 SpawnedCount)
 		{
 			// Callback auf Game-Thread
 			SpawnedCarCount = SpawnedCount;
 			LastStatus = FString::Printf(TEXT("Spawned %d cars (async)"), SpawnedCount);
-		},
-		MinSpawnScore,
-		SpawnHeightOffsetCm,
-		bDistributeEvenly,
-		bUseLateralOffset,
-		MaxLateralOffsetCm,
-		RandomSeed,
-		bDebugDraw
-	);
+		};
+
+	if (Tracks.Num() > 0)
+	{
+		Spawner->SpawnCurriculumCarsOnTracksAsync(
+			World,
+			Tracks,
+			LocalPawnClass,
+			NumCars,
+			MoveTemp(OnSpawned),
+			MinSpawnScore,
+			SpawnHeightOffsetCm,
+			bDistributeEvenly,
+			bUseLateralOffset,
+			MaxLateralOffsetCm,
+			RandomSeed,
+			bDebugDraw
+		);
+	}
+	else
+	{
+		Spawner->SpawnCurriculumCarsAsync(
+			World,
+			Spline,
+			LocalPawnClass,
+			NumCars,
+			MoveTemp(OnSpawned),
+			MinSpawnScore,
+			SpawnHeightOffsetCm,
+			bDistributeEvenly,
+			bUseLateralOffset,
+			MaxLateralOffsetCm,
+			RandomSeed,
+			bDebugDraw
+		);
+	}
 
 	LastStatus = FString::Printf(TEXT("Spawned %d cars (Lateral: %s, MaxOffset: %.0f cm)"),
 		SpawnedCarCount,
@@ -215,18 +260,35 @@ void UCurriculumEditorWidget::ClearAllCars()
 		}
 	}
 
+	URacingVehiclePoolSubsystem* Pool = bUseVehiclePool ? World->GetSubsystem<URacingVehiclePoolSubsystem>() : nullptr;
+
 	int32 Destroyed = 0;
+	int32 Released = 0;
 	for (AActor* Actor : Found)
 	{
-		if (Actor)
+		if (!Actor)
 		{
-			Actor->Destroy();
-			Destroyed++;
+			continue;
 		}
+
+		// Gepoolte Autos nur parken, nicht zerstören
+		APawn* Pawn = Cast<APawn>(Actor);
+		if (Pool && Pool->IsPooled(Pawn))
+		{
+			if (Pool->ReleaseVehicle(Pawn))
+			{
+				Pawn->Tags.Remove(TEXT("CurriculumCar"));
+				Released++;
+			}
+			continue;
+		}
+
+		Actor->Destroy();
+		Destroyed++;
 	}
 
 	SpawnedCarCount = 0;
-	LastStatus = FString::Printf(TEXT("Cleared %d cars"), Destroyed);
+	LastStatus = FString::Printf(TEXT("Cleared %d cars (%d returned to pool)"), Destroyed + Released, Released);
 }
 
 // ============================================================================
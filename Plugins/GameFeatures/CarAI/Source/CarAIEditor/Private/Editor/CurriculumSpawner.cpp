@@ -7,8 +7,16 @@
 #include "Async/Async.h"
 #include "EngineUtils.h"
 
+#include "Async/ParallelFor.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+
 // NoSpawnZone support
-#include "Actors/NoSpawnZoneActor.h"
+#include "Subsystems/NoSpawnZoneSubsystem.h"
+
+#include "Pool/RacingVehiclePoolSubsystem.h"
+#include "Track/RacingTrackInstance.h"
+#include "Components/RacingAgentComponent.h"
 
 // ============================================================================
 // Helpers
@@ -28,16 +36,13 @@ float UCurriculumSpawner::ComputePitchDegFromForward(const FVector& Forward)
 
 bool UCurriculumSpawner::TraceSurface(
 	UWorld* World,
-	USplineComponent* Spline,
-	float DistanceCm,
+	const FVector& SplinePos,
+	const FVector& UpDir,
 	FVector& OutLocation,
 	FVector& OutNormal
 ) const
 {
-	if (!World || !Spline) return false;
-
-	const FVector SplinePos = Spline->GetLocationAtDistanceAlongSpline(DistanceCm, ESplineCoordinateSpace::World);
-	const FVector UpDir = Spline->GetUpVectorAtDistanceAlongSpline(DistanceCm, ESplineCoordinateSpace::World).GetSafeNormal();
+	if (!World) return false;
 
 	const FVector Start = SplinePos + UpDir * TraceUpCm;
 	const FVector End = SplinePos - UpDir * TraceDownCm;
@@ -57,51 +62,6 @@ bool UCurriculumSpawner::TraceSurface(
 	return false;
 }
 
-// ============================================================================
-// Curvature
-// ============================================================================
-
-float UCurriculumSpawner::ComputeCurvatureInvCm(
-	USplineComponent* Spline,
-	float DistanceCm,
-	float WindowCm
-) const
-{
-	if (!Spline) return 0.f;
-
-	const float SplineLength = Spline->GetSplineLength();
-	if (SplineLength <= 1.f) return 0.f;
-
-	const float W = FMath::Max(10.f, WindowCm);
-	const bool bLoop = Spline->IsClosedLoop();
-
-	auto WrapDist = [SplineLength, bLoop](float S) -> float
-		{
-			if (bLoop)
-			{
-				float X = FMath::Fmod(S, SplineLength);
-				if (X < 0.f) X += SplineLength;
-				return X;
-			}
-			return FMath::Clamp(S, 0.f, SplineLength);
-		};
-
-	const float S0 = WrapDist(DistanceCm - W);
-	const float S1 = WrapDist(DistanceCm + W);
-
-	FVector F0 = Spline->GetDirectionAtDistanceAlongSpline(S0, ESplineCoordinateSpace::World);
-	FVector F1 = Spline->GetDirectionAtDistanceAlongSpline(S1, ESplineCoordinateSpace::World);
-
-	if (!F0.Normalize()) F0 = FVector::ForwardVector;
-	if (!F1.Normalize()) F1 = FVector::ForwardVector;
-
-	const float Dot = FMath::Clamp(FVector::DotProduct(F0, F1), -1.f, 1.f);
-	const float AngleRad = FMath::Acos(Dot);
-	const float Ds = FMath::Max(1.f, 2.f * W);
-
-	return AngleRad / Ds; // 1/cm
-}
-
 // ============================================================================
 // Spawn Score (wie in RacingCurriculumDebugActor)
 // ============================================================================
@@ -160,103 +120,136 @@ float UCurriculumSpawner::ComputeSpawnScore(
 // Build Spawn Candidates
 // ============================================================================
 
-void UCurriculumSpawner::BuildSpawnCandidates(
-	UWorld* World,
-	USplineComponent* Spline,
-	TArray<FCurriculumSpawnCandidate>& OutCandidates
-)
+float UCurriculumSpawner::GetFrameTableStepCm() const
 {
-	OutCandidates.Reset();
+	// Feiner als das Krümmungsfenster, damit interpolierte Tangenten nah an der Spline bleiben
+	return FMath::Clamp(0.5f * FMath::Min(FMath::Max(50.f, SampleStepCm), FMath::Max(10.f, CurvatureWindowCm)), 5.f, 50.f);
+}
 
-	if (!World || !Spline) return;
+void UCurriculumSpawner::TraceSpawnCandidate(
+	UWorld* World,
+	const FTrackFrameTable& Track,
+	FCurriculumSpawnCandidate& Candidate
+) const
+{
+	const float S = Candidate.DistanceAlongSpline;
 
-	const float SplineLength = Spline->GetSplineLength();
-	if (SplineLength <= 1.f) return;
+	FVector SplinePos, Tangent, Right, Up;
+	Track.SampleFrame(S, SplinePos, Tangent, Right, Up);
 
-	const float Step = FMath::Max(50.f, SampleStepCm);
-	const int32 NumSamples = FMath::CeilToInt(SplineLength / Step);
+	// Surface Trace
+	FVector SurfaceLocation, SurfaceNormal;
+	const bool bHasSurface = TraceSurface(World, SplinePos, Up, SurfaceLocation, SurfaceNormal);
 
-	OutCandidates.Reserve(NumSamples);
+	Candidate.bValidSurface = bHasSurface;
 
-	for (int32 i = 0; i < NumSamples; ++i)
+	if (bHasSurface)
 	{
-		const float S = i * Step;
-
-		FCurriculumSpawnCandidate Candidate;
-		Candidate.DistanceAlongSpline = S;
+		Candidate.Location = SurfaceLocation;
+		Candidate.SurfaceNormal = SurfaceNormal;
+	}
+	else
+	{
+		// Fallback auf Spline-Position
+		Candidate.Location = SplinePos;
+		Candidate.SurfaceNormal = FVector::UpVector;
+	}
+}
 
-		// Surface Trace
-		FVector SurfaceLocation, SurfaceNormal;
-		const bool bHasSurface = TraceSurface(World, Spline, S, SurfaceLocation, SurfaceNormal);
+void UCurriculumSpawner::ScoreSpawnCandidates(
+	UWorld* World,
+	const FTrackFrameTable& Track,
+	TArray<FCurriculumSpawnCandidate>& InOutCandidates
+) const
+{
+	// NoSpawnZone-Index holen (Game-Thread), Abfragen sind thread-safe
+	const UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(World);
+	const ULevel* ZoneLevel = GetNoSpawnZoneLevel();
 
-		Candidate.bValidSurface = bHasSurface;
+	// Reine Daten (Frame-Tabelle + Trace-Ergebnisse) -> parallel auf Worker-Threads
+	ParallelFor(InOutCandidates.Num(), [&](int32 i)
+	{
+		FCurriculumSpawnCandidate& Candidate = InOutCandidates[i];
+		const float S = Candidate.DistanceAlongSpline;
 
-		if (bHasSurface)
-		{
-			Candidate.Location = SurfaceLocation;
-			Candidate.SurfaceNormal = SurfaceNormal;
-		}
-		else
-		{
-			// Fallback auf Spline-Position
-			Candidate.Location = Spline->GetLocationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
-			Candidate.SurfaceNormal = FVector::UpVector;
-		}
+		FVector SplinePos, Tangent, Right, Up;
+		Track.SampleFrame(S, SplinePos, Tangent, Right, Up);
 
 		// Rotation und RightVector aus Spline
-		const FVector Tangent = Spline->GetDirectionAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
 		Candidate.Rotation = Tangent.Rotation();
-		Candidate.RightVector = Spline->GetRightVectorAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
+		Candidate.RightVector = Right;
 
 		// SpawnScore berechnen
-		const float CurvInvCm = ComputeCurvatureInvCm(Spline, S, CurvatureWindowCm);
+		const float CurvInvCm = Track.ComputeCurvatureInvCm(S, CurvatureWindowCm);
 		const float PitchDeg = ComputePitchDegFromForward(Tangent);
 
-		float SpawnScore = ComputeSpawnScore(bHasSurface, Candidate.SurfaceNormal, CurvInvCm, PitchDeg);
-		
+		float SpawnScore = ComputeSpawnScore(Candidate.bValidSurface, Candidate.SurfaceNormal, CurvInvCm, PitchDeg);
+
 		// Setze Score auf 0, wenn in NoSpawnZone
-		if (SpawnScore >= 0.f && IsInAnyNoSpawnZone(World, Candidate.Location))
+		if (SpawnScore >= 0.f && ZoneIndex && ZoneIndex->IsPointBlocked(Candidate.Location, 0.f, ZoneLevel))
 		{
 			SpawnScore = 0.f; // Komplett verboten
 		}
-		
-		Candidate.SpawnScore01 = SpawnScore;
 
-		OutCandidates.Add(Candidate);
-	}
+		Candidate.SpawnScore01 = SpawnScore;
+	});
 }
 
-// ============================================================================
-// NoSpawnZone Helper
-// ============================================================================
-
-bool UCurriculumSpawner::IsInAnyNoSpawnZone(UWorld* World, const FVector& WorldPoint) const
+void UCurriculumSpawner::BuildSpawnCandidates(
+	UWorld* World,
+	USplineComponent* Spline,
+	TArray<FCurriculumSpawnCandidate>& OutCandidates
+)
 {
-	if (!World)
+	OutCandidates.Reset();
+
+	if (!World || !Spline) return;
+
+	const float SplineLength = Spline->GetSplineLength();
+	if (SplineLength <= 1.f) return;
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// 1. Frame-Tabelle der Strecke (gebacken vom Track-Actor, sonst hier gebaut)
+	const TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> TrackTable = FTrackFrameTable::FindOrBuild(Spline, GetFrameTableStepCm());
+	if (!TrackTable.IsValid())
 	{
-		return false;
+		return;
 	}
+	const FTrackFrameTable& Track = *TrackTable;
 
-	for (TActorIterator<ANoSpawnZoneActor> It(World); It; ++It)
-	{
-		ANoSpawnZoneActor* Zone = *It;
-		if (!IsValid(Zone))
-		{
-			continue;
-		}
+	const float Step = FMath::Max(50.f, SampleStepCm);
+	const int32 NumSamples = FMath::CeilToInt(SplineLength / Step);
 
-		// Use the ContainsPoint method from NoSpawnZoneActor
-		if (Zone->ContainsPoint(WorldPoint))
-		{
-			return true;
-		}
+	OutCandidates.SetNum(NumSamples);
+
+	// 2. Surface Traces (Scene Queries auf dem Game-Thread)
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		OutCandidates[i].DistanceAlongSpline = i * Step;
+		TraceSpawnCandidate(World, Track, OutCandidates[i]);
 	}
 
-	return false;
+	// 3. Scores parallel
+	ScoreSpawnCandidates(World, Track, OutCandidates);
+
+	UE_LOG(LogTemp, Log, TEXT("CurriculumSpawner: %d Kandidaten in %.1f ms bewertet"),
+		NumSamples, (FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 
 // ============================================================================
-// Select Best Candidates (vereinfacht - kein Mindestabstand mehr)
+// NoSpawnZone Helper
+// ============================================================================
+
+const ULevel* UCurriculumSpawner::GetNoSpawnZoneLevel() const
+{
+	// Multi-Track: nur die Zonen im Level des aktiven Tracks (andere Tracks liegen woanders)
+	const ARacingTrackInstance* Track = ActiveTrack.Get();
+	return Track ? Track->GetLevel() : nullptr;
+}
+
+// ============================================================================
+// Select Best Candidates (Binärsuche auf den nach Distanz sortierten Kandidaten)
 // ============================================================================
 
 void UCurriculumSpawner::SelectBestCandidates(
@@ -274,45 +267,52 @@ void UCurriculumSpawner::SelectBestCandidates(
 
 	if (AllCandidates.Num() == 0 || NumToSelect <= 0) return;
 
-	// Filtere Kandidaten mit ausreichendem Score
-	TArray<FCurriculumSpawnCandidate> ValidCandidates;
-	for (const FCurriculumSpawnCandidate& C : AllCandidates)
+	// Filtere Kandidaten mit ausreichendem Score (nur Indizes, AllCandidates ist nach Distanz sortiert)
+	TArray<int32> ValidIdx;
+	ValidIdx.Reserve(AllCandidates.Num());
+	for (int32 i = 0; i < AllCandidates.Num(); ++i)
 	{
+		const FCurriculumSpawnCandidate& C = AllCandidates[i];
 		if (C.bValidSurface && C.SpawnScore01 >= MinScore)
 		{
-			ValidCandidates.Add(C);
+			ValidIdx.Add(i);
 		}
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("CurriculumSpawner: %d von %d Kandidaten haben Score >= %.2f"),
-		ValidCandidates.Num(), AllCandidates.Num(), MinScore);
+		ValidIdx.Num(), AllCandidates.Num(), MinScore);
 
-	if (ValidCandidates.Num() == 0)
+	if (ValidIdx.Num() == 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("CurriculumSpawner: Keine Kandidaten mit Score >= %.2f gefunden! Fallback..."), MinScore);
 
 		// Fallback: nimm alle mit validem Surface
-		for (const FCurriculumSpawnCandidate& C : AllCandidates)
+		for (int32 i = 0; i < AllCandidates.Num(); ++i)
 		{
+			const FCurriculumSpawnCandidate& C = AllCandidates[i];
 			if (C.bValidSurface && C.SpawnScore01 > 0.f)
 			{
-				ValidCandidates.Add(C);
+				ValidIdx.Add(i);
 			}
 		}
 
-		if (ValidCandidates.Num() == 0)
+		if (ValidIdx.Num() == 0)
 		{
 			UE_LOG(LogTemp, Error, TEXT("CurriculumSpawner: Überhaupt keine validen Spawn-Punkte gefunden!"));
 			return;
 		}
 	}
 
-	const float FirstDist = ValidCandidates[0].DistanceAlongSpline;
-	const float LastDist = ValidCandidates.Last().DistanceAlongSpline;
-	const float TotalLength = LastDist - FirstDist;
+	OutSelected.Reserve(FMath::Min(NumToSelect, bDistributeEvenly ? NumToSelect : ValidIdx.Num()));
 
 	if (bDistributeEvenly)
 	{
+		auto DistOf = [&AllCandidates](int32 Idx) { return AllCandidates[Idx].DistanceAlongSpline; };
+
+		const float FirstDist = DistOf(ValidIdx[0]);
+		const float LastDist = DistOf(ValidIdx.Last());
+		const float TotalLength = LastDist - FirstDist;
+
 		// Gleichmäßige Verteilung: Wähle Kandidaten in regelmäßigen Abständen
 		const float Spacing = TotalLength / FMath::Max(1, NumToSelect);
 
@@ -323,47 +323,34 @@ void UCurriculumSpawner::SelectBestCandidates(
 		{
 			const float TargetDist = FirstDist + i * Spacing;
 
-			// Finde nächsten Kandidaten zur Zieldistanz
-			const FCurriculumSpawnCandidate* Best = nullptr;
-			float BestDelta = FLT_MAX;
-
-			for (const FCurriculumSpawnCandidate& C : ValidCandidates)
+			// Nächster Kandidat zur Zieldistanz per Binärsuche (bei Gleichstand der frühere)
+			int32 k = Algo::LowerBoundBy(ValidIdx, TargetDist, DistOf);
+			if (k >= ValidIdx.Num())
 			{
-				const float Delta = FMath::Abs(C.DistanceAlongSpline - TargetDist);
-				if (Delta < BestDelta)
-				{
-					BestDelta = Delta;
-					Best = &C;
-				}
+				k = ValidIdx.Num() - 1;
 			}
-
-			if (Best)
+			else if (k > 0 && (TargetDist - DistOf(ValidIdx[k - 1])) <= (DistOf(ValidIdx[k]) - TargetDist))
 			{
-				OutSelected.Add(*Best);
+				--k;
 			}
+
+			OutSelected.Add(AllCandidates[ValidIdx[k]]);
 		}
 	}
 	else
 	{
 		// Score-basierte Auswahl: Sortiere nach Score und nimm die besten
-		TArray<FCurriculumSpawnCandidate> Sorted = ValidCandidates;
-		Sorted.Sort([](const FCurriculumSpawnCandidate& A, const FCurriculumSpawnCandidate& B)
-			{
-				return A.SpawnScore01 > B.SpawnScore01;
-			});
+		Algo::StableSortBy(ValidIdx, [&AllCandidates](int32 Idx) { return AllCandidates[Idx].SpawnScore01; }, TGreater<float>());
 
-		const int32 Count = FMath::Min(NumToSelect, Sorted.Num());
+		const int32 Count = FMath::Min(NumToSelect, ValidIdx.Num());
 		for (int32 i = 0; i < Count; ++i)
 		{
-			OutSelected.Add(Sorted[i]);
+			OutSelected.Add(AllCandidates[ValidIdx[i]]);
 		}
-	}
 
-	// Sortiere Ergebnis nach Distanz für konsistente Reihenfolge
-	OutSelected.Sort([](const FCurriculumSpawnCandidate& A, const FCurriculumSpawnCandidate& B)
-		{
-			return A.DistanceAlongSpline < B.DistanceAlongSpline;
-		});
+		// Sortiere Ergebnis nach Distanz für konsistente Reihenfolge
+		Algo::StableSortBy(OutSelected, &FCurriculumSpawnCandidate::DistanceAlongSpline);
+	}
 
 	UE_LOG(LogTemp, Log, TEXT("CurriculumSpawner: %d Kandidaten ausgewählt"), OutSelected.Num());
 }
@@ -488,29 +475,11 @@ void UCurriculumSpawner::SpawnCurriculumCars(
 			);
 		}
 
-		// Spawn
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-		APawn* Pawn = World->SpawnActor<APawn>(
-			PawnClass,
-			SpawnLocation,
-			SpawnRotation,
-			SpawnParams
-		);
+		// Spawn (oder aus Pool holen)
+		APawn* Pawn = SpawnCurriculumPawn(World, PawnClass, SpawnLocation, SpawnRotation);
 
 		if (Pawn)
 		{
-			Pawn->Tags.Add(TEXT("CurriculumCar"));
-			
-			// Setze Actor in "AICars" Folder im Outliner
-			#if WITH_EDITOR
-			if (GIsEditor)
-			{
-				Pawn->SetFolderPath(FName(TEXT("AICars")));
-			}
-			#endif
-			
 			SpawnedCount++;
 
 			UE_LOG(LogTemp, Verbose, TEXT("CurriculumSpawner: Auto #%d bei S=%.0f m, Lateral=%.0f cm"),
@@ -558,68 +527,38 @@ void UCurriculumSpawner::BuildSpawnCandidatesAsync(
 	const float Step = FMath::Max(50.f, SampleStepCm);
 	const int32 NumSamples = FMath::CeilToInt(SplineLength / Step);
 	
-	// Verwende einen Timer-basierten Ansatz für chunked processing
-	// Das ist einfacher und sicherer als Threading
+	// Surface Traces chunked auf dem Game-Thread (Editor bleibt responsiv),
+	// danach Scoring parallel über die Frame-Tabelle
 	struct FChunkedBuilder
 	{
 		UWorld* World;
-		USplineComponent* Spline;
-		float Step;
 		int32 NumSamples;
 		int32 CurrentIndex;
+		TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Track;
 		TArray<FCurriculumSpawnCandidate> Candidates;
 		TFunction<void(TArray<FCurriculumSpawnCandidate>)> OnComplete;
 		UCurriculumSpawner* Spawner;
 		
 		void ProcessChunk()
 		{
-			const int32 ChunkSize = 10; // Verarbeite 10 Samples pro Frame
+			const int32 ChunkSize = 256; // Traces pro Frame
 			const int32 EndIndex = FMath::Min(CurrentIndex + ChunkSize, NumSamples);
 			
 			for (int32 i = CurrentIndex; i < EndIndex; ++i)
 			{
-				const float S = i * Step;
-				
-				FCurriculumSpawnCandidate Candidate;
-				Candidate.DistanceAlongSpline = S;
-				
-				// Surface Trace
-				FVector SurfaceLocation, SurfaceNormal;
-				const bool bHasSurface = Spawner->TraceSurface(World, Spline, S, SurfaceLocation, SurfaceNormal);
-				
-				Candidate.bValidSurface = bHasSurface;
-				if (bHasSurface)
-				{
-					Candidate.Location = SurfaceLocation;
-					Candidate.SurfaceNormal = SurfaceNormal;
-				}
-				else
-				{
-					Candidate.Location = Spline->GetLocationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
-					Candidate.SurfaceNormal = FVector::UpVector;
-				}
-				
-				// Rotation und RightVector
-				const FVector Tangent = Spline->GetDirectionAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
-				Candidate.Rotation = Tangent.Rotation();
-				Candidate.RightVector = Spline->GetRightVectorAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
-				
-				// SpawnScore
-				const float CurvInvCm = Spawner->ComputeCurvatureInvCm(Spline, S, Spawner->CurvatureWindowCm);
-				const float PitchDeg = ComputePitchDegFromForward(Tangent);
-				Candidate.SpawnScore01 = Spawner->ComputeSpawnScore(bHasSurface, Candidate.SurfaceNormal, CurvInvCm, PitchDeg);
-				
-				Candidates.Add(Candidate);
+				Spawner->TraceSpawnCandidate(World, *Track, Candidates[i]);
 			}
 			
 			CurrentIndex = EndIndex;
 			
 			if (CurrentIndex >= NumSamples)
 			{
-				// Fertig!
+				// Fertig! Scores parallel
+				Spawner->ScoreSpawnCandidates(World, *Track, Candidates);
+
 				if (OnComplete)
 				{
-					OnComplete(Candidates);
+					OnComplete(MoveTemp(Candidates));
 				}
 				delete this; // Cleanup
 			}
@@ -634,13 +573,26 @@ void UCurriculumSpawner::BuildSpawnCandidatesAsync(
 		}
 	};
 	
+	TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> TrackTable = FTrackFrameTable::FindOrBuild(Spline, GetFrameTableStepCm());
+	if (!TrackTable.IsValid())
+	{
+		if (OnComplete)
+		{
+			OnComplete(TArray<FCurriculumSpawnCandidate>());
+		}
+		return;
+	}
+
 	FChunkedBuilder* Builder = new FChunkedBuilder();
 	Builder->World = World;
-	Builder->Spline = Spline;
-	Builder->Step = Step;
 	Builder->NumSamples = NumSamples;
 	Builder->CurrentIndex = 0;
-	Builder->Candidates.Reserve(NumSamples);
+	Builder->Track = MoveTemp(TrackTable);
+	Builder->Candidates.SetNum(NumSamples);
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		Builder->Candidates[i].DistanceAlongSpline = i * Step;
+	}
 	Builder->OnComplete = OnComplete;
 	Builder->Spawner = this;
 	
@@ -767,20 +719,8 @@ void UCurriculumSpawner::SpawnCurriculumCarsAsync(
 					nullptr, FColor::White, 15.f, false);
 			}
 
-			FActorSpawnParameters SpawnParams;
-			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-			APawn* Pawn = World->SpawnActor<APawn>(PawnClass, SpawnLocation, SpawnRotation, SpawnParams);
-
-			if (Pawn)
+			if (SpawnCurriculumPawn(World, PawnClass, SpawnLocation, SpawnRotation))
 			{
-				Pawn->Tags.Add(TEXT("CurriculumCar"));
-				#if WITH_EDITOR
-				if (GIsEditor)
-				{
-					Pawn->SetFolderPath(FName(TEXT("AICars")));
-				}
-				#endif
 				SpawnedCount++;
 			}
 		}
@@ -794,4 +734,228 @@ void UCurriculumSpawner::SpawnCurriculumCarsAsync(
 			OnComplete(SpawnedCount);
 		}
 	});
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// Multi-Track Spawn
+// ============================================================================
+
+struct FCurriculumTrackSpawnChain
+{
+	UWorld* World = nullptr;
+	TArray<TWeakObjectPtr<ARacingTrackInstance>> Tracks;
+	TArray<int32> CarsPerTrack;
+	int32 TrackIndex = 0;
+	int32 TotalSpawned = 0;
+
+	TSubclassOf<APawn> PawnClass;
+	TFunction<void(int32 SpawnedCount)> OnComplete;
+	float MinSpawnScore = 0.5f;
+	float SpawnHeightOffset = 50.f;
+	bool bDistributeEvenly = true;
+	bool bUseLateralOffset = true;
+	float MaxLateralOffsetCm = 300.f;
+	int32 RandomSeed = 0;
+	bool bDebugDraw = false;
+};
+
+TArray<int32> UCurriculumSpawner::SplitCarsAcrossTracks(int32 NumCars, int32 NumTracks)
+{
+	TArray<int32> Result;
+	if (NumTracks <= 0)
+	{
+		return Result;
+	}
+
+	Result.Init(NumCars / NumTracks, NumTracks);
+	for (int32 i = 0; i < NumCars % NumTracks; ++i)
+	{
+		++Result[i];
+	}
+	return Result;
+}
+
+void UCurriculumSpawner::SpawnCurriculumCarsOnTracks(
+	UWorld* World,
+	const TArray<ARacingTrackInstance*>& Tracks,
+	TSubclassOf<APawn> PawnClass,
+	int32 NumCars,
+	float MinSpawnScore,
+	float SpawnHeightOffset,
+	bool bDistributeEvenly,
+	bool bUseLateralOffset,
+	float MaxLateralOffsetCm,
+	int32 RandomSeed,
+	bool bDebugDraw
+)
+{
+	const TArray<int32> CarsPerTrack = SplitCarsAcrossTracks(NumCars, Tracks.Num());
+
+	for (int32 i = 0; i < Tracks.Num(); ++i)
+	{
+		ARacingTrackInstance* Track = Tracks[i];
+		USplineComponent* Spline = Track ? Track->GetTrackSpline() : nullptr;
+		if (!Spline || CarsPerTrack[i] <= 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("CurriculumSpawner: Track %s übersprungen (keine Spline oder keine Autos)"),
+				*GetNameSafe(Track));
+			continue;
+		}
+
+		ActiveTrack = Track;
+		SpawnCurriculumCars(World, Spline, PawnClass, CarsPerTrack[i], MinSpawnScore, SpawnHeightOffset,
+			bDistributeEvenly, bUseLateralOffset, MaxLateralOffsetCm, RandomSeed != 0 ? RandomSeed + i : 0, bDebugDraw);
+	}
+
+	ActiveTrack.Reset();
+}
+
+void UCurriculumSpawner::SpawnCurriculumCarsOnTracksAsync(
+	UWorld* World,
+	const TArray<ARacingTrackInstance*>& Tracks,
+	TSubclassOf<APawn> PawnClass,
+	int32 NumCars,
+	TFunction<void(int32 SpawnedCount)> OnComplete,
+	float MinSpawnScore,
+	float SpawnHeightOffset,
+	bool bDistributeEvenly,
+	bool bUseLateralOffset,
+	float MaxLateralOffsetCm,
+	int32 RandomSeed,
+	bool bDebugDraw
+)
+{
+	TSharedRef<FCurriculumTrackSpawnChain> Chain = MakeShared<FCurriculumTrackSpawnChain>();
+	Chain->World = World;
+	for (ARacingTrackInstance* Track : Tracks)
+	{
+		Chain->Tracks.Add(Track);
+	}
+	Chain->CarsPerTrack = SplitCarsAcrossTracks(NumCars, Tracks.Num());
+	Chain->PawnClass = PawnClass;
+	Chain->OnComplete = MoveTemp(OnComplete);
+	Chain->MinSpawnScore = MinSpawnScore;
+	Chain->SpawnHeightOffset = SpawnHeightOffset;
+	Chain->bDistributeEvenly = bDistributeEvenly;
+	Chain->bUseLateralOffset = bUseLateralOffset;
+	Chain->MaxLateralOffsetCm = MaxLateralOffsetCm;
+	Chain->RandomSeed = RandomSeed;
+	Chain->bDebugDraw = bDebugDraw;
+
+	UE_LOG(LogTemp, Log, TEXT("CurriculumSpawner: Multi-Track Spawn - %d Autos auf %d Tracks"), NumCars, Tracks.Num());
+
+	SpawnNextTrackAsync(Chain);
+}
+
+void UCurriculumSpawner::SpawnNextTrackAsync(TSharedRef<FCurriculumTrackSpawnChain> Chain)
+{
+	// Nächsten Track mit Spline und Autos suchen
+	while (Chain->TrackIndex < Chain->Tracks.Num())
+	{
+		const int32 i = Chain->TrackIndex;
+		ARacingTrackInstance* Track = Chain->Tracks[i].Get();
+		if (Track && Track->GetTrackSpline() && Chain->CarsPerTrack[i] > 0)
+		{
+			break;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("CurriculumSpawner: Track %s übersprungen (keine Spline oder keine Autos)"),
+			*GetNameSafe(Track));
+		++Chain->TrackIndex;
+	}
+
+	if (Chain->TrackIndex >= Chain->Tracks.Num())
+	{
+		ActiveTrack.Reset();
+
+		UE_LOG(LogTemp, Log, TEXT("CurriculumSpawner: Multi-Track Spawn fertig - %d Autos"), Chain->TotalSpawned);
+
+		if (Chain->OnComplete)
+		{
+			Chain->OnComplete(Chain->TotalSpawned);
+		}
+		return;
+	}
+
+	const int32 i = Chain->TrackIndex;
+	ARacingTrackInstance* Track = Chain->Tracks[i].Get();
+	ActiveTrack = Track;
+
+	SpawnCurriculumCarsAsync(
+		Chain->World,
+		Track->GetTrackSpline(),
+		Chain->PawnClass,
+		Chain->CarsPerTrack[i],
+		[this, Chain](int32 SpawnedCount)
+		{
+			Chain->TotalSpawned += SpawnedCount;
+			++Chain->TrackIndex;
+			SpawnNextTrackAsync(Chain);
+		},
+		Chain->MinSpawnScore,
+		Chain->SpawnHeightOffset,
+		Chain->bDistributeEvenly,
+		Chain->bUseLateralOffset,
+		Chain->MaxLateralOffsetCm,
+		Chain->RandomSeed != 0 ? Chain->RandomSeed + i : 0,
+		Chain->bDebugDraw
+	);
+}
+
+// ============================================================================
+// Spawn / Pool
+// ============================================================================
+
+APawn* UCurriculumSpawner::SpawnCurriculumPawn(
+	UWorld* World,
+	TSubclassOf<APawn> PawnClass,
+	const FVector& SpawnLocation,
+	const FRotator& SpawnRotation) const
+{
+	if (!World || !PawnClass)
+	{
+		return nullptr;
+	}
+
+	APawn* Pawn = nullptr;
+
+	URacingVehiclePoolSubsystem* Pool = bUseVehiclePool ? World->GetSubsystem<URacingVehiclePoolSubsystem>() : nullptr;
+	if (Pool)
+	{
+		// Pool: kein Actor-Spawn, nur Teleport + Reset
+		Pawn = Pool->AcquireVehicle(PawnClass, FTransform(SpawnRotation, SpawnLocation));
+	}
+	else
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		Pawn = World->SpawnActor<APawn>(PawnClass, SpawnLocation, SpawnRotation, SpawnParams);
+	}
+
+	if (Pawn)
+	{
+		Pawn->Tags.AddUnique(TEXT("CurriculumCar"));
+
+		// Multi-Track: Agent an den Track binden, auf dem er gespawnt wurde
+		if (ARacingTrackInstance* Track = ActiveTrack.Get())
+		{
+			Pawn->Tags.AddUnique(Track->TrackId);
+
+			if (URacingAgentComponent* Agent = Pawn->FindComponentByClass<URacingAgentComponent>())
+			{
+				Agent->BindToTrack(Track);
+			}
+		}
+
+		// Setze Actor in "AICars" Folder im Outliner
+		#if WITH_EDITOR
+		if (GIsEditor)
+		{
+			Pawn->SetFolderPath(FName(TEXT("AICars")));
+		}
+		#endif
+	}
+
+	return Pawn;
+}
@@ -4,7 +4,13 @@
 #include "NN/SimpleNeuralNetwork.h"
 
 #include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "PhysicsEngine/PhysicsSettings.h"
 #include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFilemanager.h"
@@ -17,6 +23,14 @@
 // Lifecycle
 // ============================================================================
 
+void UNEATTrainingManager::BeginDestroy()
+{
+	// A manager dropped mid-run (or while paused) must not leave the engine in simulation mode
+	RestoreSimulationSettings();
+
+	Super::BeginDestroy();
+}
+
 void UNEATTrainingManager::StartTraining()
 {
 	if (TrainingState != ENEATTrainingState::Idle)
@@ -43,6 +57,10 @@ void UNEATTrainingManager::StartTraining()
 	TrainingStats.TrainingStartTime = FDateTime::Now();
 	CurrentGeneration = 0;
 	GenomeFitnessMap.Empty();
+	AccumulatedWallSeconds = 0.0;
+	AccumulatedSimSeconds = 0.0;
+
+	ApplySimulationSettings();
 
 	UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] Starting NEAT training"));
 	UE_LOG(LogTemp, Log, TEXT("  Generations: %d"), NumGenerations);
@@ -66,10 +84,8 @@ void UNEATTrainingManager::StopTraining()
 	UE_LOG(LogTemp, Warning, TEXT("[NEATTrainingManager] Stopping training..."));
 
 	// Stop evaluation timer
-	if (GetWorld())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(EvaluationTickTimer);
-	}
+	StopEvaluationTicking();
+	ReleaseAllAgentGenomes();
 
 	// Stop Python if running
 	if (PythonExecutor && PythonExecutor->IsTrainingInProgress())
@@ -80,6 +96,8 @@ void UNEATTrainingManager::StopTraining()
 	TrainingState = ENEATTrainingState::Idle;
 	bWaitingForPython = false;
 
+	RestoreSimulationSettings();
+
 	OnTrainingComplete.Broadcast();
 }
 
@@ -287,9 +305,15 @@ bool UNEATTrainingManager::LoadGenomeFromJSON(const FString& FilePath, FNEATGeno
 
 void UNEATTrainingManager::AssignGenomesToAgents()
 {
+	NextGenomeIndex = 0;
+	GenomesInFlight.Reset();
+	RequeuedGenomeIndices.Reset();
+	ReclaimedGenomeIndices.Reset();
+	AgentsAwaitingGenome.Reset();
+
 	int32 AssignedCount = 0;
 
-	for (int32 i = 0; i < Agents.Num() && i < CurrentGenomes.Num(); ++i)
+	for (int32 i = 0; i < Agents.Num(); ++i)
 	{
 		URacingAgentComponent* Agent = Agents[i].Get();
 		if (!Agent)
@@ -297,39 +321,246 @@ void UNEATTrainingManager::AssignGenomesToAgents()
 			continue;
 		}
 
-		const FNEATGenomeData& Genome = CurrentGenomes[i];
+		// New generation: no cutoff until FitnessCeilingRank genomes are evaluated
+		Agent->FitnessCutoff = 0.f;
 
-		// Assign genome ID
-		Agent->GenomeID = Genome.GenomeID;
-		Agent->Generation = CurrentGeneration;
+		if (AssignNextGenome(Agent))
+		{
+			AssignedCount++;
+		}
+		else
+		{
+			// More agents than genomes: stays idle this generation
+			ReleaseAgentGenome(Agent);
+		}
+	}
 
-		// TODO: Load genome into SimpleNeuralNetwork
-		// For now, agents will use random/heuristic actions
-		// Full NEAT genome loading would require NEAT-compatible network builder
+	UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] Assigned %d genomes to agents (%d queued)"),
+		AssignedCount, CurrentGenomes.Num() - NextGenomeIndex);
+}
 
-		AssignedCount++;
+bool UNEATTrainingManager::AssignNextGenome(URacingAgentComponent* Agent)
+{
+	if (!Agent)
+	{
+		return false;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] Assigned %d genomes to agents"), AssignedCount);
+	// Genomes taken back from lost agents go first
+	int32 GenomeIndex = INDEX_NONE;
+	if (RequeuedGenomeIndices.Num() > 0)
+	{
+		GenomeIndex = RequeuedGenomeIndices.Pop(EAllowShrinking::No);
+	}
+	else if (CurrentGenomes.IsValidIndex(NextGenomeIndex))
+	{
+		GenomeIndex = NextGenomeIndex++;
+	}
+	else
+	{
+		return false;
+	}
+
+	const FNEATGenomeData& Genome = CurrentGenomes[GenomeIndex];
+
+	// Assign genome ID
+	Agent->GenomeID = Genome.GenomeID;
+	Agent->Generation = CurrentGeneration;
+	Agent->EpisodeIndex = 0;
+	Agent->EpisodeTimeLimitSeconds = MaxEpisodeDuration;
+
+	if (SimulationSettings.bDeterministicEvaluation)
+	{
+		if (!Agent->bDeterministicSeeding)
+		{
+			Agent->bDeterministicSeeding = true;
+			AgentsSeededByManager.AddUnique(Agent);
+		}
+		Agent->DeterministicBaseSeed = SimulationSettings.DeterministicSeed;
+	}
+
+	// TODO: Load genome into SimpleNeuralNetwork
+	// For now, agents will use random/heuristic actions
+	// Full NEAT genome loading would require NEAT-compatible network builder
+
+	GenomesInFlight.Add({ Agent, GenomeIndex });
+	return true;
+}
+
+void UNEATTrainingManager::DispatchQueuedGenomes()
+{
+	for (TWeakObjectPtr<URacingAgentComponent>& WeakAgent : AgentsAwaitingGenome)
+	{
+		URacingAgentComponent* Agent = WeakAgent.Get();
+		if (!Agent)
+		{
+			continue;
+		}
+
+		if (AssignNextGenome(Agent))
+		{
+			Agent->ResetEpisode();
+		}
+		else
+		{
+			// Queue drained: agent idles until the next generation
+			ReleaseAgentGenome(Agent);
+		}
+	}
+
+	AgentsAwaitingGenome.Reset();
+}
+
+void UNEATTrainingManager::ReleaseAgentGenome(URacingAgentComponent* Agent)
+{
+	if (!Agent)
+	{
+		return;
+	}
+
+	Agent->GenomeID = -1;
+
+	if (AgentsSeededByManager.Remove(Agent) > 0)
+	{
+		Agent->bDeterministicSeeding = false;
+	}
+}
+
+void UNEATTrainingManager::ReleaseAllAgentGenomes()
+{
+	for (TWeakObjectPtr<URacingAgentComponent>& WeakAgent : Agents)
+	{
+		ReleaseAgentGenome(WeakAgent.Get());
+	}
+
+	AgentsSeededByManager.Reset();
+}
+
+void UNEATTrainingManager::FinishAgentGenome(URacingAgentComponent* Agent)
+{
+	GenomesInFlight.RemoveAll([Agent](const FGenomeInFlight& Entry)
+	{
+		return Entry.Agent.Get() == Agent;
+	});
+}
+
+void UNEATTrainingManager::ReclaimLostGenomes()
+{
+	for (int32 i = GenomesInFlight.Num() - 1; i >= 0; --i)
+	{
+		const FGenomeInFlight Entry = GenomesInFlight[i];
+		const URacingAgentComponent* Agent = Entry.Agent.Get();
+		const int32 GenomeID = CurrentGenomes.IsValidIndex(Entry.GenomeIndex) ? CurrentGenomes[Entry.GenomeIndex].GenomeID : -1;
+
+		// Destroyed, pooled away (unregistered) or handed another genome by someone else
+		const bool bLost = !Agent || !Agents.Contains(Entry.Agent) || Agent->GenomeID != GenomeID;
+		if (!bLost)
+		{
+			continue;
+		}
+
+		GenomesInFlight.RemoveAt(i);
+
+		if (ReclaimedGenomeIndices.Contains(Entry.GenomeIndex))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[NEATTrainingManager] Genome %d lost its agent twice, scoring 0"), GenomeID);
+
+			RecordGenomeFitness(GenomeID, 0.f);
+			TrainingStats.TotalEvaluations++;
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[NEATTrainingManager] Genome %d lost its agent mid-episode, requeued"), GenomeID);
+
+			ReclaimedGenomeIndices.Add(Entry.GenomeIndex);
+			RequeuedGenomeIndices.Add(Entry.GenomeIndex);
+		}
+	}
+}
+
+float UNEATTrainingManager::GetGenerationTimeout() const
+{
+	if (!bUseGenomeWorkQueue)
+	{
+		return MaxEpisodeDuration;
+	}
+
+	return MaxGenerationDuration > 0.f
+		? MaxGenerationDuration
+		: MaxEpisodeDuration * (CurrentGenomes.Num() + 1);
+}
+
+void UNEATTrainingManager::EnforceEpisodeTimeouts()
+{
+	ReclaimLostGenomes();
+
+	for (TWeakObjectPtr<URacingAgentComponent>& WeakAgent : Agents)
+	{
+		URacingAgentComponent* Agent = WeakAgent.Get();
+		if (!Agent || Agent->GenomeID < 0 || Agent->IsDone())
+		{
+			continue;
+		}
+
+		FEpisodeStats Stats = Agent->GetEpisodeStats();
+		if (Stats.DurationSeconds < MaxEpisodeDuration)
+		{
+			continue;
+		}
+
+		Stats.TerminationReason = TEXT("Timeout");
+		Stats.CalculateNEATFitness();
+
+		RecordGenomeFitness(Agent->GenomeID, Stats.NEATFitness);
+		TrainingStats.TotalEvaluations++;
+
+		Agent->ParkAgent();
+		FinishAgentGenome(Agent);
+		AgentsAwaitingGenome.AddUnique(Agent);
+	}
+}
+
+bool UNEATTrainingManager::IsGenomeQueueDrained() const
+{
+	return NextGenomeIndex >= CurrentGenomes.Num() && GenomesInFlight.Num() == 0 &&
+		RequeuedGenomeIndices.Num() == 0 && AgentsAwaitingGenome.Num() == 0;
 }
 
 void UNEATTrainingManager::StartEpisodeEvaluation()
 {
 	UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] Starting episode evaluation (Gen %d)"), CurrentGeneration);
 
-	// Reset all agents
+	// Reset agents holding a genome, idle the rest
 	for (TWeakObjectPtr<URacingAgentComponent>& WeakAgent : Agents)
 	{
 		if (URacingAgentComponent* Agent = WeakAgent.Get())
 		{
-			Agent->ResetEpisode();
+			if (Agent->GenomeID >= 0)
+			{
+				Agent->ResetEpisode();
+			}
+			else
+			{
+				Agent->ParkAgent();
+			}
 		}
 	}
 
 	// Start evaluation timer
 	EvaluationTimeElapsed = 0.f;
+	EvaluationWallStartSeconds = FPlatformTime::Seconds();
+	EvaluationSimStartSeconds = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
 
-	if (GetWorld())
+	if (SimulationSettings.StepsAgentsFromManager())
+	{
+		// Step agents and evaluate every frame with the real (fixed) frame delta
+		if (!PreActorTickHandle.IsValid())
+		{
+			PreActorTickHandle = FWorldDelegates::OnWorldPreActorTick.AddUObject(
+				this, &UNEATTrainingManager::HandleWorldPreActorTick);
+		}
+	}
+	else if (GetWorld())
 	{
 		GetWorld()->GetTimerManager().SetTimer(
 			EvaluationTickTimer,
@@ -349,14 +580,21 @@ void UNEATTrainingManager::TickEvaluation(float DeltaTime)
 
 	EvaluationTimeElapsed += DeltaTime;
 
-	// Check if all agents are done
-	if (AreAllAgentsDone())
+	if (bUseGenomeWorkQueue)
+	{
+		EnforceEpisodeTimeouts();
+		DispatchQueuedGenomes();
+	}
+
+	// Generation done: queue drained, or (without queue) all agents done
+	const bool bGenerationDone = bUseGenomeWorkQueue ? IsGenomeQueueDrained() : AreAllAgentsDone();
+
+	if (bGenerationDone)
 	{
 		// Stop evaluation
-		if (GetWorld())
-		{
-			GetWorld()->GetTimerManager().ClearTimer(EvaluationTickTimer);
-		}
+		StopEvaluationTicking();
+		UpdateThroughputStats();
+		ReleaseAllAgentGenomes();
 
 		// Export fitness
 		ExportFitnessValues();
@@ -371,6 +609,7 @@ void UNEATTrainingManager::TickEvaluation(float DeltaTime)
 		{
 			// Training complete!
 			TrainingState = ENEATTrainingState::Completed;
+			RestoreSimulationSettings();
 			OnTrainingComplete.Broadcast();
 
 			UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] Training completed! (%d generations)"), NumGenerations);
@@ -381,16 +620,16 @@ void UNEATTrainingManager::TickEvaluation(float DeltaTime)
 			TriggerPythonEvolution();
 		}
 	}
-	else if (EvaluationTimeElapsed >= MaxEpisodeDuration)
+	else if (EvaluationTimeElapsed >= GetGenerationTimeout())
 	{
-		// Timeout - force all agents done
-		UE_LOG(LogTemp, Warning, TEXT("[NEATTrainingManager] Evaluation timeout (%.1fs)"), MaxEpisodeDuration);
+		// Timeout - force all agents done (work queue: fallback if genomes never come back)
+		UE_LOG(LogTemp, Warning, TEXT("[NEATTrainingManager] Evaluation timeout (%.1fs)"), GetGenerationTimeout());
 
 		for (TWeakObjectPtr<URacingAgentComponent>& WeakAgent : Agents)
 		{
 			if (URacingAgentComponent* Agent = WeakAgent.Get())
 			{
-				if (!Agent->IsDone())
+				if (Agent->GenomeID >= 0 && !Agent->IsDone())
 				{
 					// Force episode end
 					FEpisodeStats Stats = Agent->GetEpisodeStats();
@@ -404,10 +643,9 @@ void UNEATTrainingManager::TickEvaluation(float DeltaTime)
 		}
 
 		// Export and continue
-		if (GetWorld())
-		{
-			GetWorld()->GetTimerManager().ClearTimer(EvaluationTickTimer);
-		}
+		StopEvaluationTicking();
+		UpdateThroughputStats();
+		ReleaseAllAgentGenomes();
 
 		ExportFitnessValues();
 		CurrentGeneration++;
@@ -433,26 +671,24 @@ bool UNEATTrainingManager::AreAllAgentsDone() const
 
 void UNEATTrainingManager::OnAgentEpisodeDone(const FEpisodeStats& Stats)
 {
-	// Find agent that triggered this
+	// Find agent that triggered this (GenomeID is unique per generation, StartTime is not)
 	for (TWeakObjectPtr<URacingAgentComponent>& WeakAgent : Agents)
 	{
 		if (URacingAgentComponent* Agent = WeakAgent.Get())
 		{
-			if (Agent->GetEpisodeStats().StartTime == Stats.StartTime)
+			const bool bMatches = Stats.GenomeID >= 0
+				? Agent->GenomeID == Stats.GenomeID
+				: Agent->GetEpisodeStats().StartTime == Stats.StartTime;
+
+			if (bMatches)
 			{
-				// Record fitness
-				GenomeFitnessMap.Add(Agent->GenomeID, Stats.NEATFitness);
+				RecordGenomeFitness(Agent->GenomeID, Stats.NEATFitness);
 
-				// Update best fitness
-				if (Stats.NEATFitness > TrainingStats.BestFitness)
+				// Pull the next genome on the next evaluation tick (not from inside StepOnce)
+				if (Agent->GenomeID >= 0)
 				{
-					TrainingStats.BestFitness = Stats.NEATFitness;
-					TrainingStats.BestGenomeID = Agent->GenomeID;
-
-					OnNewBestGenome.Broadcast(Agent->GenomeID, Stats.NEATFitness);
-
-					UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] New best genome! ID=%d, Fitness=%.2f"),
-						Agent->GenomeID, Stats.NEATFitness);
+					FinishAgentGenome(Agent);
+					AgentsAwaitingGenome.AddUnique(Agent);
 				}
 
 				break;
@@ -463,6 +699,48 @@ void UNEATTrainingManager::OnAgentEpisodeDone(const FEpisodeStats& Stats)
 	TrainingStats.TotalEvaluations++;
 }
 
+void UNEATTrainingManager::RecordGenomeFitness(int32 GenomeID, float Fitness)
+{
+	// Record fitness
+	GenomeFitnessMap.Add(GenomeID, Fitness);
+
+	// Update best fitness
+	if (Fitness > TrainingStats.BestFitness)
+	{
+		TrainingStats.BestFitness = Fitness;
+		TrainingStats.BestGenomeID = GenomeID;
+
+		OnNewBestGenome.Broadcast(GenomeID, Fitness);
+
+		UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] New best genome! ID=%d, Fitness=%.2f"),
+			GenomeID, Fitness);
+	}
+
+	UpdateFitnessCutoff();
+}
+
+void UNEATTrainingManager::UpdateFitnessCutoff()
+{
+	if (FitnessCeilingRank <= 0 || GenomeFitnessMap.Num() < FitnessCeilingRank)
+	{
+		return;
+	}
+
+	TArray<float> Fitnesses;
+	GenomeFitnessMap.GenerateValueArray(Fitnesses);
+	Fitnesses.Sort(TGreater<float>());
+
+	const float Cutoff = Fitnesses[FitnessCeilingRank - 1];
+
+	for (TWeakObjectPtr<URacingAgentComponent>& WeakAgent : Agents)
+	{
+		if (URacingAgentComponent* Agent = WeakAgent.Get())
+		{
+			Agent->FitnessCutoff = Cutoff;
+		}
+	}
+}
+
 // ============================================================================
 // Fitness Export
 // ============================================================================
@@ -482,15 +760,22 @@ void UNEATTrainingManager::ExportFitnessValues()
 
 	TArray<TSharedPtr<FJsonValue>> GenomesArray;
 
+	// Reduce in genome order so export and average do not depend on completion order
+	TArray<int32> SortedGenomeIDs;
+	GenomeFitnessMap.GenerateKeyArray(SortedGenomeIDs);
+	SortedGenomeIDs.Sort();
+
 	float TotalFitness = 0.f;
-	for (const TPair<int32, float>& Pair : GenomeFitnessMap)
+	for (const int32 GenomeID : SortedGenomeIDs)
 	{
+		const float Fitness = GenomeFitnessMap.FindChecked(GenomeID);
+
 		TSharedPtr<FJsonObject> GenomeObj = MakeShareable(new FJsonObject());
-		GenomeObj->SetNumberField(TEXT("genome_id"), Pair.Key);
-		GenomeObj->SetNumberField(TEXT("fitness"), Pair.Value);
+		GenomeObj->SetNumberField(TEXT("genome_id"), GenomeID);
+		GenomeObj->SetNumberField(TEXT("fitness"), Fitness);
 
 		GenomesArray.Add(MakeShareable(new FJsonValueObject(GenomeObj)));
-		TotalFitness += Pair.Value;
+		TotalFitness += Fitness;
 	}
 
 	RootObject->SetArrayField(TEXT("genomes"), GenomesArray);
@@ -602,4 +887,206 @@ bool UNEATTrainingManager::LoadBestGenome()
 	// This would require a NEAT-to-MLP converter or using a NEAT-compatible network
 
 	return true;
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// Simulation Mode (Headless / Accelerated)
+// ============================================================================
+
+void UNEATTrainingManager::ApplySimulationSettings()
+{
+	if (bSimulationSettingsApplied)
+	{
+		return;
+	}
+
+	// Capture current engine state so StopTraining can restore it
+	bPrevUseFixedTimeStep = FApp::UseFixedTimeStep();
+	PrevFixedDeltaTime = FApp::GetFixedDeltaTime();
+	bPrevSmoothFrameRate = GEngine ? GEngine->bSmoothFrameRate : false;
+
+	UPhysicsSettings* PhysSettings = UPhysicsSettings::Get();
+	bPrevSubstepping = PhysSettings->bSubstepping;
+	PrevMaxSubsteps = PhysSettings->MaxSubsteps;
+	PrevMaxSubstepDeltaTime = PhysSettings->MaxSubstepDeltaTime;
+
+	IConsoleVariable* VSyncCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.VSync"));
+	IConsoleVariable* MaxFPSCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("t.MaxFPS"));
+	PrevVSync = VSyncCVar ? VSyncCVar->GetInt() : 0;
+	PrevMaxFPS = MaxFPSCVar ? MaxFPSCVar->GetFloat() : 0.f;
+
+	UGameViewportClient* Viewport = GEngine ? GEngine->GameViewport : nullptr;
+	bPrevDisableWorldRendering = Viewport ? Viewport->bDisableWorldRendering : false;
+
+	const float FixedDt = FMath::Max(0.001f, SimulationSettings.FixedDeltaSeconds);
+
+	// Fixed timestep: every frame advances FixedDt of simulated time, as fast as the CPU allows
+	if (SimulationSettings.UsesFixedTimestep())
+	{
+		FApp::SetUseFixedTimeStep(true);
+		FApp::SetFixedDeltaTime(FixedDt);
+	}
+
+	// Physics substeps per frame. The substep length only follows FixedDt when frames have a fixed
+	// length; in real time the project's MaxSubstepDeltaTime is kept
+	if (SimulationSettings.PhysicsSubsteps > 1)
+	{
+		PhysSettings->bSubstepping = true;
+		PhysSettings->MaxSubsteps = SimulationSettings.PhysicsSubsteps;
+		if (SimulationSettings.UsesFixedTimestep())
+		{
+			PhysSettings->MaxSubstepDeltaTime = FixedDt / SimulationSettings.PhysicsSubsteps;
+		}
+	}
+
+	if (SimulationSettings.bDisableFrameRateLimits)
+	{
+		if (GEngine)
+		{
+			GEngine->bSmoothFrameRate = false;
+		}
+		if (VSyncCVar)
+		{
+			VSyncCVar->Set(0, ECVF_SetByCode);
+		}
+		if (MaxFPSCVar)
+		{
+			MaxFPSCVar->Set(0.f, ECVF_SetByCode);
+		}
+	}
+
+	if (SimulationSettings.bDisableWorldRendering && Viewport)
+	{
+		Viewport->bDisableWorldRendering = true;
+	}
+
+	// Restore when the training world goes away (end of PIE, map change) even if StopTraining is never called
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddUObject(this, &UNEATTrainingManager::HandleWorldCleanup);
+
+	bSimulationSettingsApplied = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] Simulation mode: FixedStep=%s (dt=%.4fs), Substeps=%d, Deterministic=%s, Rendering=%s%s"),
+		SimulationSettings.UsesFixedTimestep() ? TEXT("on") : TEXT("off"),
+		FixedDt,
+		SimulationSettings.PhysicsSubsteps,
+		SimulationSettings.bDeterministicEvaluation ? TEXT("on") : TEXT("off"),
+		(SimulationSettings.bDisableWorldRendering || !FApp::CanEverRender()) ? TEXT("off") : TEXT("on"),
+		!FApp::CanEverRender() ? TEXT(" (nullrhi)") : TEXT(""));
+}
+
+void UNEATTrainingManager::RestoreSimulationSettings()
+{
+	if (!bSimulationSettingsApplied)
+	{
+		return;
+	}
+
+	if (WorldCleanupHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+		WorldCleanupHandle.Reset();
+	}
+
+	FApp::SetUseFixedTimeStep(bPrevUseFixedTimeStep);
+	FApp::SetFixedDeltaTime(PrevFixedDeltaTime);
+
+	UPhysicsSettings* PhysSettings = UPhysicsSettings::Get();
+	PhysSettings->bSubstepping = bPrevSubstepping;
+	PhysSettings->MaxSubsteps = PrevMaxSubsteps;
+	PhysSettings->MaxSubstepDeltaTime = PrevMaxSubstepDeltaTime;
+
+	if (SimulationSettings.bDisableFrameRateLimits)
+	{
+		if (GEngine)
+		{
+			GEngine->bSmoothFrameRate = bPrevSmoothFrameRate;
+		}
+		if (IConsoleVariable* VSyncCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.VSync")))
+		{
+			VSyncCVar->Set(PrevVSync, ECVF_SetByCode);
+		}
+		if (IConsoleVariable* MaxFPSCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("t.MaxFPS")))
+		{
+			MaxFPSCVar->Set(PrevMaxFPS, ECVF_SetByCode);
+		}
+	}
+
+	if (UGameViewportClient* Viewport = GEngine ? GEngine->GameViewport : nullptr)
+	{
+		Viewport->bDisableWorldRendering = bPrevDisableWorldRendering;
+	}
+
+	bSimulationSettingsApplied = false;
+
+	UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] Simulation mode restored (%.2fx real time over %.1fs simulated)"),
+		TrainingStats.SimSecondsPerWallSecond, TrainingStats.SimulatedSeconds);
+}
+
+void UNEATTrainingManager::HandleWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources)
+{
+	if (GetWorld() && InWorld != GetWorld())
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[NEATTrainingManager] Training world cleaned up, restoring engine settings"));
+
+	// StopTraining is a no-op while paused (Idle), the restore below still runs
+	StopTraining();
+	RestoreSimulationSettings();
+}
+
+void UNEATTrainingManager::HandleWorldPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds)
+{
+	if (InWorld != GetWorld() || TrainingState != ENEATTrainingState::Evaluating)
+	{
+		return;
+	}
+
+	// Step agents in registration order before physics runs this frame
+	for (TWeakObjectPtr<URacingAgentComponent>& WeakAgent : Agents)
+	{
+		if (URacingAgentComponent* Agent = WeakAgent.Get())
+		{
+			if (!Agent->IsDone())
+			{
+				Agent->StepOnce(DeltaSeconds);
+			}
+		}
+	}
+
+	TickEvaluation(DeltaSeconds);
+}
+
+void UNEATTrainingManager::StopEvaluationTicking()
+{
+	if (GetWorld())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(EvaluationTickTimer);
+	}
+
+	if (PreActorTickHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldPreActorTick.Remove(PreActorTickHandle);
+		PreActorTickHandle.Reset();
+	}
+}
+
+void UNEATTrainingManager::UpdateThroughputStats()
+{
+	const double WallNow = FPlatformTime::Seconds();
+	const double SimNow = GetWorld() ? GetWorld()->GetTimeSeconds() : EvaluationSimStartSeconds;
+
+	AccumulatedWallSeconds += FMath::Max(0.0, WallNow - EvaluationWallStartSeconds);
+	AccumulatedSimSeconds += FMath::Max(0.0, SimNow - EvaluationSimStartSeconds);
+
+	TrainingStats.WallSeconds = (float)AccumulatedWallSeconds;
+	TrainingStats.SimulatedSeconds = (float)AccumulatedSimSeconds;
+	TrainingStats.SimSecondsPerWallSecond = AccumulatedWallSeconds > KINDA_SMALL_NUMBER
+		? (float)(AccumulatedSimSeconds / AccumulatedWallSeconds)
+		: 0.f;
+	TrainingStats.ElapsedSeconds = (float)(FDateTime::Now() - TrainingStats.TrainingStartTime).GetTotalSeconds();
+
+	UE_LOG(LogTemp, Log, TEXT("[NEATTrainingManager] Gen %d throughput: %.1fs simulated / %.1fs wall (%.2fx real time)"),
+		CurrentGeneration, TrainingStats.SimulatedSeconds, TrainingStats.WallSeconds, TrainingStats.SimSecondsPerWallSecond);
+}
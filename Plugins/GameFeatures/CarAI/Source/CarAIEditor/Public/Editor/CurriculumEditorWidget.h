@@ -32,6 +32,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Curriculum", meta = (ClampMin = 1))
 	int32 NumCars = 5;
 
+	/** Wenn die Welt RacingTrackInstances enthält: Autos reihum auf alle Tracks verteilen */
+	UPROPERTY(EditAnywhere, Category = "Curriculum")
+	bool bSpawnOnAllTracks = true;
+
 	/* ---------- Spawn Distribution ---------- */
 
 	/** Minimaler SpawnScore (0-1). Punkte mit niedrigerem Score werden ignoriert. */
@@ -105,6 +109,16 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Debug")
 	bool bDebugDraw = true;
 
+	/* ---------- Pooling ---------- */
+
+	/** Autos wiederverwenden (Pool) statt bei jedem Spawn neu zu erzeugen / zu zerstören */
+	UPROPERTY(EditAnywhere, Category = "Pooling")
+	bool bUseVehiclePool = false;
+
+	/** Zusätzliche Autos, die beim Spawn vorgewärmt werden (über NumCars hinaus) */
+	UPROPERTY(EditAnywhere, Category = "Pooling", meta = (ClampMin = 0, EditCondition = "bUseVehiclePool"))
+	int32 PoolPrewarmExtra = 0;
+
 	/* ---------- Actions ---------- */
 
 	UFUNCTION(CallInEditor, BlueprintCallable, Category = "Actions")
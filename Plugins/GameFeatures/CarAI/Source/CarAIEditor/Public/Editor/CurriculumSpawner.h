@@ -4,9 +4,13 @@
 #include "UObject/Object.h"
 #include "Async/Async.h"
 #include "HAL/ThreadSafeBool.h"
+#include "Track/TrackFrameTable.h"
 #include "CurriculumSpawner.generated.h"
 
 class USplineComponent;
+class ULevel;
+class ARacingTrackInstance;
+struct FCurriculumTrackSpawnChain;
 
 USTRUCT(BlueprintType)
 struct FCurriculumSpawnCandidate
@@ -90,6 +94,41 @@ public:
 		bool bDebugDraw = false
 	);
 
+	/**
+	 * Multi-Track: verteilt NumCars reihum auf die Tracks (ARacingTrackInstance) und spawnt
+	 * pro Track mit dessen Spline und NoSpawnZones. Gespawnte Agents werden an ihren Track gebunden.
+	 * Seed pro Track = RandomSeed + TrackIndex (0 bleibt zufällig). Tracks werden nacheinander asynchron gespawnt.
+	 */
+	void SpawnCurriculumCarsOnTracksAsync(
+		UWorld* World,
+		const TArray<ARacingTrackInstance*>& Tracks,
+		TSubclassOf<APawn> PawnClass,
+		int32 NumCars,
+		TFunction<void(int32 SpawnedCount)> OnComplete = nullptr,
+		float MinSpawnScore = 0.5f,
+		float SpawnHeightOffset = 50.f,
+		bool bDistributeEvenly = true,
+		bool bUseLateralOffset = true,
+		float MaxLateralOffsetCm = 300.f,
+		int32 RandomSeed = 0,
+		bool bDebugDraw = false
+	);
+
+	/** Multi-Track Synchron-Version (blockiert!) */
+	void SpawnCurriculumCarsOnTracks(
+		UWorld* World,
+		const TArray<ARacingTrackInstance*>& Tracks,
+		TSubclassOf<APawn> PawnClass,
+		int32 NumCars,
+		float MinSpawnScore = 0.5f,
+		float SpawnHeightOffset = 50.f,
+		bool bDistributeEvenly = true,
+		bool bUseLateralOffset = true,
+		float MaxLateralOffsetCm = 300.f,
+		int32 RandomSeed = 0,
+		bool bDebugDraw = false
+	);
+
 	/** Prüft ob ein Spawn gerade läuft */
 	bool IsSpawnInProgress() const { return bSpawnInProgress; }
 
@@ -128,6 +167,12 @@ public:
 	UPROPERTY(EditAnywhere, Category = "SpawnScore")
 	float CurvatureExponent = 1.6f;
 
+	// ----- Pooling -----
+
+	/** Autos aus dem URacingVehiclePoolSubsystem holen statt neu zu spawnen */
+	UPROPERTY(EditAnywhere, Category = "Pooling")
+	bool bUseVehiclePool = false;
+
 private:
 	/** Sammelt alle möglichen Spawn-Kandidaten entlang der Spline */
 	void BuildSpawnCandidates(
@@ -154,11 +199,21 @@ private:
 		float PitchDeg
 	) const;
 
-	/** Berechnet die Krümmung an einer Position */
-	float ComputeCurvatureInvCm(
-		USplineComponent* Spline,
-		float DistanceCm,
-		float WindowCm
+	/** Sample-Abstand der Frame-Tabelle, falls die Strecke keine gebackene liefert */
+	float GetFrameTableStepCm() const;
+
+	/** Surface Trace für einen Kandidaten (Game-Thread), setzt Location / SurfaceNormal / bValidSurface */
+	void TraceSpawnCandidate(
+		UWorld* World,
+		const FTrackFrameTable& Track,
+		FCurriculumSpawnCandidate& Candidate
+	) const;
+
+	/** Rotation, Krümmung, Score und NoSpawnZones für alle Kandidaten (ParallelFor) */
+	void ScoreSpawnCandidates(
+		UWorld* World,
+		const FTrackFrameTable& Track,
+		TArray<FCurriculumSpawnCandidate>& InOutCandidates
 	) const;
 
 	/** Berechnet den Pitch-Winkel aus der Forward-Richtung */
@@ -167,14 +222,20 @@ private:
 	/** Surface Trace an einer Spline-Position */
 	bool TraceSurface(
 		UWorld* World,
-		USplineComponent* Spline,
-		float DistanceCm,
+		const FVector& SplinePos,
+		const FVector& UpDir,
 		FVector& OutLocation,
 		FVector& OutNormal
 	) const;
 
-	/** Prüft ob ein Punkt in einer NoSpawnZone liegt */
-	bool IsInAnyNoSpawnZone(UWorld* World, const FVector& WorldPoint) const;
+	/** Level-Filter für den NoSpawnZone-Index (Level des aktiven Tracks, sonst null = alle) */
+	const ULevel* GetNoSpawnZoneLevel() const;
+
+	/** Autos pro Track (reihum verteilt) */
+	static TArray<int32> SplitCarsAcrossTracks(int32 NumCars, int32 NumTracks);
+
+	/** Spawnt den nächsten Track der Kette, danach rekursiv den Rest */
+	void SpawnNextTrackAsync(TSharedRef<FCurriculumTrackSpawnChain> Chain);
 
 	/** Führt BuildSpawnCandidates asynchron aus */
 	void BuildSpawnCandidatesAsync(
@@ -183,6 +244,17 @@ private:
 		TFunction<void(TArray<FCurriculumSpawnCandidate>)> OnComplete
 	);
 
+	/** Spawnt einen Pawn bzw. holt ihn aus dem Pool (inkl. Tag + Outliner-Folder) */
+	APawn* SpawnCurriculumPawn(
+		UWorld* World,
+		TSubclassOf<APawn> PawnClass,
+		const FVector& SpawnLocation,
+		const FRotator& SpawnRotation
+	) const;
+
 	/** Thread-safe Flag für laufenden Spawn */
 	FThreadSafeBool bSpawnInProgress = false;
+
+	/** Track des laufenden Multi-Track-Spawns (NoSpawnZones + Agent-Binding), null = Single-Track */
+	TWeakObjectPtr<ARacingTrackInstance> ActiveTrack;
 };
\ No newline at end of file
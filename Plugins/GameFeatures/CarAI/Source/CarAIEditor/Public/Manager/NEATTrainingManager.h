@@ -39,6 +39,22 @@ public:
 	UPROPERTY(EditAnywhere, Category = "NEAT Config")
 	float MaxEpisodeDuration = 120.f;
 
+	/** Hand the next unevaluated genome to an agent as soon as its episode ends.
+	 *  The generation completes when the queue is drained, so the population may exceed the agent count.
+	 *  MaxEpisodeDuration then applies per episode instead of per generation. */
+	UPROPERTY(EditAnywhere, Category = "NEAT Config")
+	bool bUseGenomeWorkQueue = true;
+
+	/** Work queue fallback: end the generation after this long even if genomes are still out (seconds).
+	 *  0 = MaxEpisodeDuration x (population + 1), i.e. one agent evaluating every genome. */
+	UPROPERTY(EditAnywhere, Category = "NEAT Config", meta = (ClampMin = 0, EditCondition = "bUseGenomeWorkQueue"))
+	float MaxGenerationDuration = 0.f;
+
+	/** Stop genomes that can no longer beat the Nth best fitness of the current generation (0 = off).
+	 *  Set to the number of genomes the selection keeps; cut genomes report their fitness so far. */
+	UPROPERTY(EditAnywhere, Category = "NEAT Config", meta = (ClampMin = 0))
+	int32 FitnessCeilingRank = 0;
+
 	/** Export directory for fitness values */
 	UPROPERTY(EditAnywhere, Category = "NEAT Config")
 	FString FitnessExportDir = TEXT("Saved/Training/Fitness");
@@ -55,6 +71,10 @@ public:
 	UPROPERTY(EditAnywhere, Category = "NEAT Config")
 	FString PythonExecutable = TEXT("python");
 
+	/** Engine settings for accelerated / headless training (fixed dt, no vsync, substeps) */
+	UPROPERTY(EditAnywhere, Category = "NEAT Config|Simulation")
+	FRacingSimulationSettings SimulationSettings;
+
 	// ===== Training Control =====
 
 	UFUNCTION(BlueprintCallable, Category = "NEAT Training")
@@ -108,6 +128,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "NEAT Training")
 	FOnTrainingComplete OnTrainingComplete;
 
+	//~ Begin UObject Interface
+	virtual void BeginDestroy() override;
+	//~ End UObject Interface
+
 protected:
 	// ===== Internal Methods =====
 
@@ -117,6 +141,42 @@ protected:
 	/** Assign genomes to agents */
 	void AssignGenomesToAgents();
 
+	/** Pop the next unevaluated genome onto an agent. Returns false if the queue is empty. */
+	bool AssignNextGenome(URacingAgentComponent* Agent);
+
+	/** Agent goes idle: clear its genome and the deterministic seeding the manager switched on */
+	void ReleaseAgentGenome(URacingAgentComponent* Agent);
+
+	/** ReleaseAgentGenome on every agent (generation / training end) */
+	void ReleaseAllAgentGenomes();
+
+	/** Give agents that finished an episode their next genome (or leave them idle) */
+	void DispatchQueuedGenomes();
+
+	/** End queue episodes that exceeded MaxEpisodeDuration */
+	void EnforceEpisodeTimeouts();
+
+	/** Agent finished its genome (scored): drop it from GenomesInFlight */
+	void FinishAgentGenome(URacingAgentComponent* Agent);
+
+	/**
+	 * Take back genomes whose agent was destroyed, unregistered or re-assigned mid-episode.
+	 * A genome is requeued once; lost a second time it is scored 0 so the generation can finish.
+	 */
+	void ReclaimLostGenomes();
+
+	/** Evaluation time after which the generation is forced to end */
+	float GetGenerationTimeout() const;
+
+	/** All genomes handed out and evaluated */
+	bool IsGenomeQueueDrained() const;
+
+	/** Store fitness for a genome and track the best one */
+	void RecordGenomeFitness(int32 GenomeID, float Fitness);
+
+	/** Push the current FitnessCeilingRank-th best fitness to all agents */
+	void UpdateFitnessCutoff();
+
 	/** Start episode evaluation for all agents */
 	void StartEpisodeEvaluation();
 
@@ -146,6 +206,26 @@ protected:
 	UFUNCTION()
 	void OnAgentEpisodeDone(const FEpisodeStats& Stats);
 
+	// ===== Simulation Mode =====
+
+	/** Apply SimulationSettings to the engine (fixed timestep, substeps, rendering) */
+	void ApplySimulationSettings();
+
+	/** Restore the engine settings captured by ApplySimulationSettings */
+	void RestoreSimulationSettings();
+
+	/** Restores the engine settings when the training world is torn down */
+	void HandleWorldCleanup(UWorld* InWorld, bool bSessionEnded, bool bCleanupResources);
+
+	/** Per-frame hook (before actor tick) used when the manager steps agents itself */
+	void HandleWorldPreActorTick(UWorld* InWorld, ELevelTick TickType, float DeltaSeconds);
+
+	/** Stop the evaluation timer / per-frame hook */
+	void StopEvaluationTicking();
+
+	/** Update simulated-vs-wall time throughput in TrainingStats */
+	void UpdateThroughputStats();
+
 private:
 	UPROPERTY() ENEATTrainingState TrainingState = ENEATTrainingState::Idle;
 	UPROPERTY() FNEATTrainingStats TrainingStats;
@@ -157,4 +237,40 @@ private:
 	UPROPERTY() float EvaluationTimeElapsed = 0.f;
 	UPROPERTY() FTimerHandle EvaluationTickTimer;
 	UPROPERTY() bool bWaitingForPython = false;
+
+	// Genome work queue (index into CurrentGenomes)
+	struct FGenomeInFlight
+	{
+		TWeakObjectPtr<URacingAgentComponent> Agent;
+		int32 GenomeIndex = INDEX_NONE;
+	};
+
+	int32 NextGenomeIndex = 0;
+	TArray<FGenomeInFlight> GenomesInFlight;
+	TArray<int32> RequeuedGenomeIndices;
+	TSet<int32> ReclaimedGenomeIndices;
+	TArray<TWeakObjectPtr<URacingAgentComponent>> AgentsAwaitingGenome;
+
+	// Agents whose bDeterministicSeeding was switched on by bDeterministicEvaluation
+	TArray<TWeakObjectPtr<URacingAgentComponent>> AgentsSeededByManager;
+
+	// Throughput measurement (simulated vs. wall time)
+	double EvaluationWallStartSeconds = 0.0;
+	double EvaluationSimStartSeconds = 0.0;
+	double AccumulatedWallSeconds = 0.0;
+	double AccumulatedSimSeconds = 0.0;
+
+	// Engine state captured before ApplySimulationSettings
+	bool bSimulationSettingsApplied = false;
+	bool bPrevUseFixedTimeStep = false;
+	double PrevFixedDeltaTime = 0.0;
+	bool bPrevSmoothFrameRate = false;
+	bool bPrevSubstepping = false;
+	int32 PrevMaxSubsteps = 0;
+	float PrevMaxSubstepDeltaTime = 0.f;
+	int32 PrevVSync = 0;
+	float PrevMaxFPS = 0.f;
+	bool bPrevDisableWorldRendering = false;
+	FDelegateHandle PreActorTickHandle;
+	FDelegateHandle WorldCleanupHandle;
 };
\ No newline at end of file
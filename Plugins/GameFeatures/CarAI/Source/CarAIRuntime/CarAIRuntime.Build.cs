@@ -47,6 +47,8 @@ public class CarAIRuntime : ModuleRules
                 "CarStatisticsRuntime",
 				"Json",
 				"JsonUtilities",
+				"Sockets",
+				"Networking",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
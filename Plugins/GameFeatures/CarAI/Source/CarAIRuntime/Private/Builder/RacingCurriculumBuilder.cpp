@@ -3,24 +3,23 @@
 #include "Components/TrackFrameProviderComponent.h"
 #include "Components/SplineComponent.h"
 #include "Engine/World.h"
-#include "EngineUtils.h"
+#include "Async/ParallelFor.h"
 
-// NoSpawnZone support
-#include "Actors/NoSpawnZoneActor.h"
+#include "Track/TrackFrameTable.h"
+#include "Subsystems/NoSpawnZoneSubsystem.h"
 
-static bool FindSplineLengthCm(UTrackFrameProviderComponent* TrackProvider, float& OutLenCm)
+static USplineComponent* FindTrackSpline(UTrackFrameProviderComponent* TrackProvider)
 {
-	OutLenCm = 0.f;
-	if (!TrackProvider) return false;
+	if (!TrackProvider) return nullptr;
 
-	AActor* Owner = TrackProvider->GetOwner();
-	if (!Owner) return false;
-
-	USplineComponent* Spline = Owner->FindComponentByClass<USplineComponent>();
-	if (!Spline) return false;
+	// The spline the provider's frames come from, else the one on its owner
+	if (USplineComponent* Spline = TrackProvider->GetResolvedSpline())
+	{
+		return Spline;
+	}
 
-	OutLenCm = Spline->GetSplineLength();
-	return (OutLenCm > 1.f);
+	AActor* Owner = TrackProvider->GetOwner();
+	return Owner ? Owner->FindComponentByClass<USplineComponent>() : nullptr;
 }
 
 float URacingCurriculumBuilder::WrapDistance(float S, float LengthCm, bool bLooped)
@@ -37,42 +36,11 @@ float URacingCurriculumBuilder::WrapDistance(float S, float LengthCm, bool bLoop
 	return FMath::Clamp(S, 0.f, LengthCm);
 }
 
-float URacingCurriculumBuilder::ComputeCurvatureInvCm(
-	UTrackFrameProviderComponent* TrackProvider,
-	float DistanceCm,
-	float WindowCm,
-	bool bLooped,
-	float SplineLengthCm,
-	FVector& InOutForward)
-{
-	if (!TrackProvider || SplineLengthCm <= 1.f)
-	{
-		return 0.f;
-	}
-
-	const float ds = FMath::Max(10.f, WindowCm);
-	const float SA = WrapDistance(DistanceCm - ds, SplineLengthCm, bLooped);
-	const float SB = WrapDistance(DistanceCm + ds, SplineLengthCm, bLooped);
-
-	const FTrackFrame A = TrackProvider->ComputeFrameAtDistance(SA, InOutForward);
-	InOutForward = A.Tangent.GetSafeNormal();
-
-	const FTrackFrame B = TrackProvider->ComputeFrameAtDistance(SB, InOutForward);
-	InOutForward = B.Tangent.GetSafeNormal();
-
-	const FVector TA = A.Tangent.GetSafeNormal();
-	const FVector TB = B.Tangent.GetSafeNormal();
-
-	const float dT = (TB - TA).Size();
-	return dT / FMath::Max(2.f * ds, 1.f); // ~1/cm
-}
-
 int32 URacingCurriculumBuilder::BuildTagMask(
-	UTrackFrameProviderComponent* TrackProvider,
+	const FTrackFrameTable& Track,
 	float S,
 	float SplineLengthCm,
 	const FRacingCurriculumBuildSettings& Settings,
-	FVector& InOutForward,
 	float& OutCurvNormAbs,
 	float& OutSlopeZ,
 	bool& bOutRampApproach,
@@ -83,28 +51,24 @@ int32 URacingCurriculumBuilder::BuildTagMask(
 	bOutRampApproach = false;
 	bOutOnRamp = false;
 
-	if (!TrackProvider || SplineLengthCm <= 1.f)
+	if (!Track.IsValid() || SplineLengthCm <= 1.f)
 	{
 		return 0;
 	}
 
 	const float SS = WrapDistance(S, SplineLengthCm, Settings.bLoopedTrack);
-	const FTrackFrame Base = TrackProvider->ComputeFrameAtDistance(SS, InOutForward);
-	InOutForward = Base.Tangent.GetSafeNormal();
+	const FVector BasePos = Track.GetLocationAtDistance(SS);
 
-	const float SlopeZ = Base.Tangent.GetSafeNormal().Z;
+	const float SlopeZ = Track.GetSlopeAtDistance(SS);
 	OutSlopeZ = SlopeZ;
 
-	const float CurvInvCm = ComputeCurvatureInvCm(TrackProvider, SS, Settings.CurvatureWindowCm, Settings.bLoopedTrack, SplineLengthCm, InOutForward);
+	const float CurvInvCm = Track.ComputeCurvatureInvCm(SS, Settings.CurvatureWindowCm);
 	const float CurvNorm = (Settings.CurvatureNormInvCm > KINDA_SMALL_NUMBER) ? (CurvInvCm / Settings.CurvatureNormInvCm) : 0.f;
 	OutCurvNormAbs = FMath::Abs(CurvNorm);
 
 	const float SAhead = WrapDistance(SS + Settings.RampLookaheadCm, SplineLengthCm, Settings.bLoopedTrack);
-	const FTrackFrame Ahead = TrackProvider->ComputeFrameAtDistance(SAhead, InOutForward);
-	InOutForward = Ahead.Tangent.GetSafeNormal();
-
-	const float Rise = Ahead.ClosestPoint.Z - Base.ClosestPoint.Z;
-	const float AheadSlopeZ = Ahead.Tangent.GetSafeNormal().Z;
+	const float Rise = Track.GetLocationAtDistance(SAhead).Z - BasePos.Z;
+	const float AheadSlopeZ = Track.GetSlopeAtDistance(SAhead);
 
 	const bool bRampApproach = (Rise > Settings.RampRiseThresholdCm) && (AheadSlopeZ > Settings.RampTangentZThreshold);
 	const bool bOnRamp = (SlopeZ > Settings.RampTangentZThreshold);
@@ -178,32 +142,7 @@ void URacingCurriculumBuilder::ComputeSpeedAndSteerHints(
 	}
 }
 
-	static bool IsInAnyNoSpawnZone(UWorld* World, const FVector& WorldPoint)
-	{
-		if (!World)
-		{
-			return false;
-		}
-
-		for (TActorIterator<ANoSpawnZoneActor> It(World); It; ++It)
-		{
-			ANoSpawnZoneActor* Zone = *It;
-			if (!IsValid(Zone))
-			{
-				continue;
-			}
-
-			// Use the ContainsPoint method from NoSpawnZoneActor
-			if (Zone->ContainsPoint(WorldPoint))
-			{
-				return true;
-			}
-		}
-
-		return false;
-	}
-
-	bool URacingCurriculumBuilder::BuildFromTrackProvider(
+bool URacingCurriculumBuilder::BuildFromTrackProvider(
 	UTrackFrameProviderComponent* TrackProvider,
 	const FRacingCurriculumBuildSettings& Settings,
 	float& OutSplineLengthCm,
@@ -212,47 +151,84 @@ void URacingCurriculumBuilder::ComputeSpeedAndSteerHints(
 	OutSegments.Reset();
 	OutSplineLengthCm = 0.f;
 
-	if (!TrackProvider)
+	USplineComponent* Spline = FindTrackSpline(TrackProvider);
+	if (!Spline || Spline->GetSplineLength() <= 1.f)
 	{
 		return false;
 	}
 
-	if (!FindSplineLengthCm(TrackProvider, OutSplineLengthCm))
+	OutSplineLengthCm = Spline->GetSplineLength();
+
+	const float Step = FMath::Max(10.f, Settings.SampleStepCm);
+	const float Len = OutSplineLengthCm;
+
+	// 1) Frame table of the track (baked by the track actor, else built here) and the
+	//    NoSpawnZone index along it (game thread).
+	//    Finer than the curvature window so the interpolated tangents stay close to the spline.
+	const double StartTime = FPlatformTime::Seconds();
+
+	const float TableStep = FMath::Clamp(0.5f * FMath::Min(Step, FMath::Max(10.f, Settings.CurvatureWindowCm)), 5.f, 50.f);
+
+	const TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> TrackTable = FTrackFrameTable::FindOrBuild(Spline, TableStep);
+	if (!TrackTable.IsValid() || !TrackTable->IsValid())
 	{
 		return false;
 	}
+	const FTrackFrameTable& Track = *TrackTable;
 
-	// Get World for NoSpawnZone checking
 	AActor* Owner = TrackProvider->GetOwner();
-	UWorld* World = Owner ? Owner->GetWorld() : nullptr;
-
-	const float Step = FMath::Max(10.f, Settings.SampleStepCm);
-	const float Len = OutSplineLengthCm;
+	UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(Owner ? Owner->GetWorld() : nullptr);
+	const int32 NumZones = ZoneIndex ? ZoneIndex->GetNumZones() : 0;
+	if (NumZones > 0)
+	{
+		ZoneIndex->RegisterSpline(Spline);
+	}
 
-	FVector Fwd = FVector::ForwardVector;
+	// 2) Per-sample tags / hints in parallel (independent samples)
+	struct FCurriculumSample
+	{
+		int32 TagMask = 0;
+		float SpeedHint = 0.f;
+		float SteerHint = 1.f;
+		bool bInNoSpawnZone = false;
+	};
 
-	FRacingCurriculumSegment Current;
-	bool bHasCurrent = false;
+	const int32 NumSamples = FMath::CeilToInt(Len / Step);
+	TArray<FCurriculumSample> Samples;
+	Samples.SetNum(NumSamples);
 
-	for (float S = 0.f; S < Len; S += Step)
+	ParallelFor(NumSamples, [&](int32 i)
 	{
+		const float S = i * Step;
+		FCurriculumSample& Out = Samples[i];
+
+		FNoSpawnZoneHit Hit;
+		Out.bInNoSpawnZone = NumZones > 0 && ZoneIndex->FindZoneAtDistance(Spline, S, Track.GetLocationAtDistance(S), 0.f, Hit);
+		if (Out.bInNoSpawnZone)
+		{
+			return;
+		}
+
 		float CurvAbs = 0.f;
 		float SlopeZ = 0.f;
 		bool bRampApproach = false;
 		bool bOnRamp = false;
 
-		const int32 TagMask = BuildTagMask(TrackProvider, S, Len, Settings, Fwd, CurvAbs, SlopeZ, bRampApproach, bOnRamp);
+		Out.TagMask = BuildTagMask(Track, S, Len, Settings, CurvAbs, SlopeZ, bRampApproach, bOnRamp);
+		ComputeSpeedAndSteerHints(Settings, Out.TagMask, CurvAbs, SlopeZ, Out.SpeedHint, Out.SteerHint);
+	});
 
-		// Check if this point is in a NoSpawnZone
-		bool bInNoSpawnZone = false;
-		if (World)
-		{
-			const FTrackFrame Frame = TrackProvider->ComputeFrameAtDistance(S, Fwd);
-			bInNoSpawnZone = IsInAnyNoSpawnZone(World, Frame.ClosestPoint);
-		}
+	// 3) Merge into segments (serial, in track order)
+	FRacingCurriculumSegment Current;
+	bool bHasCurrent = false;
+
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		const float S = i * Step;
+		const FCurriculumSample& Sample = Samples[i];
 
 		// Skip segments that are in NoSpawnZones
-		if (bInNoSpawnZone)
+		if (Sample.bInNoSpawnZone)
 		{
 			// End current segment if we have one
 			if (bHasCurrent)
@@ -264,9 +240,9 @@ void URacingCurriculumBuilder::ComputeSpeedAndSteerHints(
 			continue;
 		}
 
-		float SpeedHint = Settings.SuggestedSpeedStraight;
-		float SteerHint = 1.0f;
-		ComputeSpeedAndSteerHints(Settings, TagMask, CurvAbs, SlopeZ, SpeedHint, SteerHint);
+		const int32 TagMask = Sample.TagMask;
+		const float SpeedHint = Sample.SpeedHint;
+		const float SteerHint = Sample.SteerHint;
 
 		if (!bHasCurrent)
 		{
@@ -308,5 +284,8 @@ void URacingCurriculumBuilder::ComputeSpeedAndSteerHints(
 		OutSegments.Add(Current);
 	}
 
+	UE_LOG(LogTemp, Verbose, TEXT("[RacingCurriculumBuilder] %d samples -> %d segments in %.1f ms (%d no-spawn zones)"),
+		NumSamples, OutSegments.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0, NumZones);
+
 	return !OutSegments.IsEmpty();
 }
@@ -1,5 +1,8 @@
 ﻿#include "Components/RacingAgentComponent.h"
 #include "NN/SimpleNeuralNetwork.h"
+#include "Components/TrackFrameProviderComponent.h"
+#include "Track/RacingTrackInstance.h"
+#include "Track/RacingFailureHotspotSubsystem.h"
 
 #include "GameFramework/PlayerStart.h"
 #include "Kismet/GameplayStatics.h"
@@ -8,6 +11,7 @@
 #include "Components/PrimitiveComponent.h"
 #include "WheeledVehiclePawn.h"
 #include "ChaosWheeledVehicleMovementComponent.h"
+#include "ChaosVehicleWheel.h"
 
 // ============================================================================
 // Lifecycle
@@ -48,6 +52,24 @@ void URacingAgentComponent::BeginPlay()
 
 	RayState_Right45.AdaptationRate = RayAdaptationRate;
 	RayState_Right45.TargetDistNorm = RayTargetDistNorm;
+
+	if (bUseTrainingCollision)
+	{
+		ApplyTrainingCollision();
+	}
+
+	if (!TrackInstance && bAutoBindClosestTrack)
+	{
+		if (AActor* Vehicle = GetVehicleActor())
+		{
+			TrackInstance = ARacingTrackInstance::FindClosestTrackInstance(GetWorld(), Vehicle->GetActorLocation());
+		}
+	}
+
+	if (TrackInstance)
+	{
+		BindToTrack(TrackInstance);
+	}
 }
 
 void URacingAgentComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -72,15 +94,37 @@ void URacingAgentComponent::Initialize()
 
 void URacingAgentComponent::ResetEpisode()
 {
-	APlayerStart* PlayerStart = FindPlayerStart();
-	if (!PlayerStart)
+	if (bDeterministicSeeding)
+	{
+		CurrentEpisodeSeed = MakeEpisodeSeed(DeterministicBaseSeed, Generation, GenomeID, EpisodeIndex);
+		SpawnRng.Initialize(CurrentEpisodeSeed);
+		++EpisodeIndex;
+	}
+
+	// Checkpoint / failure replay: restore a settled state instead of teleporting
+	if (ResetSnapshot.bValid && RestoreVehicleSnapshot(ResetSnapshot, true))
 	{
-		UE_LOG(LogTemp, Error, TEXT("[%s] No Player Start found!"), *GetAgentLogId());
+		if (bEnableLogging)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[%s] Episode reset from snapshot"), *GetAgentLogId());
+		}
 		return;
 	}
 
-	FVector SpawnLoc = PlayerStart->GetActorLocation();
-	FRotator SpawnRot = PlayerStart->GetActorRotation();
+	FVector SpawnLoc;
+	FRotator SpawnRot;
+	if (!TryGetHotspotSpawn(SpawnLoc, SpawnRot))
+	{
+		APlayerStart* PlayerStart = FindPlayerStart();
+		if (!PlayerStart)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[%s] No Player Start found!"), *GetAgentLogId());
+			return;
+		}
+
+		SpawnLoc = PlayerStart->GetActorLocation();
+		SpawnRot = PlayerStart->GetActorRotation();
+	}
 
 	if (SpawnLateralOffsetMaxCm > 0.f)
 	{
@@ -98,7 +142,8 @@ void URacingAgentComponent::ResetEpisode()
 		return;
 	}
 
-	Vehicle->SetActorLocationAndRotation(SpawnLoc, SpawnRot);
+	Vehicle->SetActorLocationAndRotation(SpawnLoc, SpawnRot, false, nullptr,
+		bDeterministicSeeding ? ETeleportType::ResetPhysics : ETeleportType::None);
 
 	if (UPrimitiveComponent* RootComp = GetVehicleRootComponent())
 	{
@@ -106,6 +151,15 @@ void URacingAgentComponent::ResetEpisode()
 		RootComp->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
 	}
 
+	// Deterministic mode: no engine RPM / gear / wheel state carried over from the last episode
+	if (bDeterministicSeeding)
+	{
+		if (UChaosWheeledVehicleMovementComponent* MovementComp = GetVehicleMovement())
+		{
+			MovementComp->ResetVehicleState();
+		}
+	}
+
 	ResetEpisodeAccumulators();
 	ResetAdaptiveRays();
 
@@ -127,6 +181,8 @@ void URacingAgentComponent::ResetEpisodeAccumulators()
 
 	EpisodeStats = FEpisodeStats();
 	EpisodeStats.StartTime = FDateTime::Now();
+	EpisodeStats.GenomeID = GenomeID;
+	EpisodeStats.EpisodeSeed = CurrentEpisodeSeed;
 	EpisodeStats.DistanceTraveledCm = 0.f;
 	EpisodeStats.MaxSpeed = 0.f;
 	EpisodeStats.AvgSpeed = 0.f;
@@ -135,6 +191,13 @@ void URacingAgentComponent::ResetEpisodeAccumulators()
 
 	// Reset IMU
 	SmoothedGravityLocal = FVector(0, 0, -1);
+
+	// Reset snapshot history (failure snapshot survives for replay)
+	SnapshotHistory.Reset();
+	SnapshotHistoryHead = 0;
+	SnapshotTimeAccum = 0.f;
+
+	ResetProgressWindow();
 }
 
 void URacingAgentComponent::ResetAdaptiveRays()
@@ -203,6 +266,11 @@ void URacingAgentComponent::StepOnce(float DeltaTime)
 	float CurrentSpeed = Obs.SpeedNorm * SpeedNormCmPerSec;
 	EpisodeStats.MaxSpeed = FMath::Max(EpisodeStats.MaxSpeed, CurrentSpeed);
 
+	if (bRecordSnapshotHistory)
+	{
+		RecordSnapshotHistory(DeltaTime);
+	}
+
 	// 6. Check Terminal Conditions
 	FString TermReason;
 	if (CheckTerminalConditions(Obs, DeltaTime, TermReason) || Reward.bDone)
@@ -215,6 +283,16 @@ void URacingAgentComponent::StepOnce(float DeltaTime)
 		FinalizeEpisodeStats(TermReason);
 		bEpisodeDone = true;
 
+		if (bReportFailureHotspots)
+		{
+			ReportFailureHotspot(TermReason);
+		}
+
+		if (bRecordSnapshotHistory && TermReason != TEXT("MaxSteps") && TermReason != TEXT("FitnessCeiling"))
+		{
+			StoreFailureSnapshot();
+		}
+
 		OnEpisodeDone.Broadcast(EpisodeStats);
 
 		if (bEnableLogging)
@@ -248,6 +326,16 @@ void URacingAgentComponent::StepOnce(float DeltaTime)
 	}
 }
 
+void URacingAgentComponent::ParkAgent()
+{
+	bEpisodeDone = true;
+
+	FVehicleAction Hold;
+	Hold.Brake = 1.f;
+	ApplyAction(Hold);
+	LastAction = Hold;
+}
+
 // ============================================================================
 // Observation - Adaptive Rays + IMU
 // ============================================================================
@@ -316,10 +404,7 @@ FRacingObservation URacingAgentComponent::BuildObservation()
 	FVector GroundStart = Vehicle->GetActorLocation();
 	FVector GroundEnd = GroundStart - FVector(0, 0, GroundRayMaxDistanceCm);
 	FHitResult GroundHit;
-	bool bHasGround = GetWorld()->LineTraceSingleByChannel(
-		GroundHit, GroundStart, GroundEnd, ECC_Visibility,
-		FCollisionQueryParams(TEXT("GroundCheck"), false, Vehicle)
-	);
+	bool bHasGround = SensorLineTrace(GroundHit, GroundStart, GroundEnd, ECC_Visibility, TEXT("GroundCheck"));
 
 	if (bHasGround)
 	{
@@ -385,13 +470,7 @@ float URacingAgentComponent::TraceAdaptiveRay(
 	FVector End = Start + Direction * RayMaxDistanceCm;
 
 	FHitResult Hit;
-	bool bHit = GetWorld()->LineTraceSingleByChannel(
-		Hit,
-		Start,
-		End,
-		RayTraceChannel,
-		FCollisionQueryParams(TEXT("AdaptiveRay"), false, GetVehicleActor())
-	);
+	bool bHit = SensorLineTrace(Hit, Start, End, RayTraceChannel, TEXT("AdaptiveRay"));
 
 	float HitDistNorm = 1.f;
 	if (bHit)
@@ -423,13 +502,7 @@ float URacingAgentComponent::TraceFixedRay(
 	FVector End = Start + Direction * MaxDistance;
 
 	FHitResult Hit;
-	bool bHit = GetWorld()->LineTraceSingleByChannel(
-		Hit,
-		Start,
-		End,
-		RayTraceChannel,
-		FCollisionQueryParams(TEXT("FixedRay"), false, GetVehicleActor())
-	);
+	bool bHit = SensorLineTrace(Hit, Start, End, RayTraceChannel, TEXT("FixedRay"));
 
 	if (bDrawRayDebug)
 	{
@@ -447,6 +520,29 @@ float URacingAgentComponent::TraceFixedRay(
 	return 1.0f;
 }
 
+bool URacingAgentComponent::SensorLineTrace(
+	FHitResult& OutHit,
+	const FVector& Start,
+	const FVector& End,
+	ECollisionChannel Channel,
+	const FName& TraceTag) const
+{
+	const FCollisionQueryParams Params(TraceTag, false, GetVehicleActor());
+
+	if (bUseTrainingCollision)
+	{
+		// Only track geometry: other cars (Vehicle / Pawn / TrainingAgent) are never hit
+		FCollisionObjectQueryParams ObjectParams;
+		for (const TEnumAsByte<ECollisionChannel>& TrackChannel : TrackObjectChannels)
+		{
+			ObjectParams.AddObjectTypesToQuery(TrackChannel);
+		}
+		return GetWorld()->LineTraceSingleByObjectType(OutHit, Start, End, ObjectParams, Params);
+	}
+
+	return GetWorld()->LineTraceSingleByChannel(OutHit, Start, End, Channel, Params);
+}
+
 void URacingAgentComponent::BuildLidarObservation(const FVector& Origin, const FVector& Forward, TArray<float>& OutRays)
 {
 	const int32 N = FMath::Max(4, LidarNumRays);
@@ -521,138 +617,319 @@ FVector URacingAgentComponent::ComputeGravityDirection()
 
 FRewardBreakdown URacingAgentComponent::ComputeReward(const FRacingObservation& Obs, float DeltaTime)
 {
-	FRewardBreakdown R;
+	const float DistanceFromStartCm = (GetVehicleActor()->GetActorLocation() - EpisodeStartLocation).Size();
 
-	// ===== Distance Reward =====
+	return RewardCfg.ComputeReward(Obs, DistanceFromStartCm, EpisodeTimeAccum, EpisodeStats.DistanceTraveledCm, LastAction.Steer);
+}
 
-	FVector CurrentLoc = GetVehicleActor()->GetActorLocation();
-	float DistanceMeters = (CurrentLoc - EpisodeStartLocation).Size() / 100.f;
+float URacingAgentComponent::GetEpisodeFitness() const
+{
+	return EpisodeStats.NEATFitness;
+}
 
-	R.Distance = DistanceMeters * RewardCfg.W_Distance;
+// ============================================================================
+// Terminal Conditions
+// ============================================================================
 
-	// ===== Survival Bonus =====
+bool URacingAgentComponent::CheckTerminalConditions(const FRacingObservation& Obs, float DeltaTime, FString& OutReason)
+{
+	if (RewardCfg.CheckTerminal(Obs, DeltaTime, EpisodeStepCount, AirborneTimeAccum, StuckTimeAccum, OutReason))
+	{
+		return true;
+	}
 
-	R.Survival = EpisodeTimeAccum * RewardCfg.W_Survival;
+	// Progress stall (track distance over a sliding window)
+	if (RewardCfg.bEnableProgressStall)
+	{
+		bool bWindowFull = false;
+		const float WindowProgressCm = UpdateProgressWindow(DeltaTime, bWindowFull);
 
-	// ===== Speed Bonus (Phase 2) =====
+		if (RewardCfg.CheckProgressStall(WindowProgressCm, bWindowFull, EpisodeTimeAccum, OutReason))
+		{
+			return true;
+		}
+	}
 
-	if (EpisodeStats.DistanceTraveledCm > RewardCfg.Phase2ActivationDistanceCm)
+	// Fitness ceiling: even at top speed this genome can no longer reach the cutoff
+	if (FitnessCutoff > 0.f)
 	{
-		float SpeedDiff = FMath::Abs(Obs.SpeedNorm - RewardCfg.SpeedTargetNorm);
-		R.Speed = (1.f - SpeedDiff) * RewardCfg.W_Speed;
+		float RemainingSeconds = (RewardCfg.MaxEpisodeSteps - EpisodeStepCount) * DeltaTime;
+		if (EpisodeTimeLimitSeconds > 0.f)
+		{
+			RemainingSeconds = FMath::Min(RemainingSeconds, EpisodeTimeLimitSeconds - EpisodeTimeAccum);
+		}
+
+		if (EpisodeStats.CalculateNEATFitnessCeiling(RemainingSeconds, FitnessCeilingSpeedCmPerSec) < FitnessCutoff)
+		{
+			OutReason = TEXT("FitnessCeiling");
+			return true;
+		}
 	}
 
-	// ===== Smoothness =====
+	return false;
+}
 
-	float SteerDiff = FMath::Abs(LastAction.Steer - Obs.SpeedNorm); // Simplified
-	R.Smoothness = SteerDiff * RewardCfg.W_ActionSmooth;
+UTrackFrameProviderComponent* URacingAgentComponent::GetTrackProvider() const
+{
+	if (!CachedTrackProvider.IsValid())
+	{
+		if (AActor* Vehicle = GetVehicleActor())
+		{
+			CachedTrackProvider = Vehicle->FindComponentByClass<UTrackFrameProviderComponent>();
+		}
+	}
 
-	// ===== Collision Penalty (Adaptive Rays) =====
+	return CachedTrackProvider.Get();
+}
 
-	float MinRayDist = FMath::Min(
-		FMath::Min(
-			FMath::Min(Obs.RayForward, Obs.RayLeft),
-			FMath::Min(Obs.RayRight, Obs.RayLeft45)
-		),
-		Obs.RayRight45
-	);
+void URacingAgentComponent::ResetProgressWindow()
+{
+	TrackProgressCm = 0.f;
+	ProgressWindowHead = 0;
+	ProgressWindowCount = 0;
+	ProgressSampleAccum = 0.f;
 
-	if (MinRayDist < RewardCfg.CollisionWarningThreshold)
+	if (!RewardCfg.bEnableProgressStall)
 	{
-		R.Collision = RewardCfg.CollisionWarningPenalty;
+		return;
 	}
 
-	if (MinRayDist < RewardCfg.CollisionTerminalThreshold)
+	// Restart progress tracking at the spawn point (otherwise the teleport counts as progress)
+	UTrackFrameProviderComponent* Provider = GetTrackProvider();
+	AActor* Vehicle = GetVehicleActor();
+	if (Provider && Vehicle)
 	{
-		R.bDone = true;
-		R.DoneReason = TEXT("Collision");
-		R.Collision = RewardCfg.CollisionTerminalPenalty;
+		const FTrackFrame Frame = Provider->ComputeFrameAtLocation(Vehicle->GetActorLocation(), Vehicle->GetActorForwardVector(), false);
+		Provider->ResetProgressTracking(Frame.DistanceAlongSpline);
 	}
+}
 
-	// ===== Gap Penalty (Ground Ray) =====
+float URacingAgentComponent::UpdateProgressWindow(float DeltaTime, bool& bOutWindowFull)
+{
+	bOutWindowFull = false;
 
-	if (Obs.RayGroundDist < RewardCfg.GapWarningThreshold)
+	UTrackFrameProviderComponent* Provider = GetTrackProvider();
+	AActor* Vehicle = GetVehicleActor();
+	if (!Provider || !Vehicle)
 	{
-		R.GapPenalty = RewardCfg.GapWarningPenalty;
+		return 0.f;
 	}
 
-	if (Obs.RayGroundDist < RewardCfg.GapTerminalThreshold)
+	const FTrackFrame Frame = Provider->ComputeFrameAtLocation(Vehicle->GetActorLocation(), Vehicle->GetActorForwardVector(), true);
+	TrackProgressCm += Frame.ProgressDelta;
+
+	// Ring of cumulative progress, one sample per window slice; oldest sample ~= window start
+	constexpr int32 NumWindowSlices = 10;
+	if (ProgressWindowSamples.Num() != NumWindowSlices + 1)
 	{
-		R.bDone = true;
-		R.DoneReason = TEXT("Fell off track");
-		R.GapPenalty = RewardCfg.GapTerminalPenalty;
+		ProgressWindowSamples.SetNumZeroed(NumWindowSlices + 1);
+		ProgressWindowHead = 0;
+		ProgressWindowCount = 0;
 	}
 
-	// ===== Total =====
+	const float SliceSeconds = RewardCfg.ProgressWindowSeconds / NumWindowSlices;
+	ProgressSampleAccum += DeltaTime;
+
+	if (ProgressWindowCount == 0 || ProgressSampleAccum >= SliceSeconds)
+	{
+		ProgressSampleAccum = ProgressWindowCount == 0 ? 0.f : FMath::Fmod(ProgressSampleAccum, SliceSeconds);
+
+		ProgressWindowSamples[ProgressWindowHead] = TrackProgressCm;
+		ProgressWindowHead = (ProgressWindowHead + 1) % ProgressWindowSamples.Num();
+		ProgressWindowCount = FMath::Min(ProgressWindowCount + 1, ProgressWindowSamples.Num());
+	}
 
-	R.Total = R.Distance + R.Survival + R.Speed + R.Smoothness + R.Collision + R.GapPenalty;
-	R.Total = FMath::Clamp(R.Total, -RewardCfg.MaxAbsTerm, RewardCfg.MaxAbsTerm);
+	bOutWindowFull = ProgressWindowCount == ProgressWindowSamples.Num();
 
-	return R;
+	const int32 OldestIndex = bOutWindowFull ? ProgressWindowHead : 0;
+	return TrackProgressCm - ProgressWindowSamples[OldestIndex];
 }
 
-float URacingAgentComponent::GetEpisodeFitness() const
+void URacingAgentComponent::FinalizeEpisodeStats(const FString& TerminationReason)
 {
-	return EpisodeStats.NEATFitness;
+	EpisodeStats.EndTime = FDateTime::Now();
+	EpisodeStats.TerminationReason = TerminationReason;
+
+	if (EpisodeStats.StepCount > 0)
+	{
+		EpisodeStats.AvgSpeed = EpisodeStats.DistanceTraveledCm / EpisodeStats.DurationSeconds;
+	}
+
+	EpisodeStats.CalculateNEATFitness();
 }
 
 // ============================================================================
-// Terminal Conditions
+// Physics Snapshot
 // ============================================================================
 
-bool URacingAgentComponent::CheckTerminalConditions(const FRacingObservation& Obs, float DeltaTime, FString& OutReason)
+FVehiclePhysicsSnapshot URacingAgentComponent::CaptureVehicleSnapshot() const
 {
-	// Max steps
-	if (EpisodeStepCount >= RewardCfg.MaxEpisodeSteps)
+	FVehiclePhysicsSnapshot Snapshot;
+
+	AActor* Vehicle = GetVehicleActor();
+	UPrimitiveComponent* RootComp = GetVehicleRootComponent();
+	if (!Vehicle || !RootComp)
 	{
-		OutReason = TEXT("MaxSteps");
-		return true;
+		return Snapshot;
 	}
 
-	// Airborne too long
-	if (Obs.RayGroundDist < 0.1f)
+	Snapshot.Transform = Vehicle->GetActorTransform();
+	Snapshot.LinearVelocity = RootComp->GetPhysicsLinearVelocity();
+	Snapshot.AngularVelocityDeg = RootComp->GetPhysicsAngularVelocityInDegrees();
+	Snapshot.Action = LastAction;
+	Snapshot.EpisodeTimeSeconds = EpisodeTimeAccum;
+
+	if (UChaosWheeledVehicleMovementComponent* MovementComp = GetVehicleMovement())
 	{
-		AirborneTimeAccum += DeltaTime;
-		if (AirborneTimeAccum >= RewardCfg.AirborneMaxSeconds)
+		// Drivetrain / wheel state as the Chaos vehicle snapshot sees it (same units SetSnapshot expects)
+		const FWheeledSnaphotData ChaosState = MovementComp->GetSnapshot();
+
+		Snapshot.EngineRPM = ChaosState.EngineRPM;
+		Snapshot.CurrentGear = MovementComp->GetCurrentGear();
+		Snapshot.TargetGear = MovementComp->GetTargetGear();
+
+		Snapshot.Wheels.Reserve(ChaosState.WheelSnapshots.Num());
+		for (const FWheelSnapshot& ChaosWheel : ChaosState.WheelSnapshots)
 		{
-			OutReason = TEXT("AirborneLong");
-			return true;
+			FVehicleWheelSnapshot& WheelSnap = Snapshot.Wheels.AddDefaulted_GetRef();
+			WheelSnap.AngularVelocity = ChaosWheel.WheelAngularVelocity;
+			WheelSnap.RotationAngle = ChaosWheel.WheelRotationAngle;
+			WheelSnap.SuspensionOffset = ChaosWheel.SuspensionOffset;
+			WheelSnap.SteerAngle = ChaosWheel.SteeringAngle;
 		}
 	}
-	else
+
+	Snapshot.bValid = true;
+	return Snapshot;
+}
+
+bool URacingAgentComponent::RestoreVehicleSnapshot(const FVehiclePhysicsSnapshot& Snapshot, bool bStartNewEpisode)
+{
+	AActor* Vehicle = GetVehicleActor();
+	if (!Snapshot.bValid || !Vehicle)
+	{
+		return false;
+	}
+
+	UChaosWheeledVehicleMovementComponent* MovementComp = GetVehicleMovement();
+
+	// Drop stale sim state first (ResetVehicleState recreates the physics state and stops movement)
+	if (MovementComp)
 	{
-		AirborneTimeAccum = 0.f;
+		MovementComp->ResetVehicleState();
 	}
 
-	// Stuck
-	if (Obs.SpeedNorm < RewardCfg.StuckSpeedNorm)
+	Vehicle->SetActorTransform(Snapshot.Transform, false, nullptr, ETeleportType::ResetPhysics);
+
+	// Without a Chaos vehicle the body velocities are restored directly
+	if (!MovementComp)
 	{
-		StuckTimeAccum += DeltaTime;
-		if (StuckTimeAccum >= RewardCfg.StuckTimeSeconds)
+		if (UPrimitiveComponent* RootComp = GetVehicleRootComponent())
 		{
-			OutReason = TEXT("Stuck");
-			return true;
+			RootComp->SetPhysicsLinearVelocity(Snapshot.LinearVelocity);
+			RootComp->SetPhysicsAngularVelocityInDegrees(Snapshot.AngularVelocityDeg);
 		}
 	}
-	else
+
+	// Body velocities, engine RPM, wheel spin and suspension go back into the vehicle simulation
+	// in one snapshot, so the car continues at speed instead of spinning up again
+	if (MovementComp)
 	{
-		StuckTimeAccum = 0.f;
+		FWheeledSnaphotData ChaosState = MovementComp->GetSnapshot();
+		ChaosState.Transform = Snapshot.Transform;
+		ChaosState.LinearVelocity = Snapshot.LinearVelocity;
+		ChaosState.AngularVelocity = FMath::DegreesToRadians(Snapshot.AngularVelocityDeg); // Chaos: rad/s
+		ChaosState.EngineRPM = Snapshot.EngineRPM;
+		ChaosState.SelectedGear = Snapshot.CurrentGear;
+
+		const int32 NumWheels = FMath::Min(ChaosState.WheelSnapshots.Num(), Snapshot.Wheels.Num());
+		for (int32 i = 0; i < NumWheels; ++i)
+		{
+			FWheelSnapshot& ChaosWheel = ChaosState.WheelSnapshots[i];
+			const FVehicleWheelSnapshot& WheelSnap = Snapshot.Wheels[i];
+
+			ChaosWheel.WheelAngularVelocity = WheelSnap.AngularVelocity;
+			ChaosWheel.WheelRotationAngle = WheelSnap.RotationAngle;
+			ChaosWheel.SuspensionOffset = WheelSnap.SuspensionOffset;
+			ChaosWheel.SteeringAngle = WheelSnap.SteerAngle;
+		}
+
+		MovementComp->SetSnapshot(ChaosState);
+
+		MovementComp->SetTargetGear(Snapshot.TargetGear, true);
+		MovementComp->SetSteeringInput(Snapshot.Action.Steer);
+		MovementComp->SetThrottleInput(Snapshot.Action.Throttle);
+		MovementComp->SetBrakeInput(Snapshot.Action.Brake);
 	}
 
-	return false;
+	if (bStartNewEpisode)
+	{
+		ResetEpisodeAccumulators();
+		ResetAdaptiveRays();
+	}
+
+	LastAction = Snapshot.Action;
+	return true;
 }
 
-void URacingAgentComponent::FinalizeEpisodeStats(const FString& TerminationReason)
+bool URacingAgentComponent::GetLastFailureSnapshot(FVehiclePhysicsSnapshot& OutSnapshot) const
 {
-	EpisodeStats.EndTime = FDateTime::Now();
-	EpisodeStats.TerminationReason = TerminationReason;
+	OutSnapshot = LastFailureSnapshot;
+	return LastFailureSnapshot.bValid;
+}
 
-	if (EpisodeStats.StepCount > 0)
+void URacingAgentComponent::RecordSnapshotHistory(float DeltaTime)
+{
+	SnapshotTimeAccum += DeltaTime;
+	if (SnapshotTimeAccum < SnapshotIntervalSeconds && SnapshotHistory.Num() > 0)
 	{
-		EpisodeStats.AvgSpeed = EpisodeStats.DistanceTraveledCm / EpisodeStats.DurationSeconds;
+		return;
 	}
+	SnapshotTimeAccum = 0.f;
 
-	EpisodeStats.CalculateNEATFitness();
+	const int32 Capacity = FMath::Max(1, SnapshotHistoryLength);
+	if (SnapshotHistory.Num() < Capacity)
+	{
+		SnapshotHistory.Add(CaptureVehicleSnapshot());
+		SnapshotHistoryHead = SnapshotHistory.Num() % Capacity;
+	}
+	else
+	{
+		SnapshotHistory[SnapshotHistoryHead] = CaptureVehicleSnapshot();
+		SnapshotHistoryHead = (SnapshotHistoryHead + 1) % Capacity;
+	}
+}
+
+void URacingAgentComponent::StoreFailureSnapshot()
+{
+	// Latest snapshot at least FailureReplayLeadSeconds before the failure, else the oldest one
+	const float TargetTime = EpisodeTimeAccum - FailureReplayLeadSeconds;
+
+	const FVehiclePhysicsSnapshot* Best = nullptr;
+	const FVehiclePhysicsSnapshot* Oldest = nullptr;
+
+	for (const FVehiclePhysicsSnapshot& Snap : SnapshotHistory)
+	{
+		if (!Snap.bValid)
+		{
+			continue;
+		}
+
+		if (!Oldest || Snap.EpisodeTimeSeconds < Oldest->EpisodeTimeSeconds)
+		{
+			Oldest = &Snap;
+		}
+
+		if (Snap.EpisodeTimeSeconds <= TargetTime && (!Best || Snap.EpisodeTimeSeconds > Best->EpisodeTimeSeconds))
+		{
+			Best = &Snap;
+		}
+	}
+
+	if (const FVehiclePhysicsSnapshot* Chosen = Best ? Best : Oldest)
+	{
+		LastFailureSnapshot = *Chosen;
+	}
 }
 
 // ============================================================================
@@ -667,7 +944,7 @@ void URacingAgentComponent::ApplyAction(const FVehicleAction& Action)
 		return;
 	}
 
-	UChaosWheeledVehicleMovementComponent* MovementComp = Vehicle->FindComponentByClass<UChaosWheeledVehicleMovementComponent>();
+	UChaosWheeledVehicleMovementComponent* MovementComp = GetVehicleMovement();
 	if (MovementComp)
 	{
 		MovementComp->SetSteeringInput(Action.Steer);
@@ -691,19 +968,113 @@ UPrimitiveComponent* URacingAgentComponent::GetVehicleRootComponent() const
 	return Vehicle ? Cast<UPrimitiveComponent>(Vehicle->GetRootComponent()) : nullptr;
 }
 
+int32 URacingAgentComponent::MakeEpisodeSeed(int32 BaseSeed, int32 InGeneration, int32 InGenomeID, int32 InEpisodeIndex)
+{
+	uint32 Hash = GetTypeHash(BaseSeed);
+	Hash = HashCombine(Hash, GetTypeHash(InGeneration));
+	Hash = HashCombine(Hash, GetTypeHash(InGenomeID));
+	Hash = HashCombine(Hash, GetTypeHash(InEpisodeIndex));
+	return (int32)(Hash & 0x7fffffff);
+}
+
+UChaosWheeledVehicleMovementComponent* URacingAgentComponent::GetVehicleMovement() const
+{
+	AActor* Vehicle = GetVehicleActor();
+	return Vehicle ? Vehicle->FindComponentByClass<UChaosWheeledVehicleMovementComponent>() : nullptr;
+}
+
 APlayerStart* URacingAgentComponent::FindPlayerStart() const
 {
+	if (APlayerStart* Cached = CachedPlayerStart.Get())
+	{
+		return Cached;
+	}
+
+	if (TrackInstance && TrackInstance->GetPlayerStart())
+	{
+		CachedPlayerStart = TrackInstance->GetPlayerStart();
+		return CachedPlayerStart.Get();
+	}
+
 	TArray<AActor*> PlayerStarts;
 	UGameplayStatics::GetAllActorsOfClass(GetWorld(), APlayerStart::StaticClass(), PlayerStarts);
 
 	if (PlayerStarts.Num() > 0)
 	{
-		return Cast<APlayerStart>(PlayerStarts[0]);
+		CachedPlayerStart = Cast<APlayerStart>(PlayerStarts[0]);
+		return CachedPlayerStart.Get();
 	}
 
 	return nullptr;
 }
 
+bool URacingAgentComponent::TryGetHotspotSpawn(FVector& OutLocation, FRotator& OutRotation)
+{
+	if (!bUseFailureHotspotSpawns || SpawnRng.GetFraction() >= HotspotSpawnChance)
+	{
+		return false;
+	}
+
+	UTrackFrameProviderComponent* Provider = GetTrackProvider();
+	USplineComponent* Spline = Provider ? Provider->GetResolvedSpline() : nullptr;
+	URacingFailureHotspotSubsystem* Hotspots = GetWorld() ? GetWorld()->GetSubsystem<URacingFailureHotspotSubsystem>() : nullptr;
+	if (!Spline || !Hotspots)
+	{
+		return false;
+	}
+
+	// A few draws in case the lead-in lands in a no-spawn zone
+	constexpr int32 MaxAttempts = 4;
+	for (int32 Attempt = 0; Attempt < MaxAttempts; ++Attempt)
+	{
+		float HotspotS = 0.f;
+		if (!Hotspots->SampleSpawnDistance(Spline, SpawnRng, HotspotS))
+		{
+			return false;
+		}
+
+		// ComputeFrameAtDistance wraps S on the spline
+		const FTrackFrame Frame = Provider->ComputeFrameAtDistance(HotspotS - HotspotLeadInCm, FVector::ForwardVector);
+		if (TrackInstance && TrackInstance->IsInNoSpawnZone(Frame.ClosestPoint))
+		{
+			continue;
+		}
+
+		OutLocation = Frame.ClosestPoint;
+		OutRotation = FRotationMatrix::MakeFromXZ(Frame.Tangent, Frame.Normal).Rotator();
+
+		if (bEnableLogging)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[%s] Hotspot spawn at S=%.0fm (hotspot %.0fm)"),
+				*GetAgentLogId(), Frame.DistanceAlongSpline / 100.f, HotspotS / 100.f);
+		}
+		return true;
+	}
+
+	return false;
+}
+
+void URacingAgentComponent::ReportFailureHotspot(const FString& TerminationReason)
+{
+	const ERacingFailureKind Kind = URacingFailureHotspotSubsystem::ClassifyTerminationReason(TerminationReason);
+	if (Kind == ERacingFailureKind::None)
+	{
+		return;
+	}
+
+	UTrackFrameProviderComponent* Provider = GetTrackProvider();
+	USplineComponent* Spline = Provider ? Provider->GetResolvedSpline() : nullptr;
+	URacingFailureHotspotSubsystem* Hotspots = GetWorld() ? GetWorld()->GetSubsystem<URacingFailureHotspotSubsystem>() : nullptr;
+	AActor* Vehicle = GetVehicleActor();
+	if (!Spline || !Hotspots || !Vehicle)
+	{
+		return;
+	}
+
+	const FTrackFrame Frame = Provider->ComputeFrameAtLocation(Vehicle->GetActorLocation(), Vehicle->GetActorForwardVector(), false);
+	Hotspots->ReportFailure(Spline, Frame.DistanceAlongSpline, Kind);
+}
+
 FString URacingAgentComponent::GetAgentLogId() const
 {
 	AActor* Owner = GetOwner();
@@ -714,6 +1085,66 @@ FString URacingAgentComponent::GetAgentLogId() const
 	return TEXT("Agent[Unknown]");
 }
 
+void URacingAgentComponent::ApplyTrainingCollision()
+{
+	AActor* Vehicle = GetVehicleActor();
+	if (!Vehicle)
+	{
+		return;
+	}
+
+	TInlineComponentArray<UPrimitiveComponent*> Primitives(Vehicle);
+	for (UPrimitiveComponent* Prim : Primitives)
+	{
+		if (!Prim || Prim->GetCollisionEnabled() == ECollisionEnabled::NoCollision)
+		{
+			continue;
+		}
+
+		// Agents ignore each other (no broadphase pairs) and are invisible to sensor rays
+		Prim->SetCollisionObjectType(TrainingAgentChannel);
+		Prim->SetCollisionResponseToChannel(TrainingAgentChannel, ECR_Ignore);
+		Prim->SetCollisionResponseToChannel(ECC_Vehicle, ECR_Ignore);
+		Prim->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
+		Prim->SetCollisionResponseToChannel(RayTraceChannel, ECR_Ignore);
+		Prim->SetCollisionResponseToChannel(ECC_Visibility, ECR_Ignore);
+		Prim->SetCollisionResponseToChannel(ECC_Camera, ECR_Ignore);
+	}
+
+	if (bEnableLogging)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[%s] Training collision applied (channel %d, %d primitives)"),
+			*GetAgentLogId(), (int32)TrainingAgentChannel.GetValue(), Primitives.Num());
+	}
+}
+
+void URacingAgentComponent::BindToTrack(ARacingTrackInstance* InTrack)
+{
+	TrackInstance = InTrack;
+	CachedPlayerStart.Reset();
+
+	if (!InTrack)
+	{
+		return;
+	}
+
+	InTrack->ResolveReferences();
+
+	// Progress / frame queries must use this track's spline, not the nearest provider at BeginPlay
+	if (UTrackFrameProviderComponent* Provider = GetTrackProvider())
+	{
+		if (Provider->GetRoadSplineProvider() != InTrack->GetTrackActor())
+		{
+			Provider->SetRoadSplineProvider(InTrack->GetTrackActor());
+		}
+	}
+
+	if (bEnableLogging)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[%s] Bound to track %s"), *GetAgentLogId(), *InTrack->TrackId.ToString());
+	}
+}
+
 void URacingAgentComponent::SetNeuralNetwork(USimpleNeuralNetwork* Network)
 {
 	PolicyNetwork = Network;
@@ -4,6 +4,8 @@
 #include "Logging/GlobalLog.h"          // deine eigenen Zeit/Klassen/Line Makros
 #include "Logging/LogVerbosity.h"
 #include "Logging/LogMacros.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogRacingCurriculum, Log, All);
 
@@ -25,6 +27,8 @@ void URacingCurriculumDataAsset::PostLoad()
 {
 	Super::PostLoad();
 
+	RebuildSamplingTables();
+
 	if (bDumpOnLoad)
 	{
 		DumpTagStats();
@@ -36,10 +40,184 @@ void URacingCurriculumDataAsset::PostLoad()
 void URacingCurriculumDataAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
 	Super::PostEditChangeProperty(PropertyChangedEvent);
-	CUR_LOGFMT(Verbose, "Property changed in {Asset}, cache may need rebuild.", ("Asset", GetNameSafe(this)));
+	RebuildSamplingTables();
+	CUR_LOGFMT(Verbose, "Property changed in {Asset}, sampling tables rebuilt.", ("Asset", GetNameSafe(this)));
 }
 #endif
 
+// ------------------------------------------------------------
+// Lookup tables
+// ------------------------------------------------------------
+
+void URacingCurriculumDataAsset::SetSegments(float InSplineLengthCm, TArray<FRacingCurriculumSegment> InSegments)
+{
+	SplineLengthCm = InSplineLengthCm;
+	Segments = MoveTemp(InSegments);
+	MarkSegmentsDirty();
+}
+
+void URacingCurriculumDataAsset::MarkSegmentsDirty()
+{
+	++SegmentsRevision;
+}
+
+bool URacingCurriculumDataAsset::AreSamplingTablesValid() const
+{
+	// O(1): in-place segment edits must go through MarkSegmentsDirty; the scalar checks catch a replaced array
+	return BuiltSegmentsRevision == SegmentsRevision
+		&& BuiltNumSegments == Segments.Num()
+		&& BuiltSplineLengthCm == SplineLengthCm
+		&& bBuiltLoopedTrack == BuildSettings.bLoopedTrack;
+}
+
+void URacingCurriculumDataAsset::EnsureSamplingTables() const
+{
+	if (!AreSamplingTablesValid())
+	{
+		BuildSamplingTablesInternal();
+	}
+}
+
+void URacingCurriculumDataAsset::RebuildSamplingTables()
+{
+	BuildSamplingTablesInternal();
+}
+
+void URacingCurriculumDataAsset::BuildSamplingTablesInternal() const
+{
+	const int32 NumSegs = Segments.Num();
+
+	// Sorted start index for binary search
+	SortedSegmentIndex.Reset(NumSegs);
+	for (int32 i = 0; i < NumSegs; ++i)
+	{
+		SortedSegmentIndex.Add(i);
+	}
+	// Stable: equal starts keep array order (first match wins like the old linear scan)
+	Algo::StableSortBy(SortedSegmentIndex, [this](int32 Idx) { return Segments[Idx].StartDistanceCm; });
+
+	SortedStartCm.Reset(NumSegs);
+	for (int32 Idx : SortedSegmentIndex)
+	{
+		SortedStartCm.Add(Segments[Idx].StartDistanceCm);
+	}
+
+	// Length-weighted alias table per (mask, any/all)
+	SampleSegmentIndex.Reset();
+	SampleAliasProb.Reset();
+	SampleAliasIndex.Reset();
+
+	TArray<double> Scaled;
+	TArray<int32> Small;
+	TArray<int32> Large;
+
+	for (int32 Table = 0; Table < 2 * NumTagMasks; ++Table)
+	{
+		const int32 Mask = Table % NumTagMasks;
+		const bool bRequireAll = Table >= NumTagMasks;
+
+		FTagSampleTable& Out = TagTables[Table];
+		Out.First = SampleSegmentIndex.Num();
+		Out.Num = 0;
+
+		if (Mask == 0)
+		{
+			continue;
+		}
+
+		double TotalLength = 0.0;
+		for (int32 i = 0; i < NumSegs; ++i)
+		{
+			const FRacingCurriculumSegment& Seg = Segments[i];
+			const bool bMatch = bRequireAll
+				? ((Seg.TagMask & Mask) == Mask)
+				: ((Seg.TagMask & Mask) != 0);
+
+			const float Len = Seg.EndDistanceCm - Seg.StartDistanceCm;
+			if (bMatch && Len > 0.f)
+			{
+				SampleSegmentIndex.Add(i);
+				TotalLength += Len;
+			}
+		}
+
+		Out.Num = SampleSegmentIndex.Num() - Out.First;
+		if (Out.Num == 0)
+		{
+			continue;
+		}
+
+		SampleAliasProb.AddUninitialized(Out.Num);
+		SampleAliasIndex.AddUninitialized(Out.Num);
+
+		Scaled.Reset(Out.Num);
+		Small.Reset(Out.Num);
+		Large.Reset(Out.Num);
+
+		for (int32 k = 0; k < Out.Num; ++k)
+		{
+			const FRacingCurriculumSegment& Seg = Segments[SampleSegmentIndex[Out.First + k]];
+			Scaled.Add((Seg.EndDistanceCm - Seg.StartDistanceCm) * Out.Num / TotalLength);
+			(Scaled[k] < 1.0 ? Small : Large).Add(k);
+		}
+
+		// Vose alias method
+		while (Small.Num() > 0 && Large.Num() > 0)
+		{
+			const int32 S = Small.Pop(EAllowShrinking::No);
+			const int32 L = Large.Pop(EAllowShrinking::No);
+
+			SampleAliasProb[Out.First + S] = (float)Scaled[S];
+			SampleAliasIndex[Out.First + S] = L;
+
+			Scaled[L] = (Scaled[L] + Scaled[S]) - 1.0;
+			(Scaled[L] < 1.0 ? Small : Large).Add(L);
+		}
+
+		for (int32 k : Large)
+		{
+			SampleAliasProb[Out.First + k] = 1.f;
+			SampleAliasIndex[Out.First + k] = k;
+		}
+		for (int32 k : Small)
+		{
+			SampleAliasProb[Out.First + k] = 1.f;
+			SampleAliasIndex[Out.First + k] = k;
+		}
+	}
+
+	BuiltSegmentsRevision = SegmentsRevision;
+	BuiltNumSegments = NumSegs;
+	BuiltSplineLengthCm = SplineLengthCm;
+	bBuiltLoopedTrack = BuildSettings.bLoopedTrack;
+
+	CUR_LOGFMT(Verbose, "Sampling tables built for {Asset}: Segs={Segs} Entries={Entries}",
+		("Asset", GetNameSafe(this)), ("Segs", NumSegs), ("Entries", SampleSegmentIndex.Num()));
+}
+
+int32 URacingCurriculumDataAsset::FindSegmentIndexAtDistance(float S) const
+{
+	// Last segment starting at or before S
+	const int32 Upper = Algo::UpperBound(SortedStartCm, S);
+
+	// Earlier segments may still reach S (shared boundary / overlap): prefer the earliest like the linear scan did
+	for (int32 k = Upper - 1; k >= 0; --k)
+	{
+		const int32 SegIdx = SortedSegmentIndex[k];
+		if (S <= Segments[SegIdx].EndDistanceCm)
+		{
+			if (k == 0 || S > Segments[SortedSegmentIndex[k - 1]].EndDistanceCm)
+			{
+				return SegIdx;
+			}
+			continue;
+		}
+		break;
+	}
+
+	return INDEX_NONE;
+}
+
 // ------------------------------------------------------------
 // Core API
 // ------------------------------------------------------------
@@ -65,15 +243,16 @@ bool URacingCurriculumDataAsset::FindSegmentAtDistance(float DistanceCm, FRacing
 		S = FMath::Clamp(S, 0.f, SplineLengthCm);
 	}
 
-	for (const FRacingCurriculumSegment& Seg : Segments)
+	EnsureSamplingTables();
+
+	const int32 SegIdx = FindSegmentIndexAtDistance(S);
+	if (SegIdx != INDEX_NONE)
 	{
-		if (S >= Seg.StartDistanceCm && S <= Seg.EndDistanceCm)
-		{
-			OutSegment = Seg;
-			CUR_LOGFMT(VeryVerbose, "Segment found: {Start}-{End} (S={S})",
-				("Start", Seg.StartDistanceCm), ("End", Seg.EndDistanceCm), ("S", S));
-			return true;
-		}
+		const FRacingCurriculumSegment& Seg = Segments[SegIdx];
+		OutSegment = Seg;
+		CUR_LOGFMT(VeryVerbose, "Segment found: {Start}-{End} (S={S})",
+			("Start", Seg.StartDistanceCm), ("End", Seg.EndDistanceCm), ("S", S));
+		return true;
 	}
 
 	CUR_LOGFMT(VeryVerbose, "No segment found at S={S}", ("S", S));
@@ -96,30 +275,27 @@ bool URacingCurriculumDataAsset::GetRandomDistanceInTag(
 		return false;
 	}
 
-	TArray<int32> CandidateIdx;
-	CandidateIdx.Reserve(Segments.Num());
-
-	for (int32 i = 0; i < Segments.Num(); ++i)
-	{
-		const FRacingCurriculumSegment& Seg = Segments[i];
-		const bool bMatch = bRequireAllTags
-			? ((Seg.TagMask & InMask) == InMask)
-			: ((Seg.TagMask & InMask) != 0);
+	EnsureSamplingTables();
 
-		if (bMatch)
-		{
-			CandidateIdx.Add(i);
-		}
-	}
+	// Bits outside the tag enum can never match (any) / always fail (all)
+	const int32 Mask = InMask & (NumTagMasks - 1);
+	const bool bUnknownBits = (InMask & ~(NumTagMasks - 1)) != 0;
+	const FTagSampleTable& Table = TagTables[(bRequireAllTags ? NumTagMasks : 0) + Mask];
 
-	if (CandidateIdx.IsEmpty())
+	if (Mask == 0 || Table.Num == 0 || (bRequireAllTags && bUnknownBits))
 	{
 		CUR_LOGFMT(Warning, "No candidates found for Mask=0x{Mask} RequireAll={All}",
 			("Mask", InMask), ("All", bRequireAllTags ? 1 : 0));
 		return false;
 	}
 
-	const FRacingCurriculumSegment& PickSeg = Segments[CandidateIdx[Rng.RandRange(0, CandidateIdx.Num() - 1)]];
+	// Length-weighted: every cm of matching track is equally likely
+	const int32 Column = Rng.RandRange(0, Table.Num - 1);
+	const int32 Pick = (Rng.GetFraction() < SampleAliasProb[Table.First + Column])
+		? Column
+		: SampleAliasIndex[Table.First + Column];
+
+	const FRacingCurriculumSegment& PickSeg = Segments[SampleSegmentIndex[Table.First + Pick]];
 	OutDistanceCm = FMath::Clamp(Rng.FRandRange(PickSeg.StartDistanceCm, PickSeg.EndDistanceCm), 0.f, SplineLengthCm);
 
 	CUR_LOGFMT(Verbose, "Picked random distance: Mask=0x{Mask}, Range=[{Start},{End}] Out={Out}",
@@ -12,18 +12,14 @@
 
 // If your RoadSplineInterface exists (like in your Respawn subsystem), include it:
 #include "Interfaces/RoadSplineInterface.h"
+#include "Track/TrackFrameTable.h"
 
 // NoSpawnZone support
-#include "Actors/NoSpawnZoneActor.h"
+#include "Subsystems/NoSpawnZoneSubsystem.h"
 #include "Components/BoxComponent.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogRacingCurriculumDebug, Log, All);
 
-static float SafeAcos(float X)
-{
-	return FMath::Acos(FMath::Clamp(X, -1.f, 1.f));
-}
-
 static float ComputePitchDegFromForward(const FVector& Forward)
 {
 	FVector F = Forward;
@@ -94,7 +90,8 @@ void ARacingCurriculumDebugActor::ClearRecordedSpawns()
 void ARacingCurriculumDebugActor::ReportAgentSpawn_Implementation(AActor* Agent, const FTransform& SpawnWorldTransform, FName Reason, float Score)
 {
 	EnsureTrackSpline();
-	if (!TrackSpline || CachedSplineLengthCm <= 1.f)
+	EnsureFrameTable();
+	if (!TrackSpline || !FrameTable || CachedSplineLengthCm <= 1.f)
 	{
 		return;
 	}
@@ -103,7 +100,7 @@ void ARacingCurriculumDebugActor::ReportAgentSpawn_Implementation(AActor* Agent,
 	const float Key = TrackSpline->FindInputKeyClosestToWorldLocation(Loc);
 	const float S = TrackSpline->GetDistanceAlongSplineAtSplineInputKey(Key);
 
-	FVector Fwd = TrackSpline->GetDirectionAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
+	FVector Fwd = FrameTable->GetDirectionAtDistance(S);
 	float CurvNormAbs = 0.f;
 	float SlopeZ = 0.f;
 	const int32 TagMask = BuildTagMask(S, CachedSplineLengthCm, Fwd, CurvNormAbs, SlopeZ);
@@ -234,6 +231,7 @@ void ARacingCurriculumDebugActor::RebuildInternal(bool bFromConstruction)
 	UE_LOG(LogRacingCurriculumDebug, Log, TEXT("RacingCurriculumDebugActor: RebuildInternal() gestartet (bFromConstruction=%d)"), bFromConstruction ? 1 : 0);
 
 	EnsureTrackSpline();
+	EnsureFrameTable();
 
 	CachedSamples.Reset();
 	CachedSegments.Reset();
@@ -248,7 +246,7 @@ void ARacingCurriculumDebugActor::RebuildInternal(bool bFromConstruction)
 	}
 
 	CachedSplineLengthCm = TrackSpline->GetSplineLength();
-	if (CachedSplineLengthCm <= 1.f)
+	if (CachedSplineLengthCm <= 1.f || !FrameTable)
 	{
 		UE_LOG(LogRacingCurriculumDebug, Warning, TEXT("RacingCurriculumDebugActor: RebuildInternal() - Spline-Länge zu klein: %.1f cm"), CachedSplineLengthCm);
 		bBuiltOnce = false;
@@ -272,6 +270,21 @@ void ARacingCurriculumDebugActor::RebuildInternal(bool bFromConstruction)
 	UE_LOG(LogRacingCurriculumDebug, Log, TEXT("RacingCurriculumDebugActor: RebuildInternal() abgeschlossen - bBuiltOnce=true"));
 }
 
+void ARacingCurriculumDebugActor::EnsureFrameTable()
+{
+	// Gebackene Tabelle des Track-Actors, sonst einmal selbst bauen (bis sich die Spline ändert)
+	if (!TrackSpline)
+	{
+		FrameTable.Reset();
+		return;
+	}
+
+	if (!FrameTable || !FrameTable->IsUpToDate(TrackSpline))
+	{
+		FrameTable = FTrackFrameTable::FindOrBuild(TrackSpline, FMath::Clamp(0.5f * FMath::Max(10.f, CurvatureWindowCm), 5.f, 50.f));
+	}
+}
+
 float ARacingCurriculumDebugActor::WrapDistance(float S, float LengthCm) const
 {
 	if (LengthCm <= 1.f) return 0.f;
@@ -339,22 +352,22 @@ bool ARacingCurriculumDebugActor::TraceSurfaceAtDistance(float S, FVector& OutSu
 	OutSurfacePos = FVector::ZeroVector;
 	OutSurfaceNormal = FVector::UpVector;
 
-	if (!TrackSpline) return false;
+	if (!FrameTable) return false;
 
 	UWorld* World = GetWorld();
 	if (!World) return false;
 
-	const float Len = TrackSpline->GetSplineLength();
+	const float Len = FrameTable->GetLengthCm();
 	if (Len <= 1.f) return false;
 
 	const float SWrapped = WrapDistance(S, Len);
 
-	const FVector SplinePos = TrackSpline->GetLocationAtDistanceAlongSpline(SWrapped, ESplineCoordinateSpace::World);
+	const FVector SplinePos = FrameTable->GetLocationAtDistance(SWrapped);
 
 	FVector UpDir = FVector::UpVector;
 	if (bTraceAlongSplineUp)
 	{
-		UpDir = TrackSpline->GetUpVectorAtDistanceAlongSpline(SWrapped, ESplineCoordinateSpace::World).GetSafeNormal();
+		UpDir = FrameTable->GetUpAtDistance(SWrapped);
 		if (UpDir.IsNearlyZero())
 		{
 			UpDir = FVector::UpVector;
@@ -410,27 +423,11 @@ float ARacingCurriculumDebugActor::ComputeCurvatureInvCm(float S, float WindowCm
 {
 	InOutForward = FVector::ForwardVector;
 
-	if (!TrackSpline || LengthCm <= 1.f) return 0.f;
-
-	const float W = FMath::Max(10.f, WindowCm);
-
-	const float Sc = WrapDistance(S, LengthCm);
-	const float S0 = WrapDistance(S - W, LengthCm);
-	const float S1 = WrapDistance(S + W, LengthCm);
-
-	FVector F0 = TrackSpline->GetDirectionAtDistanceAlongSpline(S0, ESplineCoordinateSpace::World);
-	FVector F1 = TrackSpline->GetDirectionAtDistanceAlongSpline(S1, ESplineCoordinateSpace::World);
-	FVector Fc = TrackSpline->GetDirectionAtDistanceAlongSpline(Sc, ESplineCoordinateSpace::World);
+	if (!FrameTable || LengthCm <= 1.f) return 0.f;
 
-	if (!F0.Normalize()) F0 = FVector::ForwardVector;
-	if (!F1.Normalize()) F1 = FVector::ForwardVector;
-	if (!Fc.Normalize()) Fc = FVector::ForwardVector;
-
-	InOutForward = Fc;
-
-	const float AngleRad = SafeAcos(FVector::DotProduct(F0, F1));
-	const float Ds = FMath::Max(1.f, 2.f * W); // cm
-	return AngleRad / Ds; // 1/cm
+	// Tabelle wrappt (Loop) bzw. clampt die Fensterenden selbst
+	InOutForward = FrameTable->GetDirectionAtDistance(WrapDistance(S, LengthCm));
+	return FrameTable->ComputeCurvatureInvCm(S, WindowCm); // 1/cm
 }
 
 int32 ARacingCurriculumDebugActor::BuildTagMask(float S, float LengthCm, FVector& InOutForward, float& OutCurvNormAbs, float& OutSlopeZ) const
@@ -517,28 +514,9 @@ float ARacingCurriculumDebugActor::ComputeSpawnScore01(
 // Helper: Check if point is in any NoSpawnZone
 bool ARacingCurriculumDebugActor::IsInAnyNoSpawnZone(const FVector& WorldPoint) const
 {
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return false;
-	}
-
-	for (TActorIterator<ANoSpawnZoneActor> It(World); It; ++It)
-	{
-		ANoSpawnZoneActor* Zone = *It;
-		if (!IsValid(Zone))
-		{
-			continue;
-		}
-
-		// Use the ContainsPoint method from NoSpawnZoneActor
-		if (Zone->ContainsPoint(WorldPoint))
-		{
-			return true;
-		}
-	}
-
-	return false;
+	// Shared grid index of the world (same test as ANoSpawnZoneActor::ContainsPoint)
+	const UNoSpawnZoneSubsystem* ZoneIndex = UNoSpawnZoneSubsystem::Get(GetWorld());
+	return ZoneIndex && ZoneIndex->IsPointBlocked(WorldPoint);
 }
 
 FColor ARacingCurriculumDebugActor::ColorForScore01(float Score01, bool bValidHit) const
@@ -619,7 +597,7 @@ void ARacingCurriculumDebugActor::BuildSamples()
 {
 	CachedSamples.Reset();
 
-	if (!TrackSpline || CachedSplineLengthCm <= 1.f)
+	if (!FrameTable || CachedSplineLengthCm <= 1.f)
 	{
 		return;
 	}
@@ -636,7 +614,7 @@ void ARacingCurriculumDebugActor::BuildSamples()
 		FRC_DebugSample Smpl;
 		Smpl.S = S;
 
-		FVector Fwd = TrackSpline->GetDirectionAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
+		FVector Fwd = FrameTable->GetDirectionAtDistance(S);
 		if (!Fwd.Normalize()) Fwd = FVector::ForwardVector;
 
 		float CurvNormAbs = 0.f;
@@ -654,9 +632,9 @@ void ARacingCurriculumDebugActor::BuildSamples()
 			// Optional debug draw
 			if (DebugDrawTraceEveryNSamples > 0 && (i % DebugDrawTraceEveryNSamples) == 0)
 			{
-				const FVector SplinePos = TrackSpline->GetLocationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
+				const FVector SplinePos = FrameTable->GetLocationAtDistance(S);
 				FVector UpDir = bTraceAlongSplineUp
-					? TrackSpline->GetUpVectorAtDistanceAlongSpline(S, ESplineCoordinateSpace::World).GetSafeNormal()
+					? FrameTable->GetUpAtDistance(S)
 					: FVector::UpVector;
 
 				if (UpDir.IsNearlyZero()) UpDir = FVector::UpVector;
@@ -687,13 +665,13 @@ void ARacingCurriculumDebugActor::BuildSamples()
 		{
 			// fallback: spline position (NOT landscape!)
 			FVector UpDir = bTraceAlongSplineUp
-				? TrackSpline->GetUpVectorAtDistanceAlongSpline(S, ESplineCoordinateSpace::World).GetSafeNormal()
+				? FrameTable->GetUpAtDistance(S)
 				: FVector::UpVector;
 
 			if (UpDir.IsNearlyZero()) UpDir = FVector::UpVector;
 
 			DrawNormal = UpDir;
-			DrawPos = TrackSpline->GetLocationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World) + UpDir * DrawSurfaceOffsetCm;
+			DrawPos = FrameTable->GetLocationAtDistance(S) + UpDir * DrawSurfaceOffsetCm;
 		}
 
 		// SpawnScore based on curvature + pitch + surface normal
@@ -851,7 +829,7 @@ void ARacingCurriculumDebugActor::DrawInternal()
 
 void ARacingCurriculumDebugActor::DrawSpawnCandidates()
 {
-	if (!TrackSpline || CachedSplineLengthCm <= 1.f) return;
+	if (!FrameTable || CachedSplineLengthCm <= 1.f) return;
 	UWorld* World = GetWorld();
 	if (!World) return;
 
@@ -863,7 +841,7 @@ void ARacingCurriculumDebugActor::DrawSpawnCandidates()
 		const float S = WrapDistance(i * Step, CachedSplineLengthCm);
 
 		// If we already built samples densely, we could reuse nearest sample; keep it simple here:
-		FVector Fwd = TrackSpline->GetDirectionAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
+		FVector Fwd = FrameTable->GetDirectionAtDistance(S);
 		if (!Fwd.Normalize()) Fwd = FVector::ForwardVector;
 
 		float CurvNormAbs = 0.f;
@@ -885,11 +863,11 @@ void ARacingCurriculumDebugActor::DrawSpawnCandidates()
 		{
 			// No fallback to landscape here; we show spline point only
 			FVector UpDir = bTraceAlongSplineUp
-				? TrackSpline->GetUpVectorAtDistanceAlongSpline(S, ESplineCoordinateSpace::World).GetSafeNormal()
+				? FrameTable->GetUpAtDistance(S)
 				: FVector::UpVector;
 			if (UpDir.IsNearlyZero()) UpDir = FVector::UpVector;
 
-			P = TrackSpline->GetLocationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World) + UpDir * (DrawSurfaceOffsetCm + SpawnPointZOffsetCm);
+			P = FrameTable->GetLocationAtDistance(S) + UpDir * (DrawSurfaceOffsetCm + SpawnPointZOffsetCm);
 			Nrm = UpDir;
 		}
 
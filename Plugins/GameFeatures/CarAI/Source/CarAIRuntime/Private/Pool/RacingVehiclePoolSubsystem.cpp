@@ -0,0 +1,291 @@
+#include "Pool/RacingVehiclePoolSubsystem.h"
+#include "Components/RacingAgentComponent.h"
+
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Components/PrimitiveComponent.h"
+#include "ChaosWheeledVehicleMovementComponent.h"
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void URacingVehiclePoolSubsystem::Deinitialize()
+{
+	// Actors are owned by the world and go away with it; just drop our references
+	Buckets.Empty();
+
+	Super::Deinitialize();
+}
+
+// ============================================================================
+// Pool API
+// ============================================================================
+
+int32 URacingVehiclePoolSubsystem::Prewarm(TSubclassOf<APawn> PawnClass, int32 Count)
+{
+	if (!PawnClass || Count <= 0)
+	{
+		return 0;
+	}
+
+	FRacingVehiclePoolBucket& Bucket = FindOrAddBucket(PawnClass);
+
+	int32 Spawned = 0;
+	while (Bucket.Free.Num() < Count)
+	{
+		APawn* Pawn = SpawnPooledPawn(PawnClass);
+		if (!Pawn)
+		{
+			break;
+		}
+
+		ParkPawn(Pawn);
+		Bucket.Free.Add(Pawn);
+		++Spawned;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[RacingVehiclePool] Prewarmed %d x %s (free: %d, active: %d)"),
+		Spawned, *PawnClass->GetName(), Bucket.Free.Num(), Bucket.Active.Num());
+
+	return Spawned;
+}
+
+APawn* URacingVehiclePoolSubsystem::AcquireVehicle(TSubclassOf<APawn> PawnClass, const FTransform& SpawnTransform, USimpleNeuralNetwork* Network)
+{
+	if (!PawnClass)
+	{
+		return nullptr;
+	}
+
+	FRacingVehiclePoolBucket& Bucket = FindOrAddBucket(PawnClass);
+
+	APawn* Pawn = nullptr;
+	while (!Pawn && Bucket.Free.Num() > 0)
+	{
+		Pawn = Bucket.Free.Pop(EAllowShrinking::No);
+		if (!IsValid(Pawn))
+		{
+			Pawn = nullptr;
+		}
+	}
+
+	if (!Pawn)
+	{
+		// Pool exhausted: grow it (this is the hitch we normally avoid via Prewarm)
+		Pawn = SpawnPooledPawn(PawnClass);
+		if (!Pawn)
+		{
+			return nullptr;
+		}
+	}
+
+	ActivatePawn(Pawn, SpawnTransform, Network);
+	Bucket.Active.Add(Pawn);
+
+	return Pawn;
+}
+
+bool URacingVehiclePoolSubsystem::ReleaseVehicle(APawn* Pawn)
+{
+	if (!IsValid(Pawn))
+	{
+		return false;
+	}
+
+	for (FRacingVehiclePoolBucket& Bucket : Buckets)
+	{
+		if (Bucket.Active.RemoveSingleSwap(Pawn, EAllowShrinking::No) > 0)
+		{
+			ParkPawn(Pawn);
+			Bucket.Free.Add(Pawn);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void URacingVehiclePoolSubsystem::ReleaseAllVehicles()
+{
+	for (FRacingVehiclePoolBucket& Bucket : Buckets)
+	{
+		for (APawn* Pawn : Bucket.Active)
+		{
+			if (IsValid(Pawn))
+			{
+				ParkPawn(Pawn);
+				Bucket.Free.Add(Pawn);
+			}
+		}
+		Bucket.Active.Reset();
+	}
+}
+
+void URacingVehiclePoolSubsystem::DestroyPool()
+{
+	int32 Destroyed = 0;
+
+	for (FRacingVehiclePoolBucket& Bucket : Buckets)
+	{
+		for (APawn* Pawn : Bucket.Free)
+		{
+			if (IsValid(Pawn))
+			{
+				Pawn->Destroy();
+				++Destroyed;
+			}
+		}
+		for (APawn* Pawn : Bucket.Active)
+		{
+			if (IsValid(Pawn))
+			{
+				Pawn->Destroy();
+				++Destroyed;
+			}
+		}
+	}
+
+	Buckets.Empty();
+
+	UE_LOG(LogTemp, Log, TEXT("[RacingVehiclePool] Destroyed %d pooled vehicles"), Destroyed);
+}
+
+int32 URacingVehiclePoolSubsystem::GetNumFree(TSubclassOf<APawn> PawnClass) const
+{
+	const FRacingVehiclePoolBucket* Bucket = FindBucket(PawnClass);
+	return Bucket ? Bucket->Free.Num() : 0;
+}
+
+int32 URacingVehiclePoolSubsystem::GetNumActive(TSubclassOf<APawn> PawnClass) const
+{
+	const FRacingVehiclePoolBucket* Bucket = FindBucket(PawnClass);
+	return Bucket ? Bucket->Active.Num() : 0;
+}
+
+bool URacingVehiclePoolSubsystem::IsPooled(const APawn* Pawn) const
+{
+	return IsValid(Pawn) && Pawn->ActorHasTag(PooledTag);
+}
+
+// ============================================================================
+// Internals
+// ============================================================================
+
+FRacingVehiclePoolBucket& URacingVehiclePoolSubsystem::FindOrAddBucket(TSubclassOf<APawn> PawnClass)
+{
+	for (FRacingVehiclePoolBucket& Bucket : Buckets)
+	{
+		if (Bucket.PawnClass == PawnClass)
+		{
+			return Bucket;
+		}
+	}
+
+	FRacingVehiclePoolBucket& NewBucket = Buckets.AddDefaulted_GetRef();
+	NewBucket.PawnClass = PawnClass;
+	return NewBucket;
+}
+
+const FRacingVehiclePoolBucket* URacingVehiclePoolSubsystem::FindBucket(TSubclassOf<APawn> PawnClass) const
+{
+	return Buckets.FindByPredicate([PawnClass](const FRacingVehiclePoolBucket& Bucket)
+		{
+			return Bucket.PawnClass == PawnClass;
+		});
+}
+
+APawn* URacingVehiclePoolSubsystem::SpawnPooledPawn(TSubclassOf<APawn> PawnClass)
+{
+	UWorld* World = GetWorld();
+	if (!World || !PawnClass)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	APawn* Pawn = World->SpawnActor<APawn>(PawnClass, ParkingLocation, FRotator::ZeroRotator, SpawnParams);
+	if (!Pawn)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RacingVehiclePool] Failed to spawn %s"), *PawnClass->GetName());
+		return nullptr;
+	}
+
+	Pawn->Tags.AddUnique(PooledTag);
+
+#if WITH_EDITOR
+	if (GIsEditor)
+	{
+		Pawn->SetFolderPath(FName(TEXT("AICars")));
+	}
+#endif
+
+	return Pawn;
+}
+
+void URacingVehiclePoolSubsystem::ParkPawn(APawn* Pawn) const
+{
+	if (!Pawn)
+	{
+		return;
+	}
+
+	if (URacingAgentComponent* Agent = Pawn->FindComponentByClass<URacingAgentComponent>())
+	{
+		Agent->SetComponentTickEnabled(false);
+	}
+
+	if (UChaosWheeledVehicleMovementComponent* MovementComp = Pawn->FindComponentByClass<UChaosWheeledVehicleMovementComponent>())
+	{
+		MovementComp->StopMovementImmediately();
+		MovementComp->Deactivate();
+	}
+
+	if (UPrimitiveComponent* RootComp = Cast<UPrimitiveComponent>(Pawn->GetRootComponent()))
+	{
+		RootComp->SetSimulatePhysics(false);
+	}
+
+	Pawn->SetActorEnableCollision(false);
+	Pawn->SetActorHiddenInGame(true);
+	Pawn->SetActorTickEnabled(false);
+	Pawn->SetActorLocation(ParkingLocation, false, nullptr, ETeleportType::ResetPhysics);
+}
+
+void URacingVehiclePoolSubsystem::ActivatePawn(APawn* Pawn, const FTransform& SpawnTransform, USimpleNeuralNetwork* Network) const
+{
+	if (!Pawn)
+	{
+		return;
+	}
+
+	Pawn->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	Pawn->SetActorHiddenInGame(false);
+	Pawn->SetActorEnableCollision(true);
+	Pawn->SetActorTickEnabled(true);
+
+	if (UPrimitiveComponent* RootComp = Cast<UPrimitiveComponent>(Pawn->GetRootComponent()))
+	{
+		RootComp->SetSimulatePhysics(true);
+		RootComp->SetPhysicsLinearVelocity(FVector::ZeroVector);
+		RootComp->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+	}
+
+	if (UChaosWheeledVehicleMovementComponent* MovementComp = Pawn->FindComponentByClass<UChaosWheeledVehicleMovementComponent>())
+	{
+		MovementComp->Activate(true);
+		MovementComp->ResetVehicleState();
+	}
+
+	// Rebind the agent; it is (re)initialized by whoever drives the training (ResetEpisode / Initialize)
+	if (URacingAgentComponent* Agent = Pawn->FindComponentByClass<URacingAgentComponent>())
+	{
+		Agent->ClearResetSnapshot();
+		if (Network)
+		{
+			Agent->SetNeuralNetwork(Network);
+		}
+	}
+}
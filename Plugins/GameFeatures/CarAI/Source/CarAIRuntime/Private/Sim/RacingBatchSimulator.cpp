@@ -0,0 +1,850 @@
+#include "Sim/RacingBatchSimulator.h"
+#include "Components/RacingAgentComponent.h"
+#include "NN/SimpleNeuralNetwork.h"
+
+#include "Components/SplineComponent.h"
+#include "Engine/World.h"
+#include "CollisionQueryParams.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+
+namespace RacingBatchSim
+{
+	static constexpr float Gravity = 980.f;
+
+	/** Bake trace window around the spline (cm) */
+	static constexpr float SurfaceTraceUpCm = 500.f;
+	static constexpr float SurfaceTraceDownCm = 1500.f;
+
+	/** Below this speed slip angles are computed against this speed (cm/s) */
+	static constexpr float MinSlipSpeed = 50.f;
+
+	/** Keeps 1 - D * Curvature away from zero on the inside of tight corners */
+	static constexpr float MinPathScale = 0.1f;
+
+	/** Progress stall window resolution (matches URacingAgentComponent) */
+	static constexpr int32 ProgressWindowSlices = 10;
+}
+
+// ============================================================================
+// Setup
+// ============================================================================
+
+void URacingBatchSimulator::ConfigureFromAgent(const URacingAgentComponent* Agent)
+{
+	if (!Agent)
+	{
+		return;
+	}
+
+	Config.RayMaxDistanceCm = Agent->RayMaxDistanceCm;
+	Config.RayStartOffsetCm = Agent->RayStartOffsetCm;
+	Config.RayHeightOffsetCm = Agent->RayHeightOffsetCm;
+	Config.GroundRayMaxDistanceCm = Agent->GroundRayMaxDistanceCm;
+	Config.bEnableIMUSensor = Agent->bEnableIMUSensor;
+	Config.bEnableLidar = Agent->bEnableLidar;
+	Config.LidarNumRays = Agent->LidarNumRays;
+	Config.LidarMaxDistanceCm = Agent->LidarMaxDistanceCm;
+	Config.SpeedNormCmPerSec = Agent->SpeedNormCmPerSec;
+	Config.AngVelNormDegPerSec = Agent->AngVelNormDegPerSec;
+	Config.RewardCfg = Agent->RewardCfg;
+}
+
+bool URacingBatchSimulator::BakeTrack(USplineComponent* Spline, UWorld* SurfaceTraceWorld)
+{
+	if (!Spline)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RacingBatchSimulator] BakeTrack: no spline"));
+		return false;
+	}
+
+	// Same frames as the agents see: the table baked by the track if it is fine enough, else our own
+	const float MaxStepCm = FMath::Max(Config.TrackBakeStepCm, 10.f);
+	TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Frames = FTrackFrameTable::FindBaked(Spline);
+	if (!Frames.IsValid() || Frames->GetStepCm() > MaxStepCm)
+	{
+		Frames = FTrackFrameTable::Build(Spline, MaxStepCm);
+	}
+
+	if (!Frames.IsValid() || !Frames->IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RacingBatchSimulator] BakeTrack: spline has no length"));
+		return false;
+	}
+
+	Track = FRacingBatchSimTrack();
+	Track.Frames = Frames;
+	Track.bClosedLoop = Frames->IsClosedLoop();
+	Track.LengthCm = Frames->GetLengthCm();
+	Track.StepCm = Frames->GetStepCm();
+
+	const float Length = Track.LengthCm;
+	const int32 N = Frames->GetNumSamples();
+
+	Track.CurvatureLateral.SetNumZeroed(N);
+	Track.CurvatureVertical.SetNumZeroed(N);
+	Track.SurfaceOffset.SetNumZeroed(N);
+	Track.HasSurface.Init(1, N);
+
+	FCollisionObjectQueryParams ObjectParams;
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldStatic);
+	ObjectParams.AddObjectTypesToQuery(ECC_WorldDynamic);
+	const FCollisionQueryParams TraceParams(SCENE_QUERY_STAT(RacingBatchSimBake), true);
+
+	int32 NumGaps = 0;
+
+	if (SurfaceTraceWorld)
+	{
+		for (int32 k = 0; k < N; ++k)
+		{
+			FVector P, T, R, Up;
+			Frames->SampleFrame(FMath::Min(k * Track.StepCm, Length), P, T, R, Up);
+
+			FHitResult Hit;
+			const FVector Start = P + Up * RacingBatchSim::SurfaceTraceUpCm;
+			const FVector End = P - Up * RacingBatchSim::SurfaceTraceDownCm;
+
+			if (SurfaceTraceWorld->LineTraceSingleByObjectType(Hit, Start, End, ObjectParams, TraceParams))
+			{
+				Track.SurfaceOffset[k] = FVector::DotProduct(Hit.ImpactPoint - P, Up);
+			}
+			else
+			{
+				Track.HasSurface[k] = 0;
+				++NumGaps;
+			}
+		}
+	}
+
+	// Curvatures by central differences of the tangent
+	for (int32 k = 0; k < N; ++k)
+	{
+		int32 Prev = k - 1;
+		int32 Next = k + 1;
+		if (Track.bClosedLoop)
+		{
+			Prev = (Prev + N) % N;
+			Next = Next % N;
+		}
+		else
+		{
+			Prev = FMath::Max(Prev, 0);
+			Next = FMath::Min(Next, N - 1);
+		}
+
+		const float Span = (Next - Prev + (Track.bClosedLoop && Next < Prev ? N : 0)) * Track.StepCm;
+		if (Span <= KINDA_SMALL_NUMBER)
+		{
+			continue;
+		}
+
+		const float Dist = FMath::Min(k * Track.StepCm, Length);
+		const FVector dT = (Frames->GetDirectionAtDistance(Next * Track.StepCm) - Frames->GetDirectionAtDistance(Prev * Track.StepCm)) / Span;
+		Track.CurvatureLateral[k] = FVector::DotProduct(dT, Frames->GetRightAtDistance(Dist));
+		Track.CurvatureVertical[k] = FVector::DotProduct(dT, Frames->GetUpAtDistance(Dist));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[RacingBatchSimulator] Baked track: %.0f m, %d samples (%.0f cm), %d gap samples, %s"),
+		Length / 100.f, N, Track.StepCm, NumGaps, Track.bClosedLoop ? TEXT("closed") : TEXT("open"));
+
+	return true;
+}
+
+bool URacingBatchSimulator::Initialize()
+{
+	if (!Track.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RacingBatchSimulator] Initialize: bake a track first"));
+		return false;
+	}
+
+	NumCars = FMath::Max(1, Config.NumCars);
+	SimulatedCarSeconds = 0.0;
+
+	S.SetNumZeroed(NumCars);
+	D.SetNumZeroed(NumCars);
+	H.SetNumZeroed(NumCars);
+	Psi.SetNumZeroed(NumCars);
+	U.SetNumZeroed(NumCars);
+	V.SetNumZeroed(NumCars);
+	W.SetNumZeroed(NumCars);
+	YawRate.SetNumZeroed(NumCars);
+	Grounded.SetNumZeroed(NumCars);
+
+	Done.SetNumZeroed(NumCars);
+	StepCount.SetNumZeroed(NumCars);
+	EpisodeTime.SetNumZeroed(NumCars);
+	AirborneTime.SetNumZeroed(NumCars);
+	StuckTime.SetNumZeroed(NumCars);
+	LastSteer.SetNumZeroed(NumCars);
+	TrackProgress.SetNumZeroed(NumCars);
+	ProgressWindowSamples.SetNumZeroed(NumCars * (RacingBatchSim::ProgressWindowSlices + 1));
+	ProgressWindowHead.SetNumZeroed(NumCars);
+	ProgressWindowCount.SetNumZeroed(NumCars);
+	ProgressSampleAccum.SetNumZeroed(NumCars);
+	StartLocation.SetNumZeroed(NumCars);
+	Stats.SetNum(NumCars);
+	Observations.SetNum(NumCars);
+	Actions.SetNum(NumCars);
+	Rewards.SetNum(NumCars);
+	CompletedEpisodes.Reset();
+
+	CarRng.SetNum(NumCars);
+	for (int32 i = 0; i < NumCars; ++i)
+	{
+		CarRng[i].Initialize(static_cast<int32>(HashCombine(GetTypeHash(Config.RandomSeed), GetTypeHash(i)) & 0x7fffffff));
+	}
+
+	// Policies may have been set for a different car count
+	SetPolicies(TArray<USimpleNeuralNetwork*>(Policies));
+
+	ResetAllCars();
+
+	UE_LOG(LogTemp, Log, TEXT("[RacingBatchSimulator] Initialized %d cars"), NumCars);
+	return true;
+}
+
+void URacingBatchSimulator::SetPolicies(const TArray<USimpleNeuralNetwork*>& InPolicies)
+{
+	Policies.Reset(InPolicies.Num());
+	for (USimpleNeuralNetwork* Policy : InPolicies)
+	{
+		Policies.Add(Policy);
+	}
+
+	// ForwardPolicy writes layer scratch buffers -> only parallel if no network is shared
+	TSet<USimpleNeuralNetwork*> Unique;
+	bool bAllValid = true;
+	for (USimpleNeuralNetwork* Policy : InPolicies)
+	{
+		bAllValid &= Policy != nullptr;
+		Unique.Add(Policy);
+	}
+	bPoliciesUnique = bAllValid && InPolicies.Num() >= NumCars && Unique.Num() == InPolicies.Num();
+}
+
+// ============================================================================
+// Reset
+// ============================================================================
+
+void URacingBatchSimulator::ResetAllCars()
+{
+	for (int32 i = 0; i < NumCars; ++i)
+	{
+		ResetCar(i);
+	}
+}
+
+void URacingBatchSimulator::ResetCar(int32 i)
+{
+	if (!S.IsValidIndex(i))
+	{
+		return;
+	}
+
+	FRandomStream& Rng = CarRng[i];
+
+	S[i] = WrapDistance(Config.SpawnDistanceCm + Rng.FRandRange(-Config.SpawnDistanceJitterCm, Config.SpawnDistanceJitterCm));
+	D[i] = Rng.FRandRange(-Config.SpawnLateralJitterCm, Config.SpawnLateralJitterCm);
+	H[i] = Config.Vehicle.RideHeightCm;
+	Psi[i] = 0.f;
+	U[i] = 0.f;
+	V[i] = 0.f;
+	W[i] = 0.f;
+	YawRate[i] = 0.f;
+	Grounded[i] = 1;
+
+	Done[i] = 0;
+	StepCount[i] = 0;
+	EpisodeTime[i] = 0.f;
+	AirborneTime[i] = 0.f;
+	StuckTime[i] = 0.f;
+	LastSteer[i] = 0.f;
+	TrackProgress[i] = 0.f;
+	ProgressWindowHead[i] = 0;
+	ProgressWindowCount[i] = 0;
+	ProgressSampleAccum[i] = 0.f;
+	StartLocation[i] = GetCarLocation(i);
+
+	Stats[i] = FEpisodeStats();
+	Stats[i].StartTime = FDateTime::Now();
+
+	Observations[i] = FRacingObservation();
+	Actions[i] = FVehicleAction();
+	Rewards[i] = FRewardBreakdown();
+}
+
+// ============================================================================
+// Simulation
+// ============================================================================
+
+void URacingBatchSimulator::Step(float DeltaTime)
+{
+	if (NumCars <= 0 || !Track.IsValid() || DeltaTime <= 0.f)
+	{
+		return;
+	}
+
+	const FRacingRewardConfig& RewardCfg = Config.RewardCfg;
+
+	// 1. Observation + Reward
+	ParallelFor(NumCars, [this, &RewardCfg](int32 i)
+	{
+		if (Done[i])
+		{
+			return;
+		}
+
+		BuildObservation(i, Observations[i]);
+
+		const float DistanceFromStartCm = FVector::Dist(GetCarLocation(i), StartLocation[i]);
+		Rewards[i] = RewardCfg.ComputeReward(Observations[i], DistanceFromStartCm, EpisodeTime[i], Stats[i].DistanceTraveledCm, LastSteer[i]);
+	});
+
+	// 2. Policy
+	auto RunPolicy = [this](int32 i)
+	{
+		if (Done[i])
+		{
+			return;
+		}
+
+		USimpleNeuralNetwork* Policy = Policies.Num() == 1 ? Policies[0].Get()
+			: (Policies.IsValidIndex(i) ? Policies[i].Get() : nullptr);
+
+		FVehicleAction& Action = Actions[i];
+		if (Policy)
+		{
+			TArray<float> PolicyOutput;
+			Policy->ForwardPolicy(Observations[i].Vector, PolicyOutput);
+			if (PolicyOutput.Num() == 3)
+			{
+				Action.Steer = FMath::Clamp(PolicyOutput[0], -1.f, 1.f);
+				Action.Throttle = FMath::Clamp(PolicyOutput[1], 0.f, 1.f);
+				Action.Brake = FMath::Clamp(PolicyOutput[2], 0.f, 1.f);
+			}
+		}
+		else
+		{
+			// Fallback: Go forward (same as URacingAgentComponent)
+			Action.Steer = 0.f;
+			Action.Throttle = 0.5f;
+			Action.Brake = 0.f;
+		}
+	};
+
+	if (bPoliciesUnique)
+	{
+		ParallelFor(NumCars, RunPolicy);
+	}
+	else
+	{
+		for (int32 i = 0; i < NumCars; ++i)
+		{
+			RunPolicy(i);
+		}
+	}
+
+	// 3. Stats, terminal check, integrate
+	ParallelFor(NumCars, [this, &RewardCfg, DeltaTime](int32 i)
+	{
+		if (Done[i])
+		{
+			return;
+		}
+
+		const FRacingObservation& Obs = Observations[i];
+		const FRewardBreakdown& Reward = Rewards[i];
+		FEpisodeStats& EpStats = Stats[i];
+
+		StepCount[i]++;
+		EpisodeTime[i] += DeltaTime;
+		EpStats.TotalReward += Reward.Total;
+		EpStats.StepCount = StepCount[i];
+		EpStats.DurationSeconds = EpisodeTime[i];
+		EpStats.DistanceTraveledCm = FVector::Dist(GetCarLocation(i), StartLocation[i]);
+		EpStats.MaxSpeed = FMath::Max(EpStats.MaxSpeed, Obs.SpeedNorm * Config.SpeedNormCmPerSec);
+
+		FString TermReason;
+		bool bTerminal = RewardCfg.CheckTerminal(Obs, DeltaTime, StepCount[i], AirborneTime[i], StuckTime[i], TermReason) || Reward.bDone;
+
+		// Progress stall (track distance over a sliding window)
+		if (!bTerminal && RewardCfg.bEnableProgressStall)
+		{
+			bool bWindowFull = false;
+			const float WindowProgressCm = UpdateProgressWindow(i, DeltaTime, bWindowFull);
+			bTerminal = RewardCfg.CheckProgressStall(WindowProgressCm, bWindowFull, EpisodeTime[i], TermReason);
+		}
+
+		if (bTerminal)
+		{
+			EpStats.TerminationReason = Reward.bDone ? Reward.DoneReason : TermReason;
+			Done[i] = 1;
+			return;
+		}
+
+		IntegrateCar(i, Actions[i], DeltaTime);
+		LastSteer[i] = Actions[i].Steer;
+	});
+
+	// 4. Finalize finished episodes (game thread, allocates)
+	int32 NumActive = 0;
+	for (int32 i = 0; i < NumCars; ++i)
+	{
+		if (Done[i] == 1)
+		{
+			FinalizeEpisode(i, Stats[i].TerminationReason);
+
+			if (Config.bAutoReset && !bRunningEpisodes)
+			{
+				CompletedEpisodes.Add(Stats[i]);
+				ResetCar(i);
+			}
+		}
+
+		NumActive += Done[i] ? 0 : 1;
+	}
+
+	SimulatedCarSeconds += static_cast<double>(DeltaTime) * NumActive;
+}
+
+TArray<FEpisodeStats> URacingBatchSimulator::RunEpisodes(int32 MaxSteps)
+{
+	if (NumCars <= 0 && !Initialize())
+	{
+		return {};
+	}
+
+	TGuardValue<bool> RunningGuard(bRunningEpisodes, true);
+
+	ResetAllCars();
+
+	const float Dt = FMath::Max(Config.FixedDeltaSeconds, 0.001f);
+	const double StartWall = FPlatformTime::Seconds();
+	const double StartSim = SimulatedCarSeconds;
+
+	for (int32 StepIdx = 0; StepIdx < MaxSteps; ++StepIdx)
+	{
+		Step(Dt);
+
+		if (!Done.Contains(0))
+		{
+			break;
+		}
+	}
+
+	for (int32 i = 0; i < NumCars; ++i)
+	{
+		if (!Done[i])
+		{
+			FinalizeEpisode(i, TEXT("MaxSteps"));
+		}
+	}
+
+	const double WallSeconds = FPlatformTime::Seconds() - StartWall;
+	UE_LOG(LogTemp, Log, TEXT("[RacingBatchSimulator] %d episodes in %.2f s wall (%.0f car-seconds simulated, %.0fx realtime)"),
+		NumCars, WallSeconds, SimulatedCarSeconds - StartSim,
+		WallSeconds > 0.0 ? (SimulatedCarSeconds - StartSim) / WallSeconds : 0.0);
+
+	return Stats;
+}
+
+void URacingBatchSimulator::FinalizeEpisode(int32 i, const FString& Reason)
+{
+	FEpisodeStats& EpStats = Stats[i];
+	EpStats.EndTime = FDateTime::Now();
+	EpStats.TerminationReason = Reason;
+
+	if (EpStats.StepCount > 0)
+	{
+		EpStats.AvgSpeed = EpStats.DistanceTraveledCm / EpStats.DurationSeconds;
+	}
+
+	EpStats.CalculateNEATFitness();
+	Done[i] = 2;
+}
+
+// ============================================================================
+// Track Sampling
+// ============================================================================
+
+float URacingBatchSimulator::WrapDistance(float InS) const
+{
+	if (Track.bClosedLoop)
+	{
+		const float Wrapped = FMath::Fmod(InS, Track.LengthCm);
+		return Wrapped < 0.f ? Wrapped + Track.LengthCm : Wrapped;
+	}
+
+	// Open tracks keep the raw distance; SampleTrack reports no surface past the ends
+	return InS;
+}
+
+URacingBatchSimulator::FTrackSample URacingBatchSimulator::SampleTrack(float InS) const
+{
+	FTrackSample Out;
+
+	const int32 N = Track.Num();
+	bool bOutOfRange = false;
+
+	float Sx = InS;
+	if (Track.bClosedLoop)
+	{
+		Sx = WrapDistance(InS);
+	}
+	else if (Sx < 0.f || Sx > Track.LengthCm)
+	{
+		bOutOfRange = true;
+		Sx = FMath::Clamp(Sx, 0.f, Track.LengthCm);
+	}
+
+	FVector Position, Tangent, Right, Up;
+	Track.Frames->SampleFrame(Sx, Position, Tangent, Right, Up);
+
+	Out.Position = FVector3f(Position);
+	Out.Tangent = FVector3f(Tangent);
+	Out.Right = FVector3f(Right);
+	Out.Up = FVector3f(Up);
+
+	// Simulator extras share the table's sample step
+	const float F = Sx / Track.StepCm;
+	const int32 K0 = FMath::Clamp(FMath::FloorToInt(F), 0, N - 1);
+	const int32 K1 = Track.bClosedLoop ? (K0 + 1) % N : FMath::Min(K0 + 1, N - 1);
+	const float A = FMath::Clamp(F - K0, 0.f, 1.f);
+
+	Out.CurvatureLateral = FMath::Lerp(Track.CurvatureLateral[K0], Track.CurvatureLateral[K1], A);
+	Out.CurvatureVertical = FMath::Lerp(Track.CurvatureVertical[K0], Track.CurvatureVertical[K1], A);
+	Out.SurfaceOffset = FMath::Lerp(Track.SurfaceOffset[K0], Track.SurfaceOffset[K1], A);
+	Out.bHasSurface = !bOutOfRange && Track.HasSurface[A < 0.5f ? K0 : K1] != 0;
+
+	return Out;
+}
+
+FVector URacingBatchSimulator::GetCarLocation(int32 i) const
+{
+	const FTrackSample Tr = SampleTrack(S[i]);
+	return FVector(Tr.Position + Tr.Right * D[i] + Tr.Up * (Tr.SurfaceOffset + H[i]));
+}
+
+// ============================================================================
+// Sensors
+// ============================================================================
+
+void URacingBatchSimulator::BuildObservation(int32 i, FRacingObservation& Obs) const
+{
+	const FTrackSample Tr = SampleTrack(S[i]);
+
+	const float CosPsi = FMath::Cos(Psi[i]);
+	const float SinPsi = FMath::Sin(Psi[i]);
+	const FVector3f Forward = Tr.Tangent * CosPsi + Tr.Right * SinPsi;
+	const FVector3f Right = Tr.Right * CosPsi - Tr.Tangent * SinPsi;
+	const FVector3f Up = Tr.Up;
+
+	// ===== Vehicle State =====
+
+	const float Speed = FMath::Sqrt(U[i] * U[i] + V[i] * V[i] + W[i] * W[i]);
+	Obs.SpeedNorm = Speed / Config.SpeedNormCmPerSec;
+
+	// World angular velocity: yaw about the surface normal, pitch from following the surface
+	const float SDot = (U[i] * CosPsi - V[i] * SinPsi) / FMath::Max(RacingBatchSim::MinPathScale, 1.f - D[i] * Tr.CurvatureLateral);
+	const FVector3f AngVelRad = Up * YawRate[i] - Right * (Tr.CurvatureVertical * SDot * (Grounded[i] ? 1.f : 0.f));
+	const FVector3f AngVelDeg = AngVelRad * (180.f / PI);
+
+	Obs.YawRateNorm = AngVelDeg.Z / Config.AngVelNormDegPerSec;
+	Obs.PitchRateNorm = AngVelDeg.Y / Config.AngVelNormDegPerSec;
+	Obs.RollRateNorm = AngVelDeg.X / Config.AngVelNormDegPerSec;
+
+	// ===== 5 Horizontal Rays + 2 Fixed Pitch Rays =====
+
+	const float RayMax = Config.RayMaxDistanceCm;
+	Obs.RayForward = MarchRay(i, 0.f, 0.f, RayMax);
+	Obs.RayLeft = MarchRay(i, -HALF_PI, 0.f, RayMax);
+	Obs.RayRight = MarchRay(i, HALF_PI, 0.f, RayMax);
+	Obs.RayLeft45 = MarchRay(i, -HALF_PI * 0.5f, 0.f, RayMax);
+	Obs.RayRight45 = MarchRay(i, HALF_PI * 0.5f, 0.f, RayMax);
+	Obs.RayForwardUp = MarchRay(i, 0.f, FMath::DegreesToRadians(30.f), RayMax);
+	Obs.RayForwardDown = MarchRay(i, 0.f, FMath::DegreesToRadians(-30.f), RayMax);
+
+	// ===== Ground Distance Ray (world down, like the agent) =====
+
+	const bool bSurfaceBelow = Tr.bHasSurface && FMath::Abs(D[i]) <= Config.TrackHalfWidthCm;
+	Obs.RayGroundDist = 0.f; // No ground = danger!
+	if (bSurfaceBelow && Up.Z > KINDA_SMALL_NUMBER && H[i] >= 0.f)
+	{
+		const float GroundDist = H[i] / Up.Z;
+		if (GroundDist <= Config.GroundRayMaxDistanceCm)
+		{
+			Obs.RayGroundDist = FMath::Clamp(GroundDist / Config.GroundRayMaxDistanceCm, 0.f, 1.f);
+		}
+	}
+
+	// ===== IMU Sensor - Gravity Direction (vehicle-local) =====
+
+	if (Config.bEnableIMUSensor)
+	{
+		Obs.GravityX = -Forward.Z;
+		Obs.GravityY = -Right.Z;
+		Obs.GravityZ = -Up.Z;
+	}
+	else
+	{
+		Obs.GravityX = 0.f;
+		Obs.GravityY = 0.f;
+		Obs.GravityZ = -1.f;
+	}
+
+	// ===== Optional LIDAR Ring =====
+
+	if (Config.bEnableLidar)
+	{
+		const int32 NumRays = FMath::Max(4, Config.LidarNumRays);
+		Obs.LidarRays.SetNumUninitialized(NumRays);
+
+		const float StepRad = 2.f * PI / NumRays;
+		for (int32 r = 0; r < NumRays; ++r)
+		{
+			Obs.LidarRays[r] = MarchRay(i, StepRad * r, 0.f, Config.LidarMaxDistanceCm);
+		}
+	}
+	else
+	{
+		Obs.LidarRays.Reset();
+	}
+
+	Obs.BuildVector();
+}
+
+float URacingBatchSimulator::MarchRay(int32 i, float YawOffsetRad, float PitchRad, float MaxDistanceCm) const
+{
+	const int32 NumSteps = FMath::Max(4, Config.RayMarchSteps);
+	const float HalfWidth = Config.TrackHalfWidthCm;
+
+	// Ray state in track space
+	float Sr = S[i];
+	float Dr = D[i];
+	float Heading = Psi[i] + YawOffsetRad;      // relative to local track tangent
+	float SurfacePitch = 0.f;                    // surface pitch relative to the car's surface plane
+	float Height = H[i] + Config.RayHeightOffsetCm;
+
+	const float SinPitch = FMath::Sin(PitchRad);
+	const float CosPitch = FMath::Cos(PitchRad);
+
+	auto Advance = [&](float Len)
+	{
+		const FTrackSample Tr = SampleTrack(Sr);
+		const float Along = Len * CosPitch;
+		const float AlongTrack = Along * FMath::Cos(Heading);
+
+		Sr += AlongTrack / FMath::Max(RacingBatchSim::MinPathScale, 1.f - Dr * Tr.CurvatureLateral);
+		Dr += Along * FMath::Sin(Heading);
+		Heading -= Tr.CurvatureLateral * AlongTrack;
+		SurfacePitch += Tr.CurvatureVertical * AlongTrack;
+		Height += Len * SinPitch - Along * FMath::Sin(SurfacePitch);
+
+		return Tr.bHasSurface;
+	};
+
+	// Trace starts RayStartOffsetCm in front of the origin (as on the agent)
+	Advance(Config.RayStartOffsetCm);
+
+	const float StepLen = MaxDistanceCm / NumSteps;
+	for (int32 n = 1; n <= NumSteps; ++n)
+	{
+		const bool bHasSurface = Advance(StepLen);
+		const bool bOnTrack = FMath::Abs(Dr) <= HalfWidth;
+
+		if (!bOnTrack)
+		{
+			if (Config.bTrackHasWalls)
+			{
+				return FMath::Clamp((n * StepLen) / MaxDistanceCm, 0.f, 1.f);
+			}
+
+			// Left the track over an edge: nothing left to hit
+			return 1.f;
+		}
+
+		if (bHasSurface && Height <= 0.f)
+		{
+			return FMath::Clamp((n * StepLen) / MaxDistanceCm, 0.f, 1.f);
+		}
+	}
+
+	return 1.f;
+}
+
+// ============================================================================
+// Vehicle Dynamics
+// ============================================================================
+
+void URacingBatchSimulator::IntegrateCar(int32 i, const FVehicleAction& Action, float Dt)
+{
+	const FRacingBatchSimVehicleParams& P = Config.Vehicle;
+	const FTrackSample Tr = SampleTrack(S[i]);
+
+	const float CosPsi = FMath::Cos(Psi[i]);
+	const float SinPsi = FMath::Sin(Psi[i]);
+
+	// ===== Gravity in track / vehicle frame =====
+
+	const float GT = -RacingBatchSim::Gravity * Tr.Tangent.Z;
+	const float GR = -RacingBatchSim::Gravity * Tr.Right.Z;
+	const float GN = -RacingBatchSim::Gravity * Tr.Up.Z;
+	const float GX = GT * CosPsi + GR * SinPsi;
+	const float GY = GR * CosPsi - GT * SinPsi;
+
+	const float VTrack = U[i] * CosPsi - V[i] * SinPsi;
+
+	// ===== Suspension / Normal Load =====
+
+	const bool bSurfaceBelow = Tr.bHasSurface && FMath::Abs(D[i]) <= Config.TrackHalfWidthCm;
+	const bool bContact = bSurfaceBelow && H[i] <= P.RideHeightCm + P.SuspensionTravelCm;
+
+	float NormalAccel = 0.f;
+	if (bContact)
+	{
+		const float Compression = P.RideHeightCm - H[i];
+		NormalAccel = FMath::Max(0.f, P.SuspensionStiffness * Compression - P.SuspensionDamping * W[i]);
+	}
+
+	// Following a curved surface needs VTrack^2 * curvature towards Up (loops press the car in)
+	const float WDot = GN + NormalAccel - VTrack * VTrack * Tr.CurvatureVertical;
+	W[i] += WDot * Dt;
+	H[i] += W[i] * Dt;
+
+	if (bSurfaceBelow && H[i] < 0.f)
+	{
+		H[i] = 0.f;
+		W[i] = FMath::Max(W[i], 0.f);
+	}
+
+	const bool bGrounded = bContact && NormalAccel > 0.f;
+	Grounded[i] = bGrounded ? 1 : 0;
+
+	// ===== Tires (dynamic bicycle model) =====
+
+	const float Steer = Action.Steer * FMath::DegreesToRadians(P.MaxSteerDeg);
+	const float A = P.FrontAxleCm;
+	const float B = P.RearAxleCm;
+	const float L = FMath::Max(A + B, 1.f);
+
+	float AxDrive = 0.f;
+	float AyFront = 0.f;
+	float AyRear = 0.f;
+
+	if (bGrounded)
+	{
+		const float USign = U[i] >= 0.f ? 1.f : -1.f;
+		const float USlip = FMath::Max(FMath::Abs(U[i]), RacingBatchSim::MinSlipSpeed);
+
+		const float SlipFront = Steer - FMath::Atan2(V[i] + A * YawRate[i], USlip);
+		const float SlipRear = -FMath::Atan2(V[i] - B * YawRate[i], USlip);
+
+		const float LoadFront = NormalAccel * B / L;
+		const float LoadRear = NormalAccel * A / L;
+		const float GripTotal = P.TireFriction * NormalAccel;
+
+		AxDrive = Action.Throttle * P.MaxDriveAccel - Action.Brake * P.MaxBrakeDecel * USign;
+		AxDrive = FMath::Clamp(AxDrive, -GripTotal, GripTotal);
+
+		// Friction circle: longitudinal use reduces lateral grip
+		const float LongUse = GripTotal > KINDA_SMALL_NUMBER ? AxDrive / GripTotal : 1.f;
+		const float LatScale = FMath::Sqrt(FMath::Max(0.f, 1.f - LongUse * LongUse));
+
+		const float MaxFront = P.TireFriction * LoadFront;
+		const float MaxRear = P.TireFriction * LoadRear;
+		AyFront = FMath::Clamp(P.FrontCorneringStiffness * SlipFront * LoadFront, -MaxFront, MaxFront) * LatScale;
+		AyRear = FMath::Clamp(P.RearCorneringStiffness * SlipRear * LoadRear, -MaxRear, MaxRear) * LatScale;
+	}
+
+	const float AxResist = -P.DragCoefficient * U[i] * FMath::Abs(U[i]) - (bGrounded ? P.RollingResistance * U[i] : 0.f);
+
+	const float CosSteer = FMath::Cos(Steer);
+	const float SinSteer = FMath::Sin(Steer);
+
+	const float UDot = AxDrive + AxResist - AyFront * SinSteer + V[i] * YawRate[i] + GX;
+	const float VDot = AyFront * CosSteer + AyRear - U[i] * YawRate[i] + GY;
+	const float RDot = bGrounded
+		? P.MassKg * (A * AyFront * CosSteer - B * AyRear) / FMath::Max(P.YawInertia, 1.f)
+		: -0.5f * YawRate[i]; // light air damping
+
+	const float UPrev = U[i];
+	U[i] += UDot * Dt;
+	V[i] += VDot * Dt;
+	YawRate[i] += RDot * Dt;
+
+	// Brakes stop the car, they don't reverse it
+	if (Action.Brake > 0.f && Action.Throttle <= 0.f && UPrev * U[i] < 0.f)
+	{
+		U[i] = 0.f;
+	}
+
+	// ===== Track-space kinematics =====
+
+	const float SDot = (U[i] * CosPsi - V[i] * SinPsi) / FMath::Max(RacingBatchSim::MinPathScale, 1.f - D[i] * Tr.CurvatureLateral);
+
+	S[i] = WrapDistance(S[i] + SDot * Dt);
+	TrackProgress[i] += SDot * Dt;
+	D[i] += (U[i] * SinPsi + V[i] * CosPsi) * Dt;
+	Psi[i] = FMath::UnwindRadians(Psi[i] + (YawRate[i] - Tr.CurvatureLateral * SDot) * Dt);
+}
+
+float URacingBatchSimulator::UpdateProgressWindow(int32 i, float Dt, bool& bOutWindowFull)
+{
+	// Ring of cumulative progress, one sample per window slice; oldest sample ~= window start
+	const int32 RingSize = RacingBatchSim::ProgressWindowSlices + 1;
+	float* Ring = ProgressWindowSamples.GetData() + i * RingSize;
+
+	const float SliceSeconds = Config.RewardCfg.ProgressWindowSeconds / RacingBatchSim::ProgressWindowSlices;
+	ProgressSampleAccum[i] += Dt;
+
+	if (ProgressWindowCount[i] == 0 || ProgressSampleAccum[i] >= SliceSeconds)
+	{
+		ProgressSampleAccum[i] = ProgressWindowCount[i] == 0 ? 0.f : FMath::Fmod(ProgressSampleAccum[i], SliceSeconds);
+
+		Ring[ProgressWindowHead[i]] = TrackProgress[i];
+		ProgressWindowHead[i] = (ProgressWindowHead[i] + 1) % RingSize;
+		ProgressWindowCount[i] = FMath::Min(ProgressWindowCount[i] + 1, RingSize);
+	}
+
+	bOutWindowFull = ProgressWindowCount[i] == RingSize;
+
+	const int32 OldestIndex = bOutWindowFull ? ProgressWindowHead[i] : 0;
+	return TrackProgress[i] - Ring[OldestIndex];
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+FEpisodeStats URacingBatchSimulator::GetEpisodeStats(int32 CarIndex) const
+{
+	return Stats.IsValidIndex(CarIndex) ? Stats[CarIndex] : FEpisodeStats();
+}
+
+FRacingObservation URacingBatchSimulator::GetObservation(int32 CarIndex) const
+{
+	return Observations.IsValidIndex(CarIndex) ? Observations[CarIndex] : FRacingObservation();
+}
+
+FTransform URacingBatchSimulator::GetCarTransform(int32 CarIndex) const
+{
+	if (!S.IsValidIndex(CarIndex))
+	{
+		return FTransform::Identity;
+	}
+
+	const FTrackSample Tr = SampleTrack(S[CarIndex]);
+	const float CosPsi = FMath::Cos(Psi[CarIndex]);
+	const float SinPsi = FMath::Sin(Psi[CarIndex]);
+	const FVector Forward = FVector(Tr.Tangent * CosPsi + Tr.Right * SinPsi);
+
+	return FTransform(FRotationMatrix::MakeFromXZ(Forward, FVector(Tr.Up)).ToQuat(), GetCarLocation(CarIndex));
+}
+
+TArray<FEpisodeStats> URacingBatchSimulator::ConsumeCompletedEpisodes()
+{
+	TArray<FEpisodeStats> Out = MoveTemp(CompletedEpisodes);
+	CompletedEpisodes.Reset();
+	return Out;
+}
@@ -0,0 +1,271 @@
+#include "Track/RacingFailureHotspotSubsystem.h"
+
+#include "Components/SplineComponent.h"
+#include "Engine/World.h"
+
+// ============================================================================
+// Classification
+// ============================================================================
+
+ERacingFailureKind URacingFailureHotspotSubsystem::ClassifyTerminationReason(const FString& Reason)
+{
+	if (Reason == TEXT("Collision"))
+	{
+		return ERacingFailureKind::Crash;
+	}
+	if (Reason == TEXT("Fell off track") || Reason == TEXT("AirborneLong"))
+	{
+		return ERacingFailureKind::GapFall;
+	}
+	if (Reason == TEXT("Stuck") || Reason == TEXT("ProgressStall"))
+	{
+		return ERacingFailureKind::Stuck;
+	}
+	return ERacingFailureKind::None;
+}
+
+float URacingFailureHotspotSubsystem::GetKindWeight(ERacingFailureKind Kind) const
+{
+	switch (Kind)
+	{
+	case ERacingFailureKind::Crash:   return CrashWeight;
+	case ERacingFailureKind::GapFall: return GapFallWeight;
+	case ERacingFailureKind::Stuck:   return StuckWeight;
+	default:                          return 0.f;
+	}
+}
+
+// ============================================================================
+// Histogram
+// ============================================================================
+
+double URacingFailureHotspotSubsystem::GetNow() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+double URacingFailureHotspotSubsystem::GetDecayLambda() const
+{
+	return HalfLifeSeconds > 0.f ? UE_LN2 / HalfLifeSeconds : 0.0;
+}
+
+FRacingFailureHistogram* URacingFailureHotspotSubsystem::FindHistogram(const USplineComponent* Spline)
+{
+	return Histograms.FindByPredicate([Spline](const FRacingFailureHistogram& H) { return H.Spline.Get() == Spline; });
+}
+
+const FRacingFailureHistogram* URacingFailureHotspotSubsystem::FindHistogram(const USplineComponent* Spline) const
+{
+	return Histograms.FindByPredicate([Spline](const FRacingFailureHistogram& H) { return H.Spline.Get() == Spline; });
+}
+
+FRacingFailureHistogram& URacingFailureHotspotSubsystem::FindOrAddHistogram(USplineComponent* Spline)
+{
+	const float SplineLength = Spline->GetSplineLength();
+	const int32 NumBins = FMath::Max(1, FMath::CeilToInt(SplineLength / FMath::Max(50.f, BinSizeCm)));
+
+	FRacingFailureHistogram* Histogram = FindHistogram(Spline);
+	if (!Histogram)
+	{
+		Histograms.RemoveAll([](const FRacingFailureHistogram& H) { return !H.Spline.IsValid(); });
+		Histogram = &Histograms.AddDefaulted_GetRef();
+		Histogram->Spline = Spline;
+	}
+
+	// New or rebuilt track: start over
+	if (Histogram->Bins.Num() != NumBins)
+	{
+		Histogram->SplineLengthCm = SplineLength;
+		Histogram->bClosedLoop = Spline->IsClosedLoop();
+		Histogram->Bins.Init(0.f, NumBins);
+		Histogram->ScaleTime = GetNow();
+		Histogram->ScaledMass = 0.0;
+		Histogram->NumEvents = 0;
+		Histogram->AliasProb.Reset();
+		Histogram->AliasIndex.Reset();
+		Histogram->bAliasDirty = true;
+		Histogram->LastAliasBuildTime = -1.0;
+	}
+
+	return *Histogram;
+}
+
+void URacingFailureHotspotSubsystem::Renormalize(FRacingFailureHistogram& Histogram, double Now) const
+{
+	const float Factor = (float)FMath::Exp(-GetDecayLambda() * (Now - Histogram.ScaleTime));
+	for (float& Bin : Histogram.Bins)
+	{
+		Bin *= Factor;
+	}
+	Histogram.ScaledMass *= Factor;
+	Histogram.ScaleTime = Now;
+}
+
+void URacingFailureHotspotSubsystem::ReportFailure(USplineComponent* Spline, float DistanceCm, ERacingFailureKind Kind)
+{
+	const float KindWeight = GetKindWeight(Kind);
+	if (!Spline || KindWeight <= 0.f)
+	{
+		return;
+	}
+
+	FRacingFailureHistogram& Histogram = FindOrAddHistogram(Spline);
+	const double Now = GetNow();
+
+	// Newer events weigh exp(Lambda * dt) more instead of decaying every bin on every tick
+	double Exponent = GetDecayLambda() * (Now - Histogram.ScaleTime);
+	if (Exponent > 30.0)
+	{
+		Renormalize(Histogram, Now);
+		Exponent = 0.0;
+	}
+
+	const float Weight = KindWeight * (float)FMath::Exp(Exponent);
+
+	float S = DistanceCm;
+	if (Histogram.bClosedLoop && Histogram.SplineLengthCm > 0.f)
+	{
+		S = FMath::Fmod(S, Histogram.SplineLengthCm);
+		if (S < 0.f) S += Histogram.SplineLengthCm;
+	}
+
+	const int32 Bin = FMath::Clamp(FMath::FloorToInt(S / FMath::Max(50.f, BinSizeCm)), 0, Histogram.Bins.Num() - 1);
+	Histogram.Bins[Bin] += Weight;
+	Histogram.ScaledMass += Weight;
+	++Histogram.NumEvents;
+
+	// Relative bin weights only change with new events, decay alone never dirties the table
+	Histogram.bAliasDirty = true;
+}
+
+// ============================================================================
+// Sampling
+// ============================================================================
+
+void URacingFailureHotspotSubsystem::RebuildAliasTable(FRacingFailureHistogram& Histogram) const
+{
+	const int32 N = Histogram.Bins.Num();
+	Histogram.AliasProb.SetNumUninitialized(N);
+	Histogram.AliasIndex.SetNumUninitialized(N);
+	Histogram.bAliasDirty = false;
+	Histogram.LastAliasBuildTime = GetNow();
+
+	if (N == 0)
+	{
+		return;
+	}
+
+	// Uniform floor as a share of the total mass
+	const double Floor = (UniformFloor >= 1.f || Histogram.ScaledMass <= 0.0)
+		? 1.0
+		: (UniformFloor / (1.0 - UniformFloor)) * Histogram.ScaledMass / N;
+
+	double Sum = 0.0;
+	TArray<double> Scaled;
+	Scaled.SetNumUninitialized(N);
+	for (int32 i = 0; i < N; ++i)
+	{
+		Scaled[i] = (UniformFloor >= 1.f ? 0.0 : Histogram.Bins[i]) + Floor;
+		Sum += Scaled[i];
+	}
+
+	TArray<int32> Small;
+	TArray<int32> Large;
+	Small.Reserve(N);
+	Large.Reserve(N);
+
+	for (int32 i = 0; i < N; ++i)
+	{
+		Scaled[i] = Scaled[i] * N / Sum;
+		(Scaled[i] < 1.0 ? Small : Large).Add(i);
+	}
+
+	// Vose: pair each under-full bin with an over-full one
+	while (Small.Num() > 0 && Large.Num() > 0)
+	{
+		const int32 S = Small.Pop(EAllowShrinking::No);
+		const int32 L = Large.Pop(EAllowShrinking::No);
+
+		Histogram.AliasProb[S] = (float)Scaled[S];
+		Histogram.AliasIndex[S] = L;
+
+		Scaled[L] = (Scaled[L] + Scaled[S]) - 1.0;
+		(Scaled[L] < 1.0 ? Small : Large).Add(L);
+	}
+
+	for (int32 i : Large)
+	{
+		Histogram.AliasProb[i] = 1.f;
+		Histogram.AliasIndex[i] = i;
+	}
+	for (int32 i : Small)
+	{
+		Histogram.AliasProb[i] = 1.f;
+		Histogram.AliasIndex[i] = i;
+	}
+}
+
+bool URacingFailureHotspotSubsystem::SampleSpawnDistance(USplineComponent* Spline, FRandomStream& Rng, float& OutDistanceCm)
+{
+	FRacingFailureHistogram* Histogram = FindHistogram(Spline);
+	if (!Histogram || Histogram->NumEvents < MinEventsForSampling)
+	{
+		return false;
+	}
+
+	if (Histogram->bAliasDirty &&
+		(Histogram->LastAliasBuildTime < 0.0 || GetNow() - Histogram->LastAliasBuildTime >= AliasRebuildIntervalSeconds))
+	{
+		RebuildAliasTable(*Histogram);
+	}
+
+	const int32 N = Histogram->AliasProb.Num();
+	if (N == 0)
+	{
+		return false;
+	}
+
+	const int32 Column = Rng.RandHelper(N);
+	const int32 Bin = (Rng.GetFraction() < Histogram->AliasProb[Column]) ? Column : Histogram->AliasIndex[Column];
+
+	const float BinSize = FMath::Max(50.f, BinSizeCm);
+	OutDistanceCm = FMath::Min((Bin + Rng.GetFraction()) * BinSize, Histogram->SplineLengthCm);
+	return true;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+float URacingFailureHotspotSubsystem::GetFailureWeightAtDistance(USplineComponent* Spline, float DistanceCm) const
+{
+	const FRacingFailureHistogram* Histogram = FindHistogram(Spline);
+	if (!Histogram || Histogram->Bins.Num() == 0)
+	{
+		return 0.f;
+	}
+
+	const int32 Bin = FMath::Clamp(FMath::FloorToInt(DistanceCm / FMath::Max(50.f, BinSizeCm)), 0, Histogram->Bins.Num() - 1);
+	return Histogram->Bins[Bin] * (float)FMath::Exp(-GetDecayLambda() * (GetNow() - Histogram->ScaleTime));
+}
+
+TArray<float> URacingFailureHotspotSubsystem::GetDecayedHistogram(USplineComponent* Spline) const
+{
+	TArray<float> Result;
+	if (const FRacingFailureHistogram* Histogram = FindHistogram(Spline))
+	{
+		const float Factor = (float)FMath::Exp(-GetDecayLambda() * (GetNow() - Histogram->ScaleTime));
+		Result.Reserve(Histogram->Bins.Num());
+		for (float Bin : Histogram->Bins)
+		{
+			Result.Add(Bin * Factor);
+		}
+	}
+	return Result;
+}
+
+void URacingFailureHotspotSubsystem::ResetHotspots()
+{
+	Histograms.Reset();
+}
@@ -0,0 +1,165 @@
+#include "Track/RacingTrackInstance.h"
+#include "Data/RacingCurriculumDataAsset.h"
+
+#include "Components/SplineComponent.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerStart.h"
+#include "Interfaces/RoadSplineInterface.h"
+#include "Actors/NoSpawnZoneActor.h"
+
+ARacingTrackInstance::ARacingTrackInstance()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	USceneComponent* Root = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	RootComponent = Root;
+}
+
+void ARacingTrackInstance::BeginPlay()
+{
+	Super::BeginPlay();
+
+	ResolveReferences();
+
+	if (!GetTrackSpline())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[RacingTrackInstance] %s: no track spline found in level %s"),
+			*GetName(), *GetNameSafe(GetLevel()));
+	}
+}
+
+void ARacingTrackInstance::ResolveReferences()
+{
+	ULevel* Level = GetLevel();
+	if (!Level)
+	{
+		return;
+	}
+
+	const bool bCollectZones = NoSpawnZones.IsEmpty();
+
+	for (AActor* Actor : Level->Actors)
+	{
+		if (!IsValid(Actor) || Actor == this)
+		{
+			continue;
+		}
+
+		if (!TrackActor &&
+			(Actor->GetClass()->ImplementsInterface(URoadSplineInterface::StaticClass()) || Actor->ActorHasTag(FName("Track"))))
+		{
+			TrackActor = Actor;
+		}
+		else if (!PlayerStart && Actor->IsA<APlayerStart>())
+		{
+			PlayerStart = Cast<APlayerStart>(Actor);
+		}
+		else if (bCollectZones && Actor->IsA<ANoSpawnZoneActor>())
+		{
+			NoSpawnZones.Add(Cast<ANoSpawnZoneActor>(Actor));
+		}
+	}
+
+	// Level + actor name: unique per instance (several tracks may share a level), stable across loads
+	if (TrackId.IsNone())
+	{
+		TrackId = FName(*FString::Printf(TEXT("%s.%s"), *GetNameSafe(Level->GetOuter()), *GetName()));
+	}
+}
+
+USplineComponent* ARacingTrackInstance::GetTrackSpline() const
+{
+	if (!TrackActor)
+	{
+		return nullptr;
+	}
+
+	if (TrackActor->GetClass()->ImplementsInterface(URoadSplineInterface::StaticClass()))
+	{
+		if (USplineComponent* Spline = IRoadSplineInterface::Execute_GetRoadSpline(TrackActor))
+		{
+			return Spline;
+		}
+	}
+
+	TArray<USplineComponent*> Splines;
+	TrackActor->GetComponents<USplineComponent>(Splines);
+
+	for (USplineComponent* Spline : Splines)
+	{
+		if (Spline && Spline->ComponentHasTag(TrackSplineComponentTag))
+		{
+			return Spline;
+		}
+	}
+
+	return Splines.Num() > 0 ? Splines[0] : nullptr;
+}
+
+bool ARacingTrackInstance::IsInNoSpawnZone(const FVector& P) const
+{
+	for (const ANoSpawnZoneActor* Zone : NoSpawnZones)
+	{
+		if (IsValid(Zone) && Zone->ContainsPoint(P))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+TArray<ARacingTrackInstance*> ARacingTrackInstance::GetAllTrackInstances(const UWorld* World)
+{
+	TArray<ARacingTrackInstance*> Result;
+	if (!World)
+	{
+		return Result;
+	}
+
+	for (TActorIterator<ARacingTrackInstance> It(World); It; ++It)
+	{
+		if (IsValid(*It))
+		{
+			Result.Add(*It);
+		}
+	}
+
+	Result.Sort([](const ARacingTrackInstance& A, const ARacingTrackInstance& B)
+	{
+		if (A.TrackId != B.TrackId)
+		{
+			return A.TrackId.LexicalLess(B.TrackId);
+		}
+		return A.GetName() < B.GetName();
+	});
+
+	return Result;
+}
+
+ARacingTrackInstance* ARacingTrackInstance::FindClosestTrackInstance(const UWorld* World, const FVector& Location)
+{
+	ARacingTrackInstance* Best = nullptr;
+	double BestDistSq = TNumericLimits<double>::Max();
+
+	for (ARacingTrackInstance* Track : GetAllTrackInstances(World))
+	{
+		const USplineComponent* Spline = Track->GetTrackSpline();
+		if (!Spline)
+		{
+			continue;
+		}
+
+		const FVector Closest = Spline->FindLocationClosestToWorldLocation(Location, ESplineCoordinateSpace::World);
+		const double DistSq = FVector::DistSquared(Closest, Location);
+		if (DistSq < BestDistSq)
+		{
+			BestDistSq = DistSq;
+			Best = Track;
+		}
+	}
+
+	return Best;
+}
@@ -0,0 +1,525 @@
+#include "Worker/RacingTrainingWorkerSubsystem.h"
+#include "Components/RacingAgentComponent.h"
+#include "NN/SimpleNeuralNetwork.h"
+#include "Pool/RacingVehiclePoolSubsystem.h"
+
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerStart.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+bool URacingTrainingWorkerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	FString Address;
+	return Super::ShouldCreateSubsystem(Outer) && FParse::Value(FCommandLine::Get(), TEXT("CarAIWorker="), Address);
+}
+
+bool URacingTrainingWorkerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game;
+}
+
+void URacingTrainingWorkerSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	const TCHAR* CmdLine = FCommandLine::Get();
+	FParse::Value(CmdLine, TEXT("CarAIWorker="), CoordinatorAddress);
+	FParse::Value(CmdLine, TEXT("CarAIWorkerId="), WorkerId);
+	FParse::Value(CmdLine, TEXT("CarAISeed="), BaseSeed);
+	FParse::Value(CmdLine, TEXT("CarAIAgents="), MaxAgents);
+	FParse::Value(CmdLine, TEXT("CarAIVehicleClass="), VehicleClassPath);
+
+	SpawnAgentSlice();
+	CollectAgents();
+
+	if (!Connect(CoordinatorAddress))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RacingTrainingWorker] Could not connect to coordinator %s"), *CoordinatorAddress);
+
+		if (bExitOnDisconnect)
+		{
+			FPlatformMisc::RequestExit(false, TEXT("RacingTrainingWorker"));
+		}
+	}
+}
+
+void URacingTrainingWorkerSubsystem::Deinitialize()
+{
+	Disconnect();
+
+	Agents.Empty();
+	AgentJobs.Empty();
+	PendingJobs.Empty();
+	PolicyCache.Empty();
+	SpawnedVehicles.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId URacingTrainingWorkerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URacingTrainingWorkerSubsystem, STATGROUP_Tickables);
+}
+
+void URacingTrainingWorkerSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!Socket)
+	{
+		return;
+	}
+
+	ReceiveMessages();
+	if (!Socket)
+	{
+		return;
+	}
+
+	// Vehicles spawned after BeginPlay (e.g. by a spawner) join late
+	if (Agents.Num() == 0)
+	{
+		CollectAgents();
+	}
+
+	if (!bHelloSent && Agents.Num() > 0)
+	{
+		TSharedRef<FJsonObject> Hello = MakeShared<FJsonObject>();
+		Hello->SetStringField(TEXT("type"), TEXT("hello"));
+		Hello->SetNumberField(TEXT("worker_id"), WorkerId);
+		Hello->SetNumberField(TEXT("slots"), Agents.Num());
+		Hello->SetNumberField(TEXT("seed"), BaseSeed);
+		Hello->SetStringField(TEXT("map"), GetWorld() ? GetWorld()->GetMapName() : FString());
+
+		bHelloSent = SendMessage(Hello);
+	}
+
+	UpdateAgents(DeltaTime);
+	DispatchJobs();
+}
+
+int32 URacingTrainingWorkerSubsystem::GetNumBusyAgents() const
+{
+	int32 Busy = 0;
+	for (const FRacingWorkerJob& Job : AgentJobs)
+	{
+		Busy += Job.IsValid() ? 1 : 0;
+	}
+	return Busy;
+}
+
+// ============================================================================
+// Connection
+// ============================================================================
+
+bool URacingTrainingWorkerSubsystem::Connect(const FString& Address)
+{
+	FIPv4Endpoint Endpoint;
+	if (!FIPv4Endpoint::FromHostAndPort(Address, Endpoint))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RacingTrainingWorker] Invalid coordinator address '%s' (expected host:port)"), *Address);
+		return false;
+	}
+
+	Socket = FTcpSocketBuilder(TEXT("CarAITrainingWorker")).AsBlocking().Build();
+	if (!Socket)
+	{
+		return false;
+	}
+
+	if (!Socket->Connect(*Endpoint.ToInternetAddr()))
+	{
+		Disconnect();
+		return false;
+	}
+
+	Socket->SetNonBlocking(true);
+	Socket->SetNoDelay(true);
+
+	UE_LOG(LogTemp, Log, TEXT("[RacingTrainingWorker] Worker %d connected to %s (%d agents, seed %d)"),
+		WorkerId, *Endpoint.ToString(), Agents.Num(), BaseSeed);
+
+	return true;
+}
+
+void URacingTrainingWorkerSubsystem::Disconnect()
+{
+	if (Socket)
+	{
+		Socket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+		Socket = nullptr;
+	}
+
+	ReceiveBuffer.Reset();
+	bHelloSent = false;
+}
+
+// ============================================================================
+// Agents
+// ============================================================================
+
+void URacingTrainingWorkerSubsystem::SpawnAgentSlice()
+{
+	UWorld* World = GetWorld();
+	if (!World || VehicleClassPath.IsEmpty() || MaxAgents <= 0)
+	{
+		return;
+	}
+
+	UClass* VehicleClass = LoadClass<APawn>(nullptr, *VehicleClassPath);
+	URacingVehiclePoolSubsystem* Pool = World->GetSubsystem<URacingVehiclePoolSubsystem>();
+	if (!VehicleClass || !Pool)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RacingTrainingWorker] Cannot spawn vehicles of class '%s'"), *VehicleClassPath);
+		return;
+	}
+
+	// Agents move themselves to the Player Start on ResetEpisode; spawn there so the first reset is short
+	FTransform SpawnTransform = FTransform::Identity;
+	for (TActorIterator<APlayerStart> It(World); It; ++It)
+	{
+		SpawnTransform = It->GetActorTransform();
+		break;
+	}
+
+	Pool->Prewarm(VehicleClass, MaxAgents);
+
+	for (int32 i = 0; i < MaxAgents; ++i)
+	{
+		if (APawn* Pawn = Pool->AcquireVehicle(VehicleClass, SpawnTransform))
+		{
+			SpawnedVehicles.Add(Pawn);
+		}
+	}
+}
+
+void URacingTrainingWorkerSubsystem::CollectAgents()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	Agents.Reset();
+
+	for (TActorIterator<APawn> It(World); It; ++It)
+	{
+		URacingAgentComponent* Agent = It->FindComponentByClass<URacingAgentComponent>();
+		if (!Agent)
+		{
+			continue;
+		}
+
+		Agent->bDeterministicSeeding = true;
+		Agent->DeterministicBaseSeed = BaseSeed;
+		Agent->EpisodeTimeLimitSeconds = MaxEpisodeSeconds;
+		Agent->GenomeID = -1;
+		Agent->ParkAgent();
+
+		Agents.Add(Agent);
+
+		if (MaxAgents > 0 && Agents.Num() >= MaxAgents)
+		{
+			break;
+		}
+	}
+
+	AgentJobs.SetNum(Agents.Num());
+}
+
+void URacingTrainingWorkerSubsystem::UpdateAgents(float DeltaTime)
+{
+	for (int32 i = 0; i < Agents.Num(); ++i)
+	{
+		if (!AgentJobs[i].IsValid())
+		{
+			continue;
+		}
+
+		URacingAgentComponent* Agent = Agents[i].Get();
+		if (!Agent)
+		{
+			// Vehicle went away mid-episode: give the job to another agent
+			PendingJobs.Insert(AgentJobs[i], 0);
+			AgentJobs[i] = FRacingWorkerJob();
+			continue;
+		}
+
+		if (bStepAgents && !Agent->IsDone())
+		{
+			Agent->StepOnce(DeltaTime);
+		}
+
+		if (Agent->IsDone())
+		{
+			FinishJob(i, Agent->GetEpisodeStats());
+			continue;
+		}
+
+		if (MaxEpisodeSeconds > 0.f && Agent->GetEpisodeStats().DurationSeconds >= MaxEpisodeSeconds)
+		{
+			FEpisodeStats Stats = Agent->GetEpisodeStats();
+			Stats.TerminationReason = TEXT("Timeout");
+			Stats.CalculateNEATFitness();
+
+			Agent->ParkAgent();
+			FinishJob(i, Stats);
+		}
+	}
+}
+
+void URacingTrainingWorkerSubsystem::DispatchJobs()
+{
+	for (int32 i = 0; i < Agents.Num() && PendingJobs.Num() > 0; ++i)
+	{
+		if (AgentJobs[i].IsValid() || !Agents[i].IsValid())
+		{
+			continue;
+		}
+
+		const FRacingWorkerJob Job = PendingJobs[0];
+		PendingJobs.RemoveAt(0, EAllowShrinking::No);
+
+		StartJob(i, Job);
+	}
+}
+
+void URacingTrainingWorkerSubsystem::StartJob(int32 AgentIndex, const FRacingWorkerJob& Job)
+{
+	URacingAgentComponent* Agent = Agents[AgentIndex].Get();
+	if (!Agent)
+	{
+		return;
+	}
+
+	Agent->GenomeID = Job.GenomeID;
+	Agent->Generation = Job.Generation;
+	Agent->EpisodeIndex = 0;
+	Agent->FitnessCutoff = FitnessCutoff;
+
+	if (!Job.PolicyFile.IsEmpty())
+	{
+		if (USimpleNeuralNetwork* Policy = LoadPolicy(Job.PolicyFile))
+		{
+			Agent->SetNeuralNetwork(Policy);
+		}
+	}
+
+	AgentJobs[AgentIndex] = Job;
+	Agent->ResetEpisode();
+}
+
+void URacingTrainingWorkerSubsystem::FinishJob(int32 AgentIndex, const FEpisodeStats& Stats)
+{
+	const FRacingWorkerJob Job = AgentJobs[AgentIndex];
+	AgentJobs[AgentIndex] = FRacingWorkerJob();
+
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("type"), TEXT("result"));
+	Result->SetNumberField(TEXT("worker_id"), WorkerId);
+	Result->SetNumberField(TEXT("job_id"), Job.JobID);
+	Result->SetNumberField(TEXT("genome_id"), Job.GenomeID);
+	Result->SetNumberField(TEXT("generation"), Job.Generation);
+	Result->SetNumberField(TEXT("fitness"), Stats.NEATFitness);
+	Result->SetStringField(TEXT("reason"), Stats.TerminationReason);
+	Result->SetNumberField(TEXT("total_reward"), Stats.TotalReward);
+	Result->SetNumberField(TEXT("steps"), Stats.StepCount);
+	Result->SetNumberField(TEXT("duration_s"), Stats.DurationSeconds);
+	Result->SetNumberField(TEXT("distance_cm"), Stats.DistanceTraveledCm);
+	Result->SetNumberField(TEXT("avg_speed"), Stats.AvgSpeed);
+	Result->SetNumberField(TEXT("max_speed"), Stats.MaxSpeed);
+	Result->SetNumberField(TEXT("episode_seed"), Stats.EpisodeSeed);
+
+	SendMessage(Result);
+}
+
+USimpleNeuralNetwork* URacingTrainingWorkerSubsystem::LoadPolicy(const FString& PolicyFile)
+{
+	if (TObjectPtr<USimpleNeuralNetwork>* Cached = PolicyCache.Find(PolicyFile))
+	{
+		return *Cached;
+	}
+
+	USimpleNeuralNetwork* Policy = NewObject<USimpleNeuralNetwork>(this);
+	if (!Policy->LoadFromFile(PolicyFile))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RacingTrainingWorker] Failed to load policy %s"), *PolicyFile);
+		return nullptr;
+	}
+
+	PolicyCache.Add(PolicyFile, Policy);
+	return Policy;
+}
+
+// ============================================================================
+// Messages
+// ============================================================================
+
+void URacingTrainingWorkerSubsystem::ReceiveMessages()
+{
+	// Stream sockets: Recv fails with 0 bytes on a clean close, succeeds with 0 bytes on would-block
+	bool bPeerClosed = false;
+
+	uint32 PendingSize = 0;
+	while (Socket && Socket->HasPendingData(PendingSize))
+	{
+		const int32 Offset = ReceiveBuffer.Num();
+		ReceiveBuffer.AddUninitialized(FMath::Min(PendingSize, 65536u));
+
+		int32 BytesRead = 0;
+		if (!Socket->Recv(ReceiveBuffer.GetData() + Offset, ReceiveBuffer.Num() - Offset, BytesRead))
+		{
+			ReceiveBuffer.SetNum(Offset);
+			bPeerClosed = true;
+			break;
+		}
+		if (BytesRead <= 0)
+		{
+			ReceiveBuffer.SetNum(Offset);
+			break;
+		}
+
+		ReceiveBuffer.SetNum(Offset + BytesRead, EAllowShrinking::No);
+	}
+
+	// A closed connection is readable without pending data: peek to tell it from a spurious wakeup
+	if (Socket && !bPeerClosed && Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::Zero()) && !Socket->HasPendingData(PendingSize))
+	{
+		uint8 Probe = 0;
+		int32 ProbeRead = 0;
+		bPeerClosed = !Socket->Recv(&Probe, 1, ProbeRead, ESocketReceiveFlags::Peek);
+	}
+
+	const bool bConnectionLost = bPeerClosed || (Socket && Socket->GetConnectionState() == SCS_ConnectionError);
+
+	// One JSON object per line (lines sent before a close are still handled)
+	int32 LineStart = 0;
+	for (int32 i = 0; i < ReceiveBuffer.Num(); ++i)
+	{
+		if (ReceiveBuffer[i] != '\n')
+		{
+			continue;
+		}
+
+		const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(ReceiveBuffer.GetData() + LineStart), i - LineStart);
+		const FString Line(Converted.Length(), Converted.Get());
+		LineStart = i + 1;
+
+		TSharedPtr<FJsonObject> Message;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Line);
+		if (FJsonSerializer::Deserialize(Reader, Message) && Message.IsValid())
+		{
+			HandleMessage(Message);
+		}
+		else if (!Line.TrimStartAndEnd().IsEmpty())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[RacingTrainingWorker] Invalid message: %s"), *Line.Left(200));
+		}
+
+		if (!Socket)
+		{
+			return;
+		}
+	}
+
+	ReceiveBuffer.RemoveAt(0, LineStart, EAllowShrinking::No);
+
+	if (bConnectionLost && Socket)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[RacingTrainingWorker] Coordinator %s"), bPeerClosed ? TEXT("closed the connection") : TEXT("connection lost"));
+		Disconnect();
+
+		if (bExitOnDisconnect)
+		{
+			FPlatformMisc::RequestExit(false, TEXT("RacingTrainingWorker"));
+		}
+	}
+}
+
+void URacingTrainingWorkerSubsystem::HandleMessage(const TSharedPtr<FJsonObject>& Message)
+{
+	const FString Type = Message->GetStringField(TEXT("type"));
+
+	if (Type == TEXT("job"))
+	{
+		FRacingWorkerJob Job;
+		Job.JobID = Message->GetIntegerField(TEXT("job_id"));
+		Job.GenomeID = Message->GetIntegerField(TEXT("genome_id"));
+		Message->TryGetNumberField(TEXT("generation"), Job.Generation);
+		Message->TryGetStringField(TEXT("policy_file"), Job.PolicyFile);
+
+		PendingJobs.Add(Job);
+	}
+	else if (Type == TEXT("cutoff"))
+	{
+		// Fitness ceiling of the current generation (see URacingAgentComponent::FitnessCutoff)
+		FitnessCutoff = static_cast<float>(Message->GetNumberField(TEXT("fitness")));
+
+		for (TWeakObjectPtr<URacingAgentComponent>& WeakAgent : Agents)
+		{
+			if (URacingAgentComponent* Agent = WeakAgent.Get())
+			{
+				Agent->FitnessCutoff = FitnessCutoff;
+			}
+		}
+	}
+	else if (Type == TEXT("shutdown"))
+	{
+		UE_LOG(LogTemp, Log, TEXT("[RacingTrainingWorker] Shutdown requested by coordinator"));
+		Disconnect();
+		FPlatformMisc::RequestExit(false, TEXT("RacingTrainingWorker"));
+	}
+}
+
+bool URacingTrainingWorkerSubsystem::SendMessage(const TSharedRef<FJsonObject>& Message)
+{
+	if (!Socket)
+	{
+		return false;
+	}
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	FJsonSerializer::Serialize(Message, Writer);
+	JsonString.AppendChar(TEXT('\n'));
+
+	const FTCHARToUTF8 Utf8(*JsonString);
+	const uint8* Data = reinterpret_cast<const uint8*>(Utf8.Get());
+	int32 Remaining = Utf8.Length();
+
+	// Messages are small; spin on a full send buffer rather than queueing
+	while (Remaining > 0)
+	{
+		int32 BytesSent = 0;
+		if (!Socket->Send(Data, Remaining, BytesSent))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[RacingTrainingWorker] Send failed"));
+			return false;
+		}
+
+		Data += BytesSent;
+		Remaining -= BytesSent;
+	}
+
+	return true;
+}
@@ -8,6 +8,7 @@
 #include "RacingCurriculumBuilder.generated.h"
 
 class UTrackFrameProviderComponent;
+class FTrackFrameTable;
 
 UCLASS()
 class CARAIRUNTIME_API URacingCurriculumBuilder : public UBlueprintFunctionLibrary
@@ -15,6 +16,12 @@ class CARAIRUNTIME_API URacingCurriculumBuilder : public UBlueprintFunctionLibra
 	GENERATED_BODY()
 
 public:
+	/**
+	 * Segment the provider's track into tagged curriculum segments.
+	 * Samples read the track's baked FTrackFrameTable (built on the game thread if the track
+	 * doesn't bake one) and are evaluated with ParallelFor
+	 * (NoSpawnZones via the UNoSpawnZoneSubsystem distance index).
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Curriculum")
 	static bool BuildFromTrackProvider(
 		UTrackFrameProviderComponent* TrackProvider,
@@ -26,21 +33,11 @@ public:
 private:
 	static float WrapDistance(float S, float LengthCm, bool bLooped);
 
-	static float ComputeCurvatureInvCm(
-		UTrackFrameProviderComponent* TrackProvider,
-		float DistanceCm,
-		float WindowCm,
-		bool bLooped,
-		float SplineLengthCm,
-		FVector& InOutForward
-	);
-
 	static int32 BuildTagMask(
-		UTrackFrameProviderComponent* TrackProvider,
+		const FTrackFrameTable& Track,
 		float S,
 		float SplineLengthCm,
 		const FRacingCurriculumBuildSettings& Settings,
-		FVector& InOutForward,
 		float& OutCurvNormAbs,
 		float& OutSlopeZ,
 		bool& bOutRampApproach,
@@ -8,6 +8,9 @@
 class USplineComponent;
 class APlayerStart;
 class USimpleNeuralNetwork;
+class UChaosWheeledVehicleMovementComponent;
+class UTrackFrameProviderComponent;
+class ARacingTrackInstance;
 
 /**
  * Racing AI Agent with Adaptive Ray-based Vision and NEAT Evolution.
@@ -45,9 +48,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Racing Agent")
 	void StepOnce(float DeltaTime);
 
+	/** End the current episode without reporting it (no OnEpisodeDone) and hold the vehicle on the brakes */
+	UFUNCTION(BlueprintCallable, Category = "Racing Agent")
+	void ParkAgent();
+
 	UFUNCTION(BlueprintCallable, Category = "Racing Agent")
 	void SetNeuralNetwork(USimpleNeuralNetwork* Network);
 
+	/** Put the vehicle on TrainingAgentChannel so agents don't collide with (or see) each other */
+	UFUNCTION(BlueprintCallable, Category = "Racing Agent")
+	void ApplyTrainingCollision();
+
+	/** Bind this agent to one track of a multi-track world (Player Start + track frame provider spline) */
+	UFUNCTION(BlueprintCallable, Category = "Racing Agent")
+	void BindToTrack(ARacingTrackInstance* InTrack);
+
+	UFUNCTION(BlueprintCallable, Category = "Racing Agent")
+	ARacingTrackInstance* GetTrackInstance() const { return TrackInstance; }
+
 	// ===== Observation =====
 
 	UFUNCTION(BlueprintCallable, Category = "Racing Agent")
@@ -75,6 +93,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Racing Agent")
 	int32 GetEpisodeStepCount() const { return EpisodeStepCount; }
 
+	// ===== Physics Snapshot =====
+
+	/** Capture rigid body, wheel, engine and gear state of the vehicle */
+	UFUNCTION(BlueprintCallable, Category = "Racing Agent|Snapshot")
+	FVehiclePhysicsSnapshot CaptureVehicleSnapshot() const;
+
+	/** Restore a captured state in one step. bStartNewEpisode also resets the episode accumulators. */
+	UFUNCTION(BlueprintCallable, Category = "Racing Agent|Snapshot")
+	bool RestoreVehicleSnapshot(const FVehiclePhysicsSnapshot& Snapshot, bool bStartNewEpisode = true);
+
+	/** ResetEpisode restores this snapshot instead of teleporting to the Player Start (checkpoint / replay) */
+	UFUNCTION(BlueprintCallable, Category = "Racing Agent|Snapshot")
+	void SetResetSnapshot(const FVehiclePhysicsSnapshot& Snapshot) { ResetSnapshot = Snapshot; }
+
+	UFUNCTION(BlueprintCallable, Category = "Racing Agent|Snapshot")
+	void ClearResetSnapshot() { ResetSnapshot = FVehiclePhysicsSnapshot(); }
+
+	/** Snapshot taken ~FailureReplayLeadSeconds before the last failed episode ended */
+	UFUNCTION(BlueprintCallable, Category = "Racing Agent|Snapshot")
+	bool GetLastFailureSnapshot(FVehiclePhysicsSnapshot& OutSnapshot) const;
+
 	// ===== Configuration =====
 
 	// --- Adaptive Ray Trace Settings ---
@@ -125,6 +164,21 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Racing|Ground Ray")
 	float GroundRayMaxDistanceCm = 500.f;
 
+	// --- Training Collision ---
+
+	/** Ghost mode for large training fields: the vehicle body moves to TrainingAgentChannel,
+	 *  ignores other agents and all sensor traces only query track geometry. */
+	UPROPERTY(EditAnywhere, Category = "Racing|Training Collision")
+	bool bUseTrainingCollision = false;
+
+	/** Object channel of training vehicles ("TrainingAgent" in DefaultEngine.ini) */
+	UPROPERTY(EditAnywhere, Category = "Racing|Training Collision", meta = (EditCondition = "bUseTrainingCollision"))
+	TEnumAsByte<ECollisionChannel> TrainingAgentChannel = ECC_GameTraceChannel1;
+
+	/** Object types that count as track geometry for sensor traces in training collision mode */
+	UPROPERTY(EditAnywhere, Category = "Racing|Training Collision", meta = (EditCondition = "bUseTrainingCollision"))
+	TArray<TEnumAsByte<ECollisionChannel>> TrackObjectChannels = { ECC_WorldStatic, ECC_WorldDynamic };
+
 	// --- LIDAR Settings ---
 
 	/** Enable optional LIDAR ring sensor.
@@ -180,6 +234,47 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Racing|Spawning")
 	int32 SpawnRandomSeed = 0;
 
+	/** Start some episodes at failure hotspots of the track (URacingFailureHotspotSubsystem) instead of the Player Start */
+	UPROPERTY(EditAnywhere, Category = "Racing|Spawning")
+	bool bUseFailureHotspotSpawns = false;
+
+	UPROPERTY(EditAnywhere, Category = "Racing|Spawning", meta = (ClampMin = 0.0, ClampMax = 1.0, EditCondition = "bUseFailureHotspotSpawns"))
+	float HotspotSpawnChance = 0.5f;
+
+	/** Spawn this far before the sampled hotspot so the car reaches it driving */
+	UPROPERTY(EditAnywhere, Category = "Racing|Spawning", meta = (ClampMin = 0.0, EditCondition = "bUseFailureHotspotSpawns"))
+	float HotspotLeadInCm = 1500.f;
+
+	/** Report crash / gap fall / stuck terminations to the failure hotspot histogram */
+	UPROPERTY(EditAnywhere, Category = "Racing|Spawning")
+	bool bReportFailureHotspots = true;
+
+	// --- Track ---
+
+	/** Track this agent trains on. Null = single-track world (first Player Start) */
+	UPROPERTY(EditAnywhere, Category = "Racing|Track")
+	TObjectPtr<ARacingTrackInstance> TrackInstance;
+
+	/** Without TrackInstance: bind to the closest track instance on BeginPlay (if the world has any) */
+	UPROPERTY(EditAnywhere, Category = "Racing|Track")
+	bool bAutoBindClosestTrack = true;
+
+	// --- Snapshots / Failure Replay ---
+
+	/** Keep a short ring buffer of vehicle snapshots during the episode (for failure replay) */
+	UPROPERTY(EditAnywhere, Category = "Racing|Snapshot")
+	bool bRecordSnapshotHistory = false;
+
+	UPROPERTY(EditAnywhere, Category = "Racing|Snapshot", meta = (ClampMin = 0.05, EditCondition = "bRecordSnapshotHistory"))
+	float SnapshotIntervalSeconds = 0.5f;
+
+	UPROPERTY(EditAnywhere, Category = "Racing|Snapshot", meta = (ClampMin = 1, ClampMax = 64, EditCondition = "bRecordSnapshotHistory"))
+	int32 SnapshotHistoryLength = 8;
+
+	/** How long before a crash / fall / stuck the failure snapshot is taken (seconds) */
+	UPROPERTY(EditAnywhere, Category = "Racing|Snapshot", meta = (ClampMin = 0.0, EditCondition = "bRecordSnapshotHistory"))
+	float FailureReplayLeadSeconds = 2.f;
+
 	// --- NEAT Settings ---
 
 	UPROPERTY(VisibleAnywhere, Category = "Racing|NEAT")
@@ -188,6 +283,35 @@ public:
 	UPROPERTY(VisibleAnywhere, Category = "Racing|NEAT")
 	int32 Generation = 0;
 
+	/** Episodes started with the current genome (part of the deterministic seed) */
+	UPROPERTY(VisibleAnywhere, Category = "Racing|NEAT")
+	int32 EpisodeIndex = 0;
+
+	/** End the episode once its fitness ceiling drops below this (set by the NEAT manager, <= 0 disables) */
+	UPROPERTY(VisibleAnywhere, Category = "Racing|NEAT")
+	float FitnessCutoff = 0.f;
+
+	/** Episode time limit imposed from outside (e.g. MaxEpisodeDuration), <= 0 = only MaxEpisodeSteps */
+	UPROPERTY(VisibleAnywhere, Category = "Racing|NEAT")
+	float EpisodeTimeLimitSeconds = 0.f;
+
+	/** Optimistic top speed for the fitness ceiling (cm/s) */
+	UPROPERTY(EditAnywhere, Category = "Racing|NEAT")
+	float FitnessCeilingSpeedCmPerSec = 6000.f;
+
+	// --- Determinism ---
+
+	/** Re-seed SpawnRng on every reset from (DeterministicBaseSeed, Generation, GenomeID, EpisodeIndex)
+	 *  and reset the Chaos vehicle state, so the same genome produces the same rollout. */
+	UPROPERTY(EditAnywhere, Category = "Racing|Determinism")
+	bool bDeterministicSeeding = false;
+
+	UPROPERTY(EditAnywhere, Category = "Racing|Determinism", meta = (EditCondition = "bDeterministicSeeding"))
+	int32 DeterministicBaseSeed = 1337;
+
+	/** Stable seed for one (generation, genome, episode) triple */
+	static int32 MakeEpisodeSeed(int32 BaseSeed, int32 InGeneration, int32 InGenomeID, int32 InEpisodeIndex);
+
 	// --- Debug ---
 
 	UPROPERTY(EditAnywhere, Category = "Racing|Debug")
@@ -220,6 +344,26 @@ protected:
 	UPROPERTY() float StuckTimeAccum = 0.f;
 	UPROPERTY() FVector EpisodeStartLocation = FVector::ZeroVector;
 	UPROPERTY() FRandomStream SpawnRng;
+	UPROPERTY() int32 CurrentEpisodeSeed = 0;
+
+	// ===== Snapshot State =====
+
+	// Progress stall: cumulative signed track progress, sampled into a ring for the sliding window
+	UPROPERTY() float TrackProgressCm = 0.f;
+	UPROPERTY() TArray<float> ProgressWindowSamples;
+	UPROPERTY() int32 ProgressWindowHead = 0;
+	UPROPERTY() int32 ProgressWindowCount = 0;
+	UPROPERTY() float ProgressSampleAccum = 0.f;
+	mutable TWeakObjectPtr<UTrackFrameProviderComponent> CachedTrackProvider;
+
+	UPROPERTY() FVehiclePhysicsSnapshot ResetSnapshot;
+	UPROPERTY() FVehiclePhysicsSnapshot LastFailureSnapshot;
+	UPROPERTY() TArray<FVehiclePhysicsSnapshot> SnapshotHistory; // Ring buffer
+	UPROPERTY() int32 SnapshotHistoryHead = 0;
+	UPROPERTY() float SnapshotTimeAccum = 0.f;
+
+	/** Player Start resolved once instead of on every reset */
+	mutable TWeakObjectPtr<APlayerStart> CachedPlayerStart;
 
 	// ===== Adaptive Ray State =====
 
@@ -249,6 +393,7 @@ protected:
 
 	AActor* GetVehicleActor() const;
 	UPrimitiveComponent* GetVehicleRootComponent() const;
+	UChaosWheeledVehicleMovementComponent* GetVehicleMovement() const;
 	void ApplyAction(const FVehicleAction& Action);
 
 	/** Trace adaptive ray with current pitch angle */
@@ -267,6 +412,15 @@ protected:
 		FColor DebugColor = FColor::Red
 	);
 
+	/** Single sensor line trace; by RayTraceChannel / Channel, or track objects only in training collision mode */
+	bool SensorLineTrace(
+		FHitResult& OutHit,
+		const FVector& Start,
+		const FVector& End,
+		ECollisionChannel Channel,
+		const FName& TraceTag
+	) const;
+
 	/** Trace evenly spaced horizontal LIDAR ring and populate OutRays. */
 	void BuildLidarObservation(const FVector& Origin, const FVector& Forward, TArray<float>& OutRays);
 
@@ -280,9 +434,16 @@ protected:
 	void ResetAdaptiveRays();
 
 	APlayerStart* FindPlayerStart() const;
+	bool TryGetHotspotSpawn(FVector& OutLocation, FRotator& OutRotation);
+	void ReportFailureHotspot(const FString& TerminationReason);
 	void ResetEpisodeAccumulators();
 	bool CheckTerminalConditions(const FRacingObservation& Obs, float DeltaTime, FString& OutReason);
+	UTrackFrameProviderComponent* GetTrackProvider() const;
+	void ResetProgressWindow();
+	float UpdateProgressWindow(float DeltaTime, bool& bOutWindowFull);
 	void FinalizeEpisodeStats(const FString& TerminationReason);
+	void RecordSnapshotHistory(float DeltaTime);
+	void StoreFailureSnapshot();
 	FString GetAgentLogId() const;
 	void DrawObservationHUD();
 	void DrawRayAnglesDebug();
@@ -44,6 +44,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Curriculum|Debug")
 	void DumpTagStats() const;
 
+	/**
+	 * Rebuild the lookup tables (sorted segment index + length-weighted alias table per tag mask).
+	 * Runs on load / edit and on the first query after MarkSegmentsDirty.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Curriculum")
+	void RebuildSamplingTables();
+
+	/** Replace the segments (e.g. from the curriculum builder) and invalidate the lookup tables */
+	void SetSegments(float InSplineLengthCm, TArray<FRacingCurriculumSegment> InSegments);
+
+	/** Call after writing Segments in place; the tables are rebuilt on the next query */
+	UFUNCTION(BlueprintCallable, Category = "Curriculum")
+	void MarkSegmentsDirty();
+
 public:
 	// ------------------------------------------------------------
 	// Lifecycle
@@ -53,4 +67,40 @@ public:
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
 #endif
+
+private:
+	// ------------------------------------------------------------
+	// Lookup tables (derived from Segments, not serialized)
+	// ------------------------------------------------------------
+	static constexpr int32 NumTagMasks = 32; // 5 tag bits
+
+	/** Range in the flat alias arrays for one (mask, any/all) query */
+	struct FTagSampleTable
+	{
+		int32 First = 0;
+		int32 Num = 0;
+	};
+
+	bool AreSamplingTablesValid() const;
+	void EnsureSamplingTables() const;
+	void BuildSamplingTablesInternal() const;
+
+	int32 FindSegmentIndexAtDistance(float S) const;
+
+	// Segments ordered by start distance
+	mutable TArray<float> SortedStartCm;
+	mutable TArray<int32> SortedSegmentIndex;
+
+	// [Mask] = any tag matches, [NumTagMasks + Mask] = all tags match
+	mutable FTagSampleTable TagTables[2 * NumTagMasks];
+	mutable TArray<int32> SampleSegmentIndex;
+	mutable TArray<float> SampleAliasProb;
+	mutable TArray<int32> SampleAliasIndex; // local to the table
+
+	/** Bumped by SetSegments / MarkSegmentsDirty; the tables record the revision they were built from */
+	uint32 SegmentsRevision = 1;
+	mutable uint32 BuiltSegmentsRevision = 0;
+	mutable int32 BuiltNumSegments = 0;
+	mutable float BuiltSplineLengthCm = 0.f;
+	mutable bool bBuiltLoopedTrack = false;
 };
@@ -1,8 +1,9 @@
-#pragma once
+﻿#pragma once
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Types/RacingCurriculumTypes.h"
+#include "Track/TrackFrameTable.h"
 #include "RacingCurriculumDebugActor.generated.h"
 
 class USplineComponent;
@@ -267,6 +268,7 @@ public:
 protected:
 	void RebuildInternal(bool bFromConstruction);
 	void EnsureTrackSpline();
+	void EnsureFrameTable();
 	void BuildSamples();
 	void DrawInternal();
 
@@ -301,6 +303,9 @@ private:
 	UPROPERTY(Transient) TObjectPtr<USplineComponent> TrackSpline = nullptr;
 	float CachedSplineLengthCm = 0.f;
 
+	/** Frame table of TrackSpline (spline queries of samples / candidates / curvature) */
+	TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> FrameTable;
+
 	UPROPERTY(Transient) TArray<FRC_DebugSample> CachedSamples;
 	UPROPERTY(Transient) TArray<FRacingCurriculumSegment> CachedSegments;
 
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RacingVehiclePoolSubsystem.generated.h"
+
+class APawn;
+class USimpleNeuralNetwork;
+
+/** Free / active pawns of one vehicle class */
+USTRUCT()
+struct FRacingVehiclePoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TSubclassOf<APawn> PawnClass;
+
+	/** Parked pawns ready to be handed out */
+	UPROPERTY()
+	TArray<TObjectPtr<APawn>> Free;
+
+	/** Pawns currently handed out */
+	UPROPERTY()
+	TArray<TObjectPtr<APawn>> Active;
+};
+
+/**
+ * World subsystem that keeps a pool of pre-spawned vehicle pawns for training.
+ *
+ * Instead of spawning a full car (actor construction, component registration,
+ * physics body creation) for every agent and destroying it again, vehicles are
+ * spawned once, parked (hidden, no collision, no physics, no tick) and handed
+ * out / taken back with a cheap reinitialize path:
+ * - teleport with physics reset, zero velocities, reset Chaos vehicle state
+ * - re-enable collision, physics, movement and tick
+ * - optionally rebind the agent's policy network
+ */
+UCLASS()
+class CARAIRUNTIME_API URacingVehiclePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	/** Pre-spawn vehicles so the pool holds at least Count free pawns of PawnClass */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Vehicle Pool")
+	int32 Prewarm(TSubclassOf<APawn> PawnClass, int32 Count);
+
+	/** Hand out a vehicle at SpawnTransform (spawns a new one if the pool is empty) */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Vehicle Pool")
+	APawn* AcquireVehicle(TSubclassOf<APawn> PawnClass, const FTransform& SpawnTransform, USimpleNeuralNetwork* Network = nullptr);
+
+	/** Park a vehicle and return it to the pool. Returns false if the pawn is not pooled. */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Vehicle Pool")
+	bool ReleaseVehicle(APawn* Pawn);
+
+	/** Park all active vehicles */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Vehicle Pool")
+	void ReleaseAllVehicles();
+
+	/** Destroy all pooled vehicles (free and active) */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Vehicle Pool")
+	void DestroyPool();
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Vehicle Pool")
+	int32 GetNumFree(TSubclassOf<APawn> PawnClass) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Vehicle Pool")
+	int32 GetNumActive(TSubclassOf<APawn> PawnClass) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Vehicle Pool")
+	bool IsPooled(const APawn* Pawn) const;
+
+	/** Where parked vehicles are moved to (far below the track) */
+	UPROPERTY(EditAnywhere, Category = "Racing|Vehicle Pool")
+	FVector ParkingLocation = FVector(0.f, 0.f, -100000.f);
+
+	/** Tag added to every pooled vehicle */
+	UPROPERTY(EditAnywhere, Category = "Racing|Vehicle Pool")
+	FName PooledTag = TEXT("PooledVehicle");
+
+private:
+	FRacingVehiclePoolBucket& FindOrAddBucket(TSubclassOf<APawn> PawnClass);
+	const FRacingVehiclePoolBucket* FindBucket(TSubclassOf<APawn> PawnClass) const;
+
+	APawn* SpawnPooledPawn(TSubclassOf<APawn> PawnClass);
+	void ParkPawn(APawn* Pawn) const;
+	void ActivatePawn(APawn* Pawn, const FTransform& SpawnTransform, USimpleNeuralNetwork* Network) const;
+
+	UPROPERTY()
+	TArray<FRacingVehiclePoolBucket> Buckets;
+};
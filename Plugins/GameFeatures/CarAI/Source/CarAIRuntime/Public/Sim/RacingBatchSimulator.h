@@ -0,0 +1,181 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "Types/RacingAgentTypes.h"
+#include "Types/RacingBatchSimTypes.h"
+#include "RacingBatchSimulator.generated.h"
+
+class USplineComponent;
+class USimpleNeuralNetwork;
+class URacingAgentComponent;
+
+/**
+ * Actorless batched vehicle simulator for policy pretraining.
+ *
+ * Steps thousands of cars in structure-of-arrays loops (no UWorld, actors or
+ * components during simulation):
+ * - dynamic bicycle model with tire slip and a friction circle
+ * - suspension height against the baked track surface (ramps, loops)
+ * - airborne / gravity handling when the wheels lose contact or there is a gap
+ *
+ * Observations, reward and terminal conditions are the ones of
+ * URacingAgentComponent (FRacingObservation, FRacingRewardConfig), and policies
+ * are plain USimpleNeuralNetwork instances, so a network pretrained here can be
+ * fine-tuned in the full Chaos world without changes.
+ *
+ * Sensors are approximated by ray marching in track space: horizontal rays hit
+ * walls (bTrackHasWalls) and rising surface, adaptive ray pitch is not simulated.
+ */
+UCLASS(BlueprintType)
+class CARAIRUNTIME_API URacingBatchSimulator : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	// ===== Setup =====
+
+	/** Copy sensor normalization, ray / LIDAR settings and reward config from an agent */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	void ConfigureFromAgent(const URacingAgentComponent* Agent);
+
+	/**
+	 * Bake the track table from a spline. Must be called on the game thread.
+	 * @param SurfaceTraceWorld - Optional: trace the real surface (gaps, surface offset). Null = spline is the surface.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	bool BakeTrack(USplineComponent* Spline, UWorld* SurfaceTraceWorld = nullptr);
+
+	/** Allocate state for Config.NumCars cars and reset all of them */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	bool Initialize();
+
+	/** One policy per car, or a single shared policy */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	void SetPolicies(const TArray<USimpleNeuralNetwork*>& InPolicies);
+
+	// ===== Simulation =====
+
+	/** Observe, act and integrate all cars by DeltaTime */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	void Step(float DeltaTime);
+
+	/**
+	 * Run one episode per car (bAutoReset is ignored) and return the final stats in car order.
+	 * Stops after MaxSteps even if cars are still running.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	TArray<FEpisodeStats> RunEpisodes(int32 MaxSteps = 5000);
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	void ResetAllCars();
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	void ResetCar(int32 CarIndex);
+
+	// ===== Queries =====
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	int32 GetNumCars() const { return NumCars; }
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	bool IsCarDone(int32 CarIndex) const { return Done.IsValidIndex(CarIndex) && Done[CarIndex] != 0; }
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	FEpisodeStats GetEpisodeStats(int32 CarIndex) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	FRacingObservation GetObservation(int32 CarIndex) const;
+
+	/** World transform of a car (debug drawing / transfer to a Chaos vehicle) */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	FTransform GetCarTransform(int32 CarIndex) const;
+
+	/** Episodes finished since the last call (auto-reset mode) */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	TArray<FEpisodeStats> ConsumeCompletedEpisodes();
+
+	/** Total simulated car-seconds since Initialize */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Batch Sim")
+	double GetSimulatedCarSeconds() const { return SimulatedCarSeconds; }
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Racing|Batch Sim")
+	FRacingBatchSimConfig Config;
+
+protected:
+	/** Interpolated track frame at distance S */
+	struct FTrackSample
+	{
+		FVector3f Position;
+		FVector3f Tangent;
+		FVector3f Right;
+		FVector3f Up;
+		float CurvatureLateral = 0.f;
+		float CurvatureVertical = 0.f;
+		float SurfaceOffset = 0.f;
+		bool bHasSurface = true;
+	};
+
+	FTrackSample SampleTrack(float InS) const;
+	float WrapDistance(float InS) const;
+
+	void BuildObservation(int32 i, FRacingObservation& Obs) const;
+	float MarchRay(int32 i, float YawOffsetRad, float PitchRad, float MaxDistanceCm) const;
+	void IntegrateCar(int32 i, const FVehicleAction& Action, float Dt);
+
+	/** Track progress over the last ProgressWindowSeconds (same sliding window as URacingAgentComponent) */
+	float UpdateProgressWindow(int32 i, float Dt, bool& bOutWindowFull);
+	void FinalizeEpisode(int32 i, const FString& Reason);
+	FVector GetCarLocation(int32 i) const;
+
+	FRacingBatchSimTrack Track;
+
+	UPROPERTY()
+	TArray<TObjectPtr<USimpleNeuralNetwork>> Policies;
+
+	/** Each car owns its network -> inference can run in parallel */
+	bool bPoliciesUnique = false;
+
+	int32 NumCars = 0;
+	double SimulatedCarSeconds = 0.0;
+
+	/** RunEpisodes in progress: finished cars stay done */
+	bool bRunningEpisodes = false;
+
+	// ===== Car State (SoA) =====
+
+	TArray<float> S;         // Distance along track (cm)
+	TArray<float> D;         // Lateral offset, + = right (cm)
+	TArray<float> H;         // Height above surface along Up (cm)
+	TArray<float> Psi;       // Heading relative to track tangent (rad, + = right)
+	TArray<float> U;         // Longitudinal velocity (cm/s)
+	TArray<float> V;         // Lateral velocity, + = right (cm/s)
+	TArray<float> W;         // Velocity along surface normal (cm/s)
+	TArray<float> YawRate;   // rad/s, + = right
+	TArray<uint8> Grounded;
+
+	// ===== Episode State (SoA) =====
+
+	TArray<uint8> Done;
+	TArray<int32> StepCount;
+	TArray<float> EpisodeTime;
+	TArray<float> AirborneTime;
+	TArray<float> StuckTime;
+	TArray<float> LastSteer;
+
+	// Progress stall: cumulative signed track progress, sampled into one ring per car (flat, ProgressWindowSlices + 1 each)
+	TArray<float> TrackProgress;
+	TArray<float> ProgressWindowSamples;
+	TArray<int32> ProgressWindowHead;
+	TArray<int32> ProgressWindowCount;
+	TArray<float> ProgressSampleAccum;
+
+	TArray<FVector> StartLocation;
+	TArray<FEpisodeStats> Stats;
+	TArray<FRacingObservation> Observations;
+	TArray<FVehicleAction> Actions;
+	TArray<FRewardBreakdown> Rewards;
+	TArray<FRandomStream> CarRng;
+
+	TArray<FEpisodeStats> CompletedEpisodes;
+};
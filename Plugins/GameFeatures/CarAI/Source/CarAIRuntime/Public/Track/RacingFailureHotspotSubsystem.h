@@ -0,0 +1,149 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RacingFailureHotspotSubsystem.generated.h"
+
+class USplineComponent;
+
+UENUM(BlueprintType)
+enum class ERacingFailureKind : uint8
+{
+	None,
+	Crash,      // Collision
+	GapFall,    // Fell off track / long airborne
+	Stuck       // Stuck / progress stall
+};
+
+/** Decayed failure histogram over track distance of one spline, plus its alias table */
+USTRUCT()
+struct FRacingFailureHistogram
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TWeakObjectPtr<USplineComponent> Spline;
+
+	UPROPERTY()
+	float SplineLengthCm = 0.f;
+
+	UPROPERTY()
+	bool bClosedLoop = true;
+
+	/**
+	 * Bin weights scaled by exp(Lambda * (EventTime - ScaleTime)): decay is applied lazily
+	 * on read, so an event only touches its own bin.
+	 */
+	UPROPERTY()
+	TArray<float> Bins;
+
+	UPROPERTY()
+	double ScaleTime = 0.0;
+
+	UPROPERTY()
+	double ScaledMass = 0.0;
+
+	UPROPERTY()
+	int32 NumEvents = 0;
+
+	// Alias table (Vose), rebuilt lazily when events arrived
+	UPROPERTY()
+	TArray<float> AliasProb;
+
+	UPROPERTY()
+	TArray<int32> AliasIndex;
+
+	UPROPERTY()
+	bool bAliasDirty = true;
+
+	UPROPERTY()
+	double LastAliasBuildTime = -1.0;
+};
+
+/**
+ * Runtime failure-hotspot accumulator for curriculum training.
+ *
+ * Agents report where episodes fail (crash, gap fall, stuck) as distance along their track
+ * spline. Failures are binned per track with exponential decay (HalfLifeSeconds), and spawn
+ * distances are drawn from an alias table over the bins in O(1), so training episodes start
+ * where the policy is currently weak instead of re-driving easy straights.
+ *
+ * UniformFloor keeps a share of spawns spread over the whole track, so segments that
+ * are no longer failing still get visited.
+ */
+UCLASS()
+class CARAIRUNTIME_API URacingFailureHotspotSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Map an episode termination reason (FEpisodeStats::TerminationReason) to a failure kind */
+	static ERacingFailureKind ClassifyTerminationReason(const FString& Reason);
+
+	/** Record a failure at DistanceCm along Spline */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Failure Hotspots")
+	void ReportFailure(USplineComponent* Spline, float DistanceCm, ERacingFailureKind Kind);
+
+	/** Draw a spawn distance biased towards failure hotspots. False until MinEventsForSampling were reported. */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Failure Hotspots")
+	bool SampleSpawnDistance(USplineComponent* Spline, FRandomStream& Rng, float& OutDistanceCm);
+
+	/** Decayed failure weight of the bin containing DistanceCm */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Failure Hotspots")
+	float GetFailureWeightAtDistance(USplineComponent* Spline, float DistanceCm) const;
+
+	/** Decayed failure weight per bin (BinSizeCm apart) */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Failure Hotspots")
+	TArray<float> GetDecayedHistogram(USplineComponent* Spline) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Failure Hotspots")
+	void ResetHotspots();
+
+	// ===== Configuration =====
+
+	/** Histogram bin length along the track */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Racing|Failure Hotspots", meta = (ClampMin = 50.0))
+	float BinSizeCm = 500.f;
+
+	/** A failure counts half after this much game time (<= 0 = no decay) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Racing|Failure Hotspots")
+	float HalfLifeSeconds = 300.f;
+
+	/** Share of the sampling mass spread uniformly over the track */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Racing|Failure Hotspots", meta = (ClampMin = 0.0, ClampMax = 1.0))
+	float UniformFloor = 0.15f;
+
+	/** Failures needed on a track before it is sampled by hotspot */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Racing|Failure Hotspots", meta = (ClampMin = 1))
+	int32 MinEventsForSampling = 8;
+
+	/** Minimum game time between alias table rebuilds of one track */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Racing|Failure Hotspots", meta = (ClampMin = 0.0))
+	float AliasRebuildIntervalSeconds = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Racing|Failure Hotspots")
+	float CrashWeight = 1.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Racing|Failure Hotspots")
+	float GapFallWeight = 1.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Racing|Failure Hotspots")
+	float StuckWeight = 0.5f;
+
+private:
+	FRacingFailureHistogram* FindHistogram(const USplineComponent* Spline);
+	const FRacingFailureHistogram* FindHistogram(const USplineComponent* Spline) const;
+	FRacingFailureHistogram& FindOrAddHistogram(USplineComponent* Spline);
+
+	double GetNow() const;
+	double GetDecayLambda() const;
+	float GetKindWeight(ERacingFailureKind Kind) const;
+
+	/** Fold the lazy scale into the bins (keeps the exponent bounded) */
+	void Renormalize(FRacingFailureHistogram& Histogram, double Now) const;
+
+	void RebuildAliasTable(FRacingFailureHistogram& Histogram) const;
+
+	UPROPERTY()
+	TArray<FRacingFailureHistogram> Histograms;
+};
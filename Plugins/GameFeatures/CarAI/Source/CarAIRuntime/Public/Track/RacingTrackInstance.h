@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "RacingTrackInstance.generated.h"
+
+class USplineComponent;
+class APlayerStart;
+class ANoSpawnZoneActor;
+class URacingCurriculumDataAsset;
+
+/**
+ * One track of a multi-track training world.
+ *
+ * Place one instance per track (e.g. in each streamed sublevel at its offset). It bundles
+ * everything an agent or the curriculum spawner needs for that track: road spline provider,
+ * curriculum asset, Player Start and no-spawn zones. Unset references are resolved from the
+ * actors of the level this instance lives in, so a sublevel only needs the instance itself.
+ *
+ * Worlds without any track instance keep the single-track behaviour ("Track" tag / first spline).
+ */
+UCLASS()
+class CARAIRUNTIME_API ARacingTrackInstance : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	ARacingTrackInstance();
+
+	virtual void BeginPlay() override;
+
+	/** Fill unset references from the actors of this instance's level */
+	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Racing|Track")
+	void ResolveReferences();
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Track")
+	USplineComponent* GetTrackSpline() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Track")
+	AActor* GetTrackActor() const { return TrackActor; }
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Track")
+	APlayerStart* GetPlayerStart() const { return PlayerStart; }
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Track")
+	URacingCurriculumDataAsset* GetCurriculumAsset() const { return CurriculumAsset; }
+
+	/** True if P lies in one of this track's no-spawn zones */
+	UFUNCTION(BlueprintCallable, Category = "Racing|Track")
+	bool IsInNoSpawnZone(const FVector& P) const;
+
+	const TArray<TObjectPtr<ANoSpawnZoneActor>>& GetNoSpawnZones() const { return NoSpawnZones; }
+
+	/** All track instances of the world, sorted by TrackId (stable agent -> track assignment) */
+	static TArray<ARacingTrackInstance*> GetAllTrackInstances(const UWorld* World);
+
+	/** Track instance whose spline is closest to a world location, null if the world has none */
+	static ARacingTrackInstance* FindClosestTrackInstance(const UWorld* World, const FVector& Location);
+
+public:
+	/** Unique track name (agent tags, sort order). None = "<level>.<actor name>" */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Racing|Track")
+	FName TrackId = NAME_None;
+
+	/** Road spline provider (RoadSplineInterface or "Track" tag). Null = first one in this level */
+	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Racing|Track")
+	TObjectPtr<AActor> TrackActor = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Racing|Track")
+	TObjectPtr<URacingCurriculumDataAsset> CurriculumAsset = nullptr;
+
+	/** Episode start of agents bound to this track. Null = first Player Start in this level */
+	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Racing|Track")
+	TObjectPtr<APlayerStart> PlayerStart = nullptr;
+
+	/** Zones of this track. Empty = all no-spawn zones in this level */
+	UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category = "Racing|Track")
+	TArray<TObjectPtr<ANoSpawnZoneActor>> NoSpawnZones;
+
+	/** Fallback: spline component tag on TrackActor if it does not implement RoadSplineInterface */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Racing|Track")
+	FName TrackSplineComponentTag = FName("RoadSpline");
+};
@@ -308,6 +308,24 @@ struct FRacingRewardConfig
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stuck Detection")
 	float TerminalPenalty_Stuck = -2.0f;
 
+	// ===== Progress Stall =====
+
+	/** End episodes that make too little track progress (circling, wall-hugging, crawling above StuckSpeedNorm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Progress Stall")
+	bool bEnableProgressStall = false;
+
+	/** Sliding window over which track progress is measured (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Progress Stall", meta = (ClampMin = 0.5))
+	float ProgressWindowSeconds = 4.0f;
+
+	/** Minimum signed progress along the track within the window (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Progress Stall")
+	float MinWindowProgressCm = 1500.f;
+
+	/** No stall check before this episode time (launch) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Progress Stall")
+	float ProgressGraceSeconds = 3.0f;
+
 	// ===== General =====
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General")
@@ -315,6 +333,157 @@ struct FRacingRewardConfig
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "General")
 	int32 MaxEpisodeSteps = 5000;
+
+	/**
+	 * Reward for one step. Shared by URacingAgentComponent and the batch simulator.
+	 * @param DistanceFromStartCm - Straight-line distance from the episode start
+	 * @param EpisodeTimeSeconds - Time since episode start
+	 * @param DistanceTraveledCm - EpisodeStats.DistanceTraveledCm of the previous step (Phase 2 gate)
+	 * @param LastSteer - Steer of the previous action
+	 */
+	FRewardBreakdown ComputeReward(
+		const FRacingObservation& Obs,
+		float DistanceFromStartCm,
+		float EpisodeTimeSeconds,
+		float DistanceTraveledCm,
+		float LastSteer) const
+	{
+		FRewardBreakdown R;
+
+		// ===== Distance Reward =====
+
+		R.Distance = (DistanceFromStartCm / 100.f) * W_Distance;
+
+		// ===== Survival Bonus =====
+
+		R.Survival = EpisodeTimeSeconds * W_Survival;
+
+		// ===== Speed Bonus (Phase 2) =====
+
+		if (DistanceTraveledCm > Phase2ActivationDistanceCm)
+		{
+			float SpeedDiff = FMath::Abs(Obs.SpeedNorm - SpeedTargetNorm);
+			R.Speed = (1.f - SpeedDiff) * W_Speed;
+		}
+
+		// ===== Smoothness =====
+
+		float SteerDiff = FMath::Abs(LastSteer - Obs.SpeedNorm); // Simplified
+		R.Smoothness = SteerDiff * W_ActionSmooth;
+
+		// ===== Collision Penalty (Adaptive Rays) =====
+
+		float MinRayDist = FMath::Min(
+			FMath::Min(
+				FMath::Min(Obs.RayForward, Obs.RayLeft),
+				FMath::Min(Obs.RayRight, Obs.RayLeft45)
+			),
+			Obs.RayRight45
+		);
+
+		if (MinRayDist < CollisionWarningThreshold)
+		{
+			R.Collision = CollisionWarningPenalty;
+		}
+
+		if (MinRayDist < CollisionTerminalThreshold)
+		{
+			R.bDone = true;
+			R.DoneReason = TEXT("Collision");
+			R.Collision = CollisionTerminalPenalty;
+		}
+
+		// ===== Gap Penalty (Ground Ray) =====
+
+		if (Obs.RayGroundDist < GapWarningThreshold)
+		{
+			R.GapPenalty = GapWarningPenalty;
+		}
+
+		if (Obs.RayGroundDist < GapTerminalThreshold)
+		{
+			R.bDone = true;
+			R.DoneReason = TEXT("Fell off track");
+			R.GapPenalty = GapTerminalPenalty;
+		}
+
+		// ===== Total =====
+
+		R.Total = R.Distance + R.Survival + R.Speed + R.Smoothness + R.Collision + R.GapPenalty;
+		R.Total = FMath::Clamp(R.Total, -MaxAbsTerm, MaxAbsTerm);
+
+		return R;
+	}
+
+	/** Max steps / airborne / stuck check. Updates the airborne and stuck timers. */
+	bool CheckTerminal(
+		const FRacingObservation& Obs,
+		float DeltaTime,
+		int32 StepCount,
+		float& InOutAirborneSeconds,
+		float& InOutStuckSeconds,
+		FString& OutReason) const
+	{
+		// Max steps
+		if (StepCount >= MaxEpisodeSteps)
+		{
+			OutReason = TEXT("MaxSteps");
+			return true;
+		}
+
+		// Airborne too long
+		if (Obs.RayGroundDist < 0.1f)
+		{
+			InOutAirborneSeconds += DeltaTime;
+			if (InOutAirborneSeconds >= AirborneMaxSeconds)
+			{
+				OutReason = TEXT("AirborneLong");
+				return true;
+			}
+		}
+		else
+		{
+			InOutAirborneSeconds = 0.f;
+		}
+
+		// Stuck
+		if (Obs.SpeedNorm < StuckSpeedNorm)
+		{
+			InOutStuckSeconds += DeltaTime;
+			if (InOutStuckSeconds >= StuckTimeSeconds)
+			{
+				OutReason = TEXT("Stuck");
+				return true;
+			}
+		}
+		else
+		{
+			InOutStuckSeconds = 0.f;
+		}
+
+		return false;
+	}
+
+	/**
+	 * Progress stall check.
+	 * @param WindowProgressCm - Signed track progress over the last ProgressWindowSeconds
+	 * @param bWindowFull - The window already spans ProgressWindowSeconds
+	 */
+	bool CheckProgressStall(float WindowProgressCm, bool bWindowFull, float EpisodeTimeSeconds, FString& OutReason) const
+	{
+		if (!bEnableProgressStall || !bWindowFull || EpisodeTimeSeconds < ProgressGraceSeconds)
+		{
+			return false;
+		}
+
+		if (WindowProgressCm < MinWindowProgressCm)
+		{
+			OutReason = TEXT("ProgressStall");
+			return true;
+		}
+
+		return false;
+	}
 };
 
 // ============================================================================
@@ -375,6 +544,23 @@ struct FEpisodeStats
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	float NEATFitness = 0.f;
 
+	/** Genome evaluated in this episode (-1 = none) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 GenomeID = -1;
+
+	/** Seed the agent's spawn RNG was initialized with for this episode */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 EpisodeSeed = 0;
+
+	/** Highest NEATFitness still reachable in RemainingSeconds at MaxSpeedCmPerSec (for early cutoff) */
+	float CalculateNEATFitnessCeiling(float RemainingSeconds, float MaxSpeedCmPerSec) const
+	{
+		const float DistanceMeters = (DistanceTraveledCm + FMath::Max(0.f, RemainingSeconds) * MaxSpeedCmPerSec) / 100.f;
+		const float SpeedBonus = DistanceMeters > 50.f ? (MaxSpeedCmPerSec / 100.f) * 3.6f * 0.1f : 0.f;
+
+		return DistanceMeters + SpeedBonus;
+	}
+
 	void CalculateNEATFitness()
 	{
 		float DistanceMeters = DistanceTraveledCm / 100.f;
@@ -395,6 +581,80 @@ struct FEpisodeStats
 	}
 };
 
+// ============================================================================
+// Vehicle Physics Snapshot
+// ============================================================================
+
+USTRUCT(BlueprintType)
+struct FVehicleWheelSnapshot
+{
+	GENERATED_BODY()
+
+	// Chaos wheel state in simulation units (FWheelSnapshot), restored through SetSnapshot
+
+	/** Wheel spin */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float AngularVelocity = 0.f;
+
+	/** Accumulated wheel rotation */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float RotationAngle = 0.f;
+
+	/** Suspension compression offset */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float SuspensionOffset = 0.f;
+
+	/** Steering angle */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float SteerAngle = 0.f;
+};
+
+/**
+ * Full vehicle state captured at one instant.
+ * Restoring it puts the car back into a settled, moving state in one step
+ * (checkpoint resets, failure replay) instead of teleporting and waiting for
+ * the suspension to settle.
+ */
+USTRUCT(BlueprintType)
+struct FVehiclePhysicsSnapshot
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	bool bValid = false;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FTransform Transform = FTransform::Identity;
+
+	/** Linear velocity (cm/s, world space) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVector LinearVelocity = FVector::ZeroVector;
+
+	/** Angular velocity (deg/s, world space) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVector AngularVelocityDeg = FVector::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float EngineRPM = 0.f;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 CurrentGear = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	int32 TargetGear = 0;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<FVehicleWheelSnapshot> Wheels;
+
+	/** Last applied control inputs */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FVehicleAction Action;
+
+	/** Episode time at capture (seconds) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float EpisodeTimeSeconds = 0.f;
+};
+
 // ============================================================================
 // NEAT Genome Data
 // ============================================================================
@@ -461,4 +721,71 @@ struct FNEATTrainingStats
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	float ElapsedSeconds = 0.f;
+
+	/** Simulated world time spent in evaluation (seconds) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float SimulatedSeconds = 0.f;
+
+	/** Wall-clock time spent in evaluation (seconds) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float WallSeconds = 0.f;
+
+	/** Throughput: simulated seconds per wall-clock second (1.0 = real time) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float SimSecondsPerWallSecond = 0.f;
+};
+
+// ============================================================================
+// Simulation Settings (Headless / Accelerated Training)
+// ============================================================================
+
+/**
+ * Engine-level settings applied while a training run is active.
+ *
+ * With a fixed timestep the engine no longer waits for real time: every frame
+ * advances the simulation by FixedDeltaSeconds, so the run is bounded by CPU
+ * cost only. Combine with -nullrhi (or bDisableWorldRendering) on headless nodes.
+ */
+USTRUCT(BlueprintType)
+struct FRacingSimulationSettings
+{
+	GENERATED_BODY()
+
+	/** Run the engine with a fixed timestep (as fast as possible, not real time) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
+	bool bUseFixedTimestep = false;
+
+	/** Simulated seconds per engine frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = 0.001, ClampMax = 0.1, EditCondition = "bUseFixedTimestep"))
+	float FixedDeltaSeconds = 1.f / 60.f;
+
+	/** Physics substeps per engine frame (1 = no substepping) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation", meta = (ClampMin = 1, ClampMax = 16))
+	int32 PhysicsSubsteps = 1;
+
+	/** Disable vsync, frame-rate smoothing and the frame-rate cap */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
+	bool bDisableFrameRateLimits = true;
+
+	/** Skip world rendering in the game viewport (no-op under -nullrhi) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
+	bool bDisableWorldRendering = false;
+
+	/** Step all registered agents from the training manager once per frame
+	 *  (instead of relying on Blueprint calls to StepOnce) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation")
+	bool bStepAgentsFromManager = false;
+
+	/** Reproducible evaluation: implies fixed timestep and manager stepping (agents in
+	 *  registration order), seeds every agent from (seed, generation, genome, episode)
+	 *  and reduces fitness in genome order. Same genome -> same fitness. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation|Determinism")
+	bool bDeterministicEvaluation = false;
+
+	/** Base seed mixed into every per-agent episode seed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Simulation|Determinism", meta = (EditCondition = "bDeterministicEvaluation"))
+	int32 DeterministicSeed = 1337;
+
+	bool UsesFixedTimestep() const { return bUseFixedTimestep || bDeterministicEvaluation; }
+	bool StepsAgentsFromManager() const { return bStepAgentsFromManager || bDeterministicEvaluation; }
 };
\ No newline at end of file
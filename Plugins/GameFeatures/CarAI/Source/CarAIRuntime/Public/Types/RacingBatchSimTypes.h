@@ -0,0 +1,211 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Types/RacingAgentTypes.h"
+#include "Track/TrackFrameTable.h"
+#include "RacingBatchSimTypes.generated.h"
+
+// ============================================================================
+// Batch Simulator - Vehicle Model
+// ============================================================================
+
+/** Simplified dynamic bicycle model (units: cm, kg, s) */
+USTRUCT(BlueprintType)
+struct FRacingBatchSimVehicleParams
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chassis")
+	float MassKg = 1500.f;
+
+	/** Yaw inertia (kg*cm^2) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chassis")
+	float YawInertia = 1500.f * 150.f * 150.f;
+
+	/** CoG to front axle (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chassis")
+	float FrontAxleCm = 130.f;
+
+	/** CoG to rear axle (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chassis")
+	float RearAxleCm = 140.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Chassis")
+	float MaxSteerDeg = 35.f;
+
+	// ===== Tires =====
+
+	/** Lateral force per radian of slip, per unit of normal load */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tires")
+	float FrontCorneringStiffness = 8.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tires")
+	float RearCorneringStiffness = 9.f;
+
+	/** Friction coefficient (friction circle) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tires")
+	float TireFriction = 1.2f;
+
+	// ===== Drivetrain =====
+
+	/** Max drive acceleration at full throttle (cm/s^2) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Drivetrain")
+	float MaxDriveAccel = 900.f;
+
+	/** Max brake deceleration (cm/s^2) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Drivetrain")
+	float MaxBrakeDecel = 1800.f;
+
+	/** Quadratic drag (1/cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Drivetrain")
+	float DragCoefficient = 0.00004f;
+
+	/** Linear rolling resistance (1/s) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Drivetrain")
+	float RollingResistance = 0.15f;
+
+	// ===== Suspension =====
+
+	/** Car center height above the surface at rest (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Suspension")
+	float RideHeightCm = 40.f;
+
+	/** Spring rate per kg (1/s^2) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Suspension")
+	float SuspensionStiffness = 400.f;
+
+	/** Damping per kg (1/s) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Suspension")
+	float SuspensionDamping = 30.f;
+
+	/** Wheels lose contact above RideHeightCm + SuspensionTravelCm */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Suspension")
+	float SuspensionTravelCm = 15.f;
+};
+
+// ============================================================================
+// Batch Simulator - Config
+// ============================================================================
+
+USTRUCT(BlueprintType)
+struct FRacingBatchSimConfig
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Sim", meta = (ClampMin = 1))
+	int32 NumCars = 1024;
+
+	/** Fixed step used by RunEpisodes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Sim", meta = (ClampMin = 0.001))
+	float FixedDeltaSeconds = 1.f / 60.f;
+
+	/** Restart finished cars immediately (continuous rollouts) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Sim")
+	bool bAutoReset = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Sim")
+	int32 RandomSeed = 1337;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Batch Sim")
+	FRacingBatchSimVehicleParams Vehicle;
+
+	// ===== Track =====
+
+	/** Max sample spacing of the track frame table (cm); a finer table baked by the track is reused */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track", meta = (ClampMin = 10.0))
+	float TrackBakeStepCm = 100.f;
+
+	/** Half width of the drivable surface (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track")
+	float TrackHalfWidthCm = 600.f;
+
+	/** Track edges are walls (rays hit them) instead of drop-offs */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track")
+	bool bTrackHasWalls = false;
+
+	/** Spawn distance along the track (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track")
+	float SpawnDistanceCm = 0.f;
+
+	/** Random spawn spread along the track (cm, +/-) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track")
+	float SpawnDistanceJitterCm = 0.f;
+
+	/** Random lateral spawn spread (cm, +/-) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Track")
+	float SpawnLateralJitterCm = 0.f;
+
+	// ===== Sensors (same meaning as on URacingAgentComponent, see ConfigureFromAgent) =====
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors")
+	float RayMaxDistanceCm = 2000.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors")
+	float RayStartOffsetCm = 100.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors")
+	float RayHeightOffsetCm = 50.f;
+
+	/** Ray march steps per ray */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors", meta = (ClampMin = 4, ClampMax = 128))
+	int32 RayMarchSteps = 24;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors")
+	float GroundRayMaxDistanceCm = 500.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors")
+	bool bEnableIMUSensor = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors")
+	bool bEnableLidar = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors", meta = (ClampMin = 4, ClampMax = 32))
+	int32 LidarNumRays = 16;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors")
+	float LidarMaxDistanceCm = 2000.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors")
+	float SpeedNormCmPerSec = 4500.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Sensors")
+	float AngVelNormDegPerSec = 220.f;
+
+	// ===== Reward =====
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Reward")
+	FRacingRewardConfig RewardCfg;
+};
+
+// ============================================================================
+// Batch Simulator - Baked Track (SoA)
+// ============================================================================
+
+/**
+ * Track geometry for the batch simulator. Position and frame come from the shared FTrackFrameTable;
+ * the per-sample arrays below add what only the simulator needs, at the table's sample step.
+ * Curvatures are per cm.
+ */
+struct FRacingBatchSimTrack
+{
+	TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Frames;
+
+	float StepCm = 100.f;
+	float LengthCm = 0.f;
+	bool bClosedLoop = false;
+
+	/** Turn rate of the tangent towards Right (positive = right-hand corner) */
+	TArray<float> CurvatureLateral;
+
+	/** Turn rate of the tangent towards Up (positive = ramp / loop) */
+	TArray<float> CurvatureVertical;
+
+	/** Surface height relative to the spline along Up (from the optional bake trace) */
+	TArray<float> SurfaceOffset;
+
+	/** 0 = gap (no surface under the spline), 1 = drivable */
+	TArray<uint8> HasSurface;
+
+	int32 Num() const { return HasSurface.Num(); }
+	bool IsValid() const { return Frames.IsValid() && Frames->IsValid() && Num() == Frames->GetNumSamples(); }
+};
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Types/RacingAgentTypes.h"
+#include "RacingTrainingWorkerSubsystem.generated.h"
+
+class FSocket;
+class FJsonObject;
+class APawn;
+class URacingAgentComponent;
+class USimpleNeuralNetwork;
+
+/** One evaluation handed out by the coordinator */
+USTRUCT()
+struct FRacingWorkerJob
+{
+	GENERATED_BODY()
+
+	UPROPERTY() int32 JobID = -1;
+	UPROPERTY() int32 GenomeID = -1;
+	UPROPERTY() int32 Generation = 0;
+
+	/** Optional policy weights (USimpleNeuralNetwork::SaveToFile). Empty = agent keeps its network. */
+	UPROPERTY() FString PolicyFile;
+
+	bool IsValid() const { return JobID >= 0; }
+};
+
+/**
+ * Headless training worker for the multi-process coordinator (Content/Python/train_coordinator.py).
+ *
+ * Only active in game worlds started with -CarAIWorker=host:port. The worker connects to the
+ * coordinator over TCP, takes jobs (policy weight file) onto free agents of this world,
+ * steps them and sends one result per finished episode (fitness + episode stats) back.
+ *
+ * Command line:
+ * - CarAIWorker=host:port       coordinator address (required)
+ * - CarAIWorkerId=N             id reported to the coordinator
+ * - CarAISeed=N                 deterministic base seed of this instance
+ * - CarAIAgents=N               agent slice: use at most N agents of this world
+ * - CarAIVehicleClass=Path      spawn the slice from the vehicle pool at the Player Start instead
+ *
+ * Protocol: newline-delimited JSON messages
+ * - worker -> coordinator: hello {worker_id, slots}, result {job_id, genome_id, fitness, ...}
+ * - coordinator -> worker: job {job_id, genome_id, generation, policy_file}, cutoff {fitness}, shutdown
+ */
+UCLASS()
+class CARAIRUNTIME_API URacingTrainingWorkerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	//~ UWorldSubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	//~ FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Training Worker")
+	bool IsConnected() const { return Socket != nullptr; }
+
+	UFUNCTION(BlueprintCallable, Category = "Racing|Training Worker")
+	int32 GetNumBusyAgents() const;
+
+	/** Step agents from the worker tick (disable if a Blueprint already calls StepOnce) */
+	UPROPERTY(EditAnywhere, Category = "Racing|Training Worker")
+	bool bStepAgents = true;
+
+	/** Per-episode time limit (seconds), <= 0 = only MaxEpisodeSteps */
+	UPROPERTY(EditAnywhere, Category = "Racing|Training Worker")
+	float MaxEpisodeSeconds = 120.f;
+
+	/** Exit the process when the coordinator closes the connection */
+	UPROPERTY(EditAnywhere, Category = "Racing|Training Worker")
+	bool bExitOnDisconnect = true;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	bool Connect(const FString& Address);
+	void Disconnect();
+
+	void CollectAgents();
+	void SpawnAgentSlice();
+
+	void ReceiveMessages();
+	void HandleMessage(const TSharedPtr<FJsonObject>& Message);
+	bool SendMessage(const TSharedRef<FJsonObject>& Message);
+
+	void UpdateAgents(float DeltaTime);
+	void DispatchJobs();
+	void StartJob(int32 AgentIndex, const FRacingWorkerJob& Job);
+	void FinishJob(int32 AgentIndex, const FEpisodeStats& Stats);
+
+	USimpleNeuralNetwork* LoadPolicy(const FString& PolicyFile);
+
+	FSocket* Socket = nullptr;
+
+	/** Bytes of an incomplete message line */
+	TArray<uint8> ReceiveBuffer;
+
+	TArray<TWeakObjectPtr<URacingAgentComponent>> Agents;
+
+	/** Job per agent (same index as Agents), invalid = agent is free */
+	UPROPERTY()
+	TArray<FRacingWorkerJob> AgentJobs;
+
+	UPROPERTY()
+	TArray<FRacingWorkerJob> PendingJobs;
+
+	UPROPERTY()
+	TMap<FString, TObjectPtr<USimpleNeuralNetwork>> PolicyCache;
+
+	UPROPERTY()
+	TArray<TObjectPtr<APawn>> SpawnedVehicles;
+
+	FString CoordinatorAddress;
+	FString VehicleClassPath;
+	int32 WorkerId = 0;
+	int32 BaseSeed = 1337;
+	int32 MaxAgents = 0;
+	float FitnessCutoff = 0.f;
+	bool bHelloSent = false;
+};
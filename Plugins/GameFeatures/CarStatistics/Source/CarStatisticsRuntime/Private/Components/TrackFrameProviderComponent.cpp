@@ -4,6 +4,7 @@
 #include "DrawDebugHelpers.h"
 #include "Engine/World.h"
 #include "EngineUtils.h"
+#include "Async/ParallelFor.h"
 
 #include "Interfaces/RoadSplineInterface.h"
 
@@ -119,9 +120,62 @@ void UTrackFrameProviderComponent::TickComponent(float DeltaTime, ELevelTick Tic
 	}
 }
 
+void UTrackFrameProviderComponent::EnsureSplineDataCurrent()
+{
+	if (CachedSplineLength <= 0.0f)
+	{
+		RefreshSplineLength();
+		return;
+	}
+
+	// Once per frame: a moved, edited or rebaked track (possibly at the same length) must not keep serving old frames
+	if (SplineDataCheckedFrame == GFrameCounter)
+	{
+		return;
+	}
+	SplineDataCheckedFrame = GFrameCounter;
+
+	if (!CachedFrameTable.IsValid() || !CachedFrameTable->IsUpToDate(CachedSpline) ||
+		(CachedSpline && !FMath::IsNearlyEqual(CachedSplineLength, CachedSpline->GetSplineLength(), 0.1f)))
+	{
+		RefreshSplineLength();
+	}
+}
+
 void UTrackFrameProviderComponent::RefreshSplineLength()
 {
 	CachedSplineLength = (CachedSpline ? CachedSpline->GetSplineLength() : 0.0f);
+
+	// Provider's baked table, else keep a table built by ComputeFramesBatch while it still matches
+	TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Baked = FTrackFrameTable::FindBaked(CachedSpline);
+	if (Baked.IsValid() || !CachedFrameTable.IsValid() || !CachedFrameTable->IsUpToDate(CachedSpline))
+	{
+		CachedFrameTable = MoveTemp(Baked);
+	}
+}
+
+USplineComponent* UTrackFrameProviderComponent::GetResolvedSpline()
+{
+	if (!CachedSpline)
+	{
+		ResolveRoadSpline();
+	}
+	return CachedSpline;
+}
+
+void UTrackFrameProviderComponent::SetRoadSplineProvider(AActor* InProviderActor)
+{
+	RoadSplineProviderActor = InProviderActor;
+	CachedSpline = nullptr;
+	CachedSplineLength = 0.0f;
+	CachedFrameTable.Reset();
+	bHasLastDistance = false;
+	bHasTrackedDistance = false;
+
+	if (InProviderActor)
+	{
+		ResolveRoadSpline();
+	}
 }
 
 bool UTrackFrameProviderComponent::ResolveRoadSpline()
@@ -221,6 +275,9 @@ void UTrackFrameProviderComponent::ResetProgressTracking(float InitialDistanceAl
 {
 	LastDistanceAlongSpline = InitialDistanceAlongSpline;
 	bHasLastDistance = true;
+
+	// Teleport / respawn: next closest-point query searches globally
+	bHasTrackedDistance = false;
 }
 
 float UTrackFrameProviderComponent::FindClosestDistanceAlongSpline(const FVector& WorldLocation) const
@@ -234,6 +291,134 @@ float UTrackFrameProviderComponent::FindClosestDistanceAlongSpline(const FVector
 	return CachedSpline->GetDistanceAlongSplineAtSplineInputKey(Key);
 }
 
+float UTrackFrameProviderComponent::RelocalizeDistanceAlongSpline(const FVector& WorldLocation, const FVector& Forward) const
+{
+	if (const FTrackFrameTable* Table = GetMatchingFrameTable())
+	{
+		return Table->Relocalize(WorldLocation, Forward, RelocalizeRadiusCm, RelocalizeMinHeadingDot);
+	}
+
+	return FindClosestDistanceAlongSpline(WorldLocation);
+}
+
+float UTrackFrameProviderComponent::TrackClosestDistanceAlongSpline(const FVector& WorldLocation, const FVector& Forward, bool bUpdateTracking)
+{
+	if (!CachedSpline)
+	{
+		return 0.0f;
+	}
+
+	const float Len = CachedSplineLength;
+	const bool bLoop = CachedSpline->IsClosedLoop();
+
+	auto Commit = [this, bUpdateTracking](float S) -> float
+	{
+		if (bUpdateTracking)
+		{
+			TrackedDistanceAlongSpline = S;
+			bHasTrackedDistance = true;
+		}
+		return S;
+	};
+
+	if (!bUseCoherentClosestPoint || !bHasTrackedDistance || Len <= 0.0f)
+	{
+		return Commit(RelocalizeDistanceAlongSpline(WorldLocation, Forward));
+	}
+
+	const FTrackFrameTable* Table = GetMatchingFrameTable();
+
+	// Window is expressed as unwrapped distances around the last result
+	const float W = FMath::Min(CoherentSearchWindowCm, 0.5f * Len);
+	float Lo = TrackedDistanceAlongSpline - W;
+	float Hi = TrackedDistanceAlongSpline + W;
+	if (!bLoop)
+	{
+		Lo = FMath::Max(Lo, 0.0f);
+		Hi = FMath::Min(Hi, Len);
+	}
+
+	auto DistSqAt = [&](float S) -> float
+	{
+		const float SW = bLoop ? WrapDistanceOnSpline(S, Len) : S;
+		const FVector P = Table
+			? Table->GetLocationAtDistance(SW)
+			: CachedSpline->GetLocationAtDistanceAlongSpline(SW, ESplineCoordinateSpace::World);
+		return FVector::DistSquared(P, WorldLocation);
+	};
+
+	// 1) Coarse samples to bracket the minimum (the window may hold several local minima)
+	const int32 N = FMath::Max(2, CoherentCoarseSamples);
+	const float Step = (Hi - Lo) / N;
+
+	int32 BestIdx = 0;
+	float BestDistSq = TNumericLimits<float>::Max();
+	for (int32 i = 0; i <= N; ++i)
+	{
+		const float D = DistSqAt(Lo + i * Step);
+		if (D < BestDistSq)
+		{
+			BestDistSq = D;
+			BestIdx = i;
+		}
+	}
+
+	// Minimum at a window edge that is not a spline end: the car left the window (teleport / large step)
+	const bool bAtLowEdge = (BestIdx == 0) && (bLoop || Lo > 0.0f);
+	const bool bAtHighEdge = (BestIdx == N) && (bLoop || Hi < Len);
+	if (bAtLowEdge || bAtHighEdge)
+	{
+		return Commit(RelocalizeDistanceAlongSpline(WorldLocation, Forward));
+	}
+
+	// 2) Golden-section refinement on the bracket around the best sample
+	float A = Lo + FMath::Max(BestIdx - 1, 0) * Step;
+	float B = Lo + FMath::Min(BestIdx + 1, N) * Step;
+
+	constexpr float InvPhi = 0.6180339887f;
+	float C = B - InvPhi * (B - A);
+	float E = A + InvPhi * (B - A);
+	float FC = DistSqAt(C);
+	float FE = DistSqAt(E);
+
+	for (int32 Iter = 0; Iter < 24 && (B - A) > 0.5f; ++Iter)
+	{
+		if (FC < FE)
+		{
+			B = E;
+			E = C;
+			FE = FC;
+			C = B - InvPhi * (B - A);
+			FC = DistSqAt(C);
+		}
+		else
+		{
+			A = C;
+			C = E;
+			FC = FE;
+			E = A + InvPhi * (B - A);
+			FE = DistSqAt(E);
+		}
+	}
+
+	const float S = 0.5f * (A + B);
+
+	// Too far from the spline: probably the wrong part of the track, search globally
+	if (CoherentMaxDistanceCm > 0.0f && DistSqAt(S) > FMath::Square(CoherentMaxDistanceCm))
+	{
+		return Commit(RelocalizeDistanceAlongSpline(WorldLocation, Forward));
+	}
+
+	return Commit(bLoop ? WrapDistanceOnSpline(S, Len) : FMath::Clamp(S, 0.0f, Len));
+}
+
+const FTrackFrameTable* UTrackFrameProviderComponent::GetMatchingFrameTable() const
+{
+	return (CachedFrameTable.IsValid() && FMath::IsNearlyEqual(CachedFrameTable->GetLengthCm(), CachedSplineLength, 0.1f))
+		? CachedFrameTable.Get()
+		: nullptr;
+}
+
 float UTrackFrameProviderComponent::WrapProgressDelta(float Delta, float SplineLen)
 {
 	if (SplineLen <= 0.0f) return Delta;
@@ -244,6 +429,26 @@ float UTrackFrameProviderComponent::WrapProgressDelta(float Delta, float SplineL
 	return Delta;
 }
 
+void UTrackFrameProviderComponent::ComputeBasisAtDistance(float S, FVector& OutPoint, FVector& OutTangent, FVector& OutRight, FVector& OutNormal) const
+{
+	// Baked table: same basis construction, O(1) lookup
+	if (const FTrackFrameTable* Table = GetMatchingFrameTable())
+	{
+		Table->SampleFrame(S, OutPoint, OutTangent, OutRight, OutNormal);
+		return;
+	}
+
+	OutPoint = CachedSpline->GetLocationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
+	OutTangent = CachedSpline->GetDirectionAtDistanceAlongSpline(S, ESplineCoordinateSpace::World).GetSafeNormal();
+
+	// Use spline rotation for banking/up
+	const FRotator Rot = CachedSpline->GetRotationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
+	const FVector Up = Rot.RotateVector(FVector::UpVector).GetSafeNormal();
+
+	OutRight = FVector::CrossProduct(Up, OutTangent).GetSafeNormal();
+	OutNormal = FVector::CrossProduct(OutTangent, OutRight).GetSafeNormal();
+}
+
 float UTrackFrameProviderComponent::SignedAngleRadAroundAxis(const FVector& From, const FVector& To, const FVector& Axis)
 {
 	const FVector F = From.GetSafeNormal();
@@ -268,24 +473,13 @@ FTrackFrame UTrackFrameProviderComponent::ComputeFrameAtLocation(
 		return Out;
 	}
 
-	if (CachedSplineLength <= 0.0f)
-	{
-		RefreshSplineLength();
-	}
+	EnsureSplineDataCurrent();
 
-	const float S = FindClosestDistanceAlongSpline(WorldLocation);
+	const float S = TrackClosestDistanceAlongSpline(WorldLocation, ForwardVector, bUpdateProgressTracking);
 	Out.DistanceAlongSpline = S;
 
-	Out.ClosestPoint = CachedSpline->GetLocationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
-
-	const FVector Tangent = CachedSpline->GetDirectionAtDistanceAlongSpline(S, ESplineCoordinateSpace::World).GetSafeNormal();
-
-	// Use spline rotation for banking/up
-	const FRotator Rot = CachedSpline->GetRotationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
-	const FVector Up = Rot.RotateVector(FVector::UpVector).GetSafeNormal();
-
-	const FVector Right = FVector::CrossProduct(Up, Tangent).GetSafeNormal();
-	const FVector Normal = FVector::CrossProduct(Tangent, Right).GetSafeNormal();
+	FVector Tangent, Right, Normal;
+	ComputeBasisAtDistance(S, Out.ClosestPoint, Tangent, Right, Normal);
 
 	Out.Tangent = Tangent;
 	Out.Right = Right;
@@ -324,6 +518,8 @@ FTrackFrame UTrackFrameProviderComponent::ComputeFrameAtLocation(
 	{
 		CachedSpline = nullptr;
 		CachedSplineLength = 0.0f;
+		CachedFrameTable.Reset();
+		bHasTrackedDistance = false;
 		ResolveRoadSpline();
 	}
 
@@ -350,10 +546,7 @@ FTrackFrame UTrackFrameProviderComponent::ComputeFrameAtDistance(float DistanceA
 	{
 		return Out;
 	}
-	if (CachedSplineLength <= 0.0f)
-	{
-		RefreshSplineLength();
-	}
+	EnsureSplineDataCurrent();
 	if (!CachedSpline || CachedSplineLength <= 0.0f)
 	{
 		return Out;
@@ -362,14 +555,8 @@ FTrackFrame UTrackFrameProviderComponent::ComputeFrameAtDistance(float DistanceA
 	const float S = WrapDistanceOnSpline(DistanceAlongSpline, CachedSplineLength);
 	Out.DistanceAlongSpline = S;
 
-	Out.ClosestPoint = CachedSpline->GetLocationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
-
-	const FVector Tangent = CachedSpline->GetDirectionAtDistanceAlongSpline(S, ESplineCoordinateSpace::World).GetSafeNormal();
-	const FRotator Rot = CachedSpline->GetRotationAtDistanceAlongSpline(S, ESplineCoordinateSpace::World);
-	const FVector Up = Rot.RotateVector(FVector::UpVector).GetSafeNormal();
-
-	const FVector Right = FVector::CrossProduct(Up, Tangent).GetSafeNormal();
-	const FVector Normal = FVector::CrossProduct(Tangent, Right).GetSafeNormal();
+	FVector Tangent, Right, Normal;
+	ComputeBasisAtDistance(S, Out.ClosestPoint, Tangent, Right, Normal);
 
 	Out.Tangent = Tangent;
 	Out.Right = Right;
@@ -395,10 +582,7 @@ bool UTrackFrameProviderComponent::SampleLookaheadByDistance(
 	{
 		return false;
 	}
-	if (CachedSplineLength <= 0.0f)
-	{
-		RefreshSplineLength();
-	}
+	EnsureSplineDataCurrent();
 	if (!CachedSpline || CachedSplineLength <= 0.0f)
 	{
 		return false;
@@ -446,6 +630,8 @@ bool UTrackFrameProviderComponent::SampleLookaheadByWorldLocation(
 	{
 		CachedSpline = nullptr;
 		CachedSplineLength = 0.0f;
+		CachedFrameTable.Reset();
+		bHasTrackedDistance = false;
 	}
 
 	if (!CachedSpline && !ResolveRoadSpline())
@@ -457,17 +643,14 @@ bool UTrackFrameProviderComponent::SampleLookaheadByWorldLocation(
 
 	OutFrames.Reset();
 
-	if (CachedSplineLength <= 0.0f)
-	{
-		RefreshSplineLength();
-	}
+	EnsureSplineDataCurrent();
 	if (!CachedSpline || CachedSplineLength <= 0.0f)
 	{
 		TFP_LOGFMT(Warning, "SampleLookaheadByWorldLocation: invalid spline length");
 		return false;
 	}
 
-	const float BaseS = FindClosestDistanceAlongSpline(WorldLocation);
+	const float BaseS = TrackClosestDistanceAlongSpline(WorldLocation, ForwardVector);
 
 	OutFrames.Reserve(OffsetsCm.Num());
 	for (const float Offset : OffsetsCm)
@@ -495,6 +678,95 @@ bool UTrackFrameProviderComponent::SampleLookaheadByWorldLocation(
 
 	return true;
 }
+// ===============================
+// Batch API
+// ===============================
+
+bool UTrackFrameProviderComponent::ComputeFramesBatch(const FTrackFrameBatchBuffers& Buffers, TConstArrayView<float> LookaheadOffsetsCm)
+{
+	const int32 NumCars = Buffers.Positions.Num();
+	const int32 NumOffsets = LookaheadOffsetsCm.Num();
+
+	if (Buffers.Distances.Num() != NumCars ||
+		(Buffers.LateralErrors.Num() > 0 && Buffers.LateralErrors.Num() != NumCars) ||
+		(Buffers.HeadingErrors.Num() > 0 && (Buffers.HeadingErrors.Num() != NumCars || Buffers.Forwards.Num() != NumCars)) ||
+		(Buffers.LookaheadCurvatures.Num() > 0 && Buffers.LookaheadCurvatures.Num() != NumCars * NumOffsets))
+	{
+		TFP_LOGFMT(Warning, "ComputeFramesBatch: buffer sizes don't match {Cars} cars / {Offsets} offsets",
+			("Cars", NumCars),
+			("Offsets", NumOffsets));
+		return false;
+	}
+
+	if (!CachedSpline && !ResolveRoadSpline())
+	{
+		return false;
+	}
+	EnsureSplineDataCurrent();
+
+	// Batch needs baked data: build our own table once if the provider doesn't bake one
+	if (!GetMatchingFrameTable())
+	{
+		CachedFrameTable = FTrackFrameTable::Build(CachedSpline);
+	}
+
+	// Keep the table alive for the workers even if the provider rebakes meanwhile
+	const TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> Table = CachedFrameTable;
+	if (!Table.IsValid() || !Table->IsValid())
+	{
+		return false;
+	}
+
+	const float Window = bUseCoherentClosestPoint ? CoherentSearchWindowCm : 0.0f;
+	const float MaxDistSq = (CoherentMaxDistanceCm > 0.0f) ? FMath::Square(CoherentMaxDistanceCm) : TNumericLimits<float>::Max();
+
+	ParallelFor(NumCars, [&](int32 i)
+	{
+		const FVector& P = Buffers.Positions[i];
+
+		const FVector Fwd = (Buffers.Forwards.Num() == NumCars) ? Buffers.Forwards[i] : FVector::ZeroVector;
+
+		// Coherent search near the last distance, relocalize via the spatial hash without one
+		float DistSq = 0.0f;
+		float S = 0.0f;
+		const bool bHasPrior = Window > 0.0f && Buffers.Distances[i] >= 0.0f;
+		if (bHasPrior)
+		{
+			S = Table->FindClosestDistance(P, Buffers.Distances[i], Window, &DistSq);
+		}
+		if (!bHasPrior || DistSq > MaxDistSq)
+		{
+			S = Table->Relocalize(P, Fwd, RelocalizeRadiusCm, RelocalizeMinHeadingDot);
+		}
+		Buffers.Distances[i] = S;
+
+		if (Buffers.LateralErrors.Num() > 0 || Buffers.HeadingErrors.Num() > 0)
+		{
+			FVector Point, Tangent, Right, Normal;
+			Table->SampleFrame(S, Point, Tangent, Right, Normal);
+
+			if (Buffers.LateralErrors.Num() > 0)
+			{
+				Buffers.LateralErrors[i] = FVector::DotProduct(P - Point, Right);
+			}
+			if (Buffers.HeadingErrors.Num() > 0)
+			{
+				Buffers.HeadingErrors[i] = SignedAngleRadAroundAxis(Tangent, Buffers.Forwards[i], Normal);
+			}
+		}
+
+		if (Buffers.LookaheadCurvatures.Num() > 0)
+		{
+			for (int32 k = 0; k < NumOffsets; ++k)
+			{
+				Buffers.LookaheadCurvatures[i * NumOffsets + k] = Table->GetCurvatureAtDistance(S + LookaheadOffsetsCm[k]);
+			}
+		}
+	});
+
+	return true;
+}
+
 // ===============================
 // Progress API (RL-safe)
 // ===============================
@@ -510,12 +782,10 @@ void UTrackFrameProviderComponent::UpdateProgressAtLocation(const FVector& World
 		return;
 	}
 
-	if (CachedSplineLength <= 0.f)
-	{
-		RefreshSplineLength();
-	}
+	EnsureSplineDataCurrent();
 
-	const float S = FindClosestDistanceAlongSpline(WorldLocation);
+	const FVector Forward = GetOwner() ? GetOwner()->GetActorForwardVector() : FVector::ZeroVector;
+	const float S = TrackClosestDistanceAlongSpline(WorldLocation, Forward);
 
 	if (!bHasLastDistance)
 	{
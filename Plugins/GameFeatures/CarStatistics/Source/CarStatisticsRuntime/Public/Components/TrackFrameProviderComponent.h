@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Track/TrackFrameTable.h"
 #include "TrackFrameProviderComponent.generated.h"
 
 class USplineComponent;
@@ -28,6 +29,25 @@ struct FTrackFrame
 	UPROPERTY(BlueprintReadOnly) float ProgressDelta = 0.0f;          // cm (signed)
 };
 
+/**
+ * Caller-owned SoA buffers for UTrackFrameProviderComponent::ComputeFramesBatch (one entry per car).
+ * Views only, nothing is allocated per call. Optional outputs may be left empty.
+ */
+struct FTrackFrameBatchBuffers
+{
+	TConstArrayView<FVector> Positions;
+	TConstArrayView<FVector> Forwards;
+
+	/** In: last distance along the spline (< 0 = unknown, relocalized via the spatial hash). Out: closest distance. */
+	TArrayView<float> Distances;
+
+	TArrayView<float> LateralErrors;   // cm (optional)
+	TArrayView<float> HeadingErrors;   // rad (optional)
+
+	/** Curvature (1/cm) at each lookahead offset, car-major: [Car * NumOffsets + Offset] (optional) */
+	TArrayView<float> LookaheadCurvatures;
+};
+
 UCLASS(ClassGroup = (Track), meta = (BlueprintSpawnableComponent))
 class CARSTATISTICSRUNTIME_API UTrackFrameProviderComponent : public UActorComponent
 {
@@ -41,11 +61,22 @@ public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	//~ End UActorComponent Interface
 
-	/** Recompute cached spline length (safe if spline is null). */
+	/** Recompute cached spline length and pick up the provider's baked frame table (safe if spline is null). */
 	UFUNCTION(BlueprintCallable, Category = "Track|Spline")
 	void RefreshSplineLength();
 
-	/** Force reset progress tracking (useful after teleport/respawn). */
+	/** Bind to a specific road spline provider (multi-track worlds). Clears the cache and progress tracking. */
+	UFUNCTION(BlueprintCallable, Category = "Track|Spline")
+	void SetRoadSplineProvider(AActor* InProviderActor);
+
+	UFUNCTION(BlueprintCallable, Category = "Track|Spline")
+	AActor* GetRoadSplineProvider() const { return RoadSplineProviderActor; }
+
+	/** Resolved road spline (resolves on first use), null if none was found. */
+	UFUNCTION(BlueprintCallable, Category = "Track|Spline")
+	USplineComponent* GetResolvedSpline();
+
+	/** Force reset progress tracking (useful after teleport/respawn). The next closest-point query searches the whole spline. */
 	UFUNCTION(BlueprintCallable, Category = "Track|Progress")
 	void ResetProgressTracking(float InitialDistanceAlongSpline = 0.0f);
 
@@ -84,16 +115,50 @@ public:
 	);
 	void UpdateProgressAtLocation(const FVector& WorldLocation);
 	float ConsumeProgressDeltaCm();
+
+	/**
+	 * Frames for many cars at once against the baked frame table (built once if the provider
+	 * doesn't bake one), evaluated with ParallelFor. Does NOT update progress tracking.
+	 * Distances are tracked coherently per car (CoherentSearchWindowCm) from the values passed in.
+	 */
+	bool ComputeFramesBatch(const FTrackFrameBatchBuffers& Buffers, TConstArrayView<float> LookaheadOffsetsCm);
+
 protected:
 	/** Find and cache the road spline (and provider). */
 	bool ResolveRoadSpline();
 
-	/** Closest distance along spline for a world location. */
+	/** Closest distance along spline for a world location (global search over all segments). */
 	float FindClosestDistanceAlongSpline(const FVector& WorldLocation) const;
 
+	/**
+	 * Closest distance without a prior: spatial hash of the baked frame table, preferring track
+	 * parts heading along Forward (loops / crossings). Global spline search if there is no table.
+	 */
+	float RelocalizeDistanceAlongSpline(const FVector& WorldLocation, const FVector& Forward) const;
+
+	/**
+	 * Closest distance along spline, searched in a window around the last result (coarse samples +
+	 * golden-section refinement). Falls back to the global search on the first query, after a reset,
+	 * or when the result is not trustworthy (window edge, too far from the spline).
+	 * The result becomes the new prior only with bUpdateTracking (side queries leave it alone).
+	 */
+	float TrackClosestDistanceAlongSpline(const FVector& WorldLocation, const FVector& Forward, bool bUpdateTracking = true);
+
+	/** Forget the coherent closest-point state, the next query searches globally. */
+	void InvalidateClosestPointTracking() { bHasTrackedDistance = false; }
+
+	/** Refresh the cached length / frame table if unset, or (once per frame) if the spline moved, changed or was rebaked. */
+	void EnsureSplineDataCurrent();
+
+	/** Baked frame table if it matches the cached spline, else null (kept current by EnsureSplineDataCurrent). */
+	const FTrackFrameTable* GetMatchingFrameTable() const;
+
 	/** Wrap delta for continuous progress on closed splines. */
 	static float WrapProgressDelta(float Delta, float SplineLen);
 
+	/** Point and basis at S (baked frame table if current, else evaluated on the spline). */
+	void ComputeBasisAtDistance(float S, FVector& OutPoint, FVector& OutTangent, FVector& OutRight, FVector& OutNormal) const;
+
 	/** Signed angle between vectors around an axis, in radians. */
 	static float SignedAngleRadAroundAxis(const FVector& From, const FVector& To, const FVector& Axis);
 
@@ -114,6 +179,30 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Track|Spline")
 	float ReResolveIfDistanceAboveCm = 0.0f;
 
+	/** Search the closest point near the last result instead of over the whole spline. */
+	UPROPERTY(EditAnywhere, Category = "Track|Tracking")
+	bool bUseCoherentClosestPoint = true;
+
+	/** Half width of the coherent search window along the spline (cm). Should exceed the distance travelled between queries. */
+	UPROPERTY(EditAnywhere, Category = "Track|Tracking", meta = (ClampMin = "50.0", EditCondition = "bUseCoherentClosestPoint"))
+	float CoherentSearchWindowCm = 1500.0f;
+
+	/** Coarse samples over the window before the golden-section refinement. */
+	UPROPERTY(EditAnywhere, Category = "Track|Tracking", meta = (ClampMin = "2", ClampMax = "64", EditCondition = "bUseCoherentClosestPoint"))
+	int32 CoherentCoarseSamples = 8;
+
+	/** Fall back to the global search if the coherent result is farther than this from the spline (cm). */
+	UPROPERTY(EditAnywhere, Category = "Track|Tracking", meta = (ClampMin = "0.0", EditCondition = "bUseCoherentClosestPoint"))
+	float CoherentMaxDistanceCm = 2000.0f;
+
+	/** Relocalization (no prior): search radius in the frame table's spatial hash (cm). */
+	UPROPERTY(EditAnywhere, Category = "Track|Tracking", meta = (ClampMin = "100.0"))
+	float RelocalizeRadiusCm = 3000.0f;
+
+	/** Relocalization: minimum dot(track tangent, car forward) for a track part to count as the car's branch. */
+	UPROPERTY(EditAnywhere, Category = "Track|Tracking", meta = (ClampMin = "-1.0", ClampMax = "1.0"))
+	float RelocalizeMinHeadingDot = 0.0f;
+
 	/** Draw debug basis axes etc. */
 	UPROPERTY(EditAnywhere, Category = "Debug")
 	bool bDrawDebug = false;
@@ -138,12 +227,25 @@ protected:
 	UPROPERTY(Transient)
 	float CachedSplineLength = 0.0f;
 
+	/** Baked frame table of the provider, null if it doesn't bake one */
+	TSharedPtr<const FTrackFrameTable, ESPMode::ThreadSafe> CachedFrameTable;
+
+	/** GFrameCounter of the last full frame table check */
+	uint64 SplineDataCheckedFrame = 0;
+
 	UPROPERTY(Transient)
 	float LastDistanceAlongSpline = 0.0f;
 
 	UPROPERTY(Transient)
 	bool bHasLastDistance = false;
 
+	/** Last closest-point result (coherent tracking) */
+	UPROPERTY(Transient)
+	float TrackedDistanceAlongSpline = 0.0f;
+
+	UPROPERTY(Transient)
+	bool bHasTrackedDistance = false;
+
 	UPROPERTY(Transient)
 	double LastLogTimeSeconds = -1.0;
 };